@@ -3,6 +3,9 @@
 #include "PYRichTextSyntaxHighlighterTextLayoutMarshaller.h"
 #include "WhiteSpaceTextRun.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
 
 FPYRichTextSyntaxHighlighterTextLayoutMarshaller::FPYRichTextSyntaxHighlighterTextLayoutMarshaller(TSharedPtr< FPythonSyntaxTokenizer > InTokenizer, const FSyntaxTextStyle& InSyntaxTextStyle)
 	: Tokenizer(MoveTemp(InTokenizer))
@@ -20,9 +23,24 @@ void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::SetText(const FString& So
 {
 	if (bSyntaxHighlightingEnabled)
 	{
-		TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines;
-		Tokenizer->Process(TokenizedLines, SourceString);
-		ParseTokens(SourceString, TargetTextLayout, TokenizedLines);
+		UpdateCachedLines(SourceString);
+
+		// the layout owns (and edits) its lines, so they are always rebuilt from the cached runs
+		TArray<FTextLayout::FNewLineData> LinesToAdd;
+		LinesToAdd.Reserve(CachedLines.Num());
+		for (const FCachedLine& Line : CachedLines)
+		{
+			TSharedRef<FString> ModelString = MakeShareable(new FString(Line.Text));
+			TArray< TSharedRef< IRun > > Runs;
+			Runs.Reserve(Line.Runs.Num());
+			for (const FCachedRun& CachedRun : Line.Runs)
+			{
+				Runs.Add(CreateRun(ModelString, CachedRun));
+			}
+			LinesToAdd.Emplace(MoveTemp(ModelString), MoveTemp(Runs));
+		}
+
+		TargetTextLayout.AddLines(LinesToAdd);
 	}
 	else
 	{
@@ -267,188 +285,300 @@ TSharedRef< FPYRichTextSyntaxHighlighterTextLayoutMarshaller > FPYRichTextSyntax
 
 
 
-void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::ParseTokens(const FString& SourceString, FTextLayout& TargetTextLayout, TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines)
+int32 FPYRichTextSyntaxHighlighterTextLayoutMarshaller::UpdateCachedLines(const FString& SourceString)
 {
-	enum class EParseState : uint8
+	TArray<FTextRange> LineRanges;
+	FTextRange::CalculateLineRangesFromString(SourceString, LineRanges);
+	const int32 NumLines = LineRanges.Num();
+	const int32 NumCachedLines = CachedLines.Num();
+
+	auto IsSameLine = [&SourceString, &LineRanges, this](int32 LineIndex, int32 CachedLineIndex)
 	{
-		None,
-		LookingForString,
-		LookingForCharacter,
-		LookingForDefine,
-		LookingForSingleLineComment,
-		LookingForMultiLineString,
+		const FTextRange& LineRange = LineRanges[LineIndex];
+		const FString& CachedText = CachedLines[CachedLineIndex].Text;
+		return CachedText.Len() == LineRange.Len() && FCString::Strncmp(*SourceString + LineRange.BeginIndex, *CachedText, LineRange.Len()) == 0;
 	};
 
-	TArray<FTextLayout::FNewLineData> LinesToAdd;
-	LinesToAdd.Reserve(TokenizedLines.Num());
+	// an edit dirties a block of lines, the unchanged lines before and after it keep their cache
+	int32 Prefix = 0;
+	while (Prefix < NumLines && Prefix < NumCachedLines && IsSameLine(Prefix, Prefix))
+	{
+		Prefix++;
+	}
 
-	// Parse the tokens, generating the styled runs for each line
-	EParseState ParseState = EParseState::None;
-	for(const FPythonSyntaxTokenizer::FTokenizedLine& TokenizedLine : TokenizedLines)
+	int32 Suffix = 0;
+	while (Suffix < NumLines - Prefix && Suffix < NumCachedLines - Prefix && IsSameLine(NumLines - 1 - Suffix, NumCachedLines - 1 - Suffix))
 	{
-		TSharedRef<FString> ModelString = MakeShareable(new FString());
-		TArray< TSharedRef< IRun > > Runs;
+		Suffix++;
+	}
 
-		if(ParseState == EParseState::LookingForSingleLineComment)
+	TArray<FCachedLine> NewLines;
+	NewLines.SetNum(NumLines);
+	for (int32 LineIndex = 0; LineIndex < Prefix; LineIndex++)
+	{
+		NewLines[LineIndex] = MoveTemp(CachedLines[LineIndex]);
+	}
+	for (int32 Offset = 1; Offset <= Suffix; Offset++)
+	{
+		NewLines[NumLines - Offset] = MoveTemp(CachedLines[NumCachedLines - Offset]);
+	}
+
+	int32 TokenizedLines = 0;
+	EParseState State = Prefix > 0 ? NewLines[Prefix - 1].ExitState : EParseState::None;
+	for (int32 LineIndex = Prefix; LineIndex < NumLines; LineIndex++)
+	{
+		// comments end with their line, everything else carries over
+		const EParseState EntryState = State == EParseState::LookingForSingleLineComment ? EParseState::None : State;
+		FCachedLine& Line = NewLines[LineIndex];
+
+		// an unchanged line is still valid if the state it starts with did not change (like an opened multi-line string)
+		if (LineIndex >= NumLines - Suffix && Line.EntryState == EntryState)
 		{
-			ParseState = EParseState::None;
+			State = Line.ExitState;
+			continue;
 		}
 
-		for(const FPythonSyntaxTokenizer::FToken& Token : TokenizedLine.Tokens)
+		if (LineIndex < NumLines - Suffix)
 		{
-			const FString TokenText = SourceString.Mid(Token.Range.BeginIndex, Token.Range.Len());
-			bool hasNextChar = false;
-			if (Token.Range.BeginIndex + Token.Range.Len() <= SourceString.Len()-1) {
-				const FString NextText = SourceString.Mid(Token.Range.BeginIndex + Token.Range.Len(), 1);
-				if (TChar<WIDECHAR>::IsAlpha(NextText[0]) || NextText[0]==TEXT('_')) {
-					hasNextChar = true;
-				}
+			Line.Text = SourceString.Mid(LineRanges[LineIndex].BeginIndex, LineRanges[LineIndex].Len());
+		}
+		Line.EntryState = EntryState;
+		ParseLine(Line);
+		State = Line.ExitState;
+		TokenizedLines++;
+	}
+
+	CachedLines = MoveTemp(NewLines);
+	return TokenizedLines;
+}
+
+TSharedRef< ISlateRun > FPYRichTextSyntaxHighlighterTextLayoutMarshaller::CreateRun(const TSharedRef<FString>& ModelString, const FCachedRun& CachedRun) const
+{
+	switch (CachedRun.Style)
+	{
+	case ERunStyle::Operator:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.Operator")), ModelString, SyntaxTextStyle.OperatorTextStyle, CachedRun.Range);
+	case ERunStyle::Keyword:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.Keyword")), ModelString, SyntaxTextStyle.KeywordTextStyle, CachedRun.Range);
+	case ERunStyle::String:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.String")), ModelString, SyntaxTextStyle.StringTextStyle, CachedRun.Range);
+	case ERunStyle::Comment:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.Comment")), ModelString, SyntaxTextStyle.CommentTextStyle, CachedRun.Range);
+	case ERunStyle::BuiltIn:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.BuiltIn")), ModelString, SyntaxTextStyle.BuiltInKeywordTextStyle, CachedRun.Range);
+	case ERunStyle::Define:
+		return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.Define")), ModelString, SyntaxTextStyle.DefineTextStyle, CachedRun.Range);
+	case ERunStyle::WhiteSpace:
+		return FWhiteSpaceTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.CPP.WhiteSpace")), ModelString, SyntaxTextStyle.NormalTextStyle, CachedRun.Range, 4);
+	default:
+		break;
+	}
+	return FSlateTextRun::Create(FRunInfo(TEXT("SyntaxHighlight.PY.Normal")), ModelString, SyntaxTextStyle.NormalTextStyle, CachedRun.Range);
+}
+
+void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::ParseLine(FCachedLine& Line) const
+{
+	FPythonSyntaxTokenizer::FTokenizedLine TokenizedLine;
+	Tokenizer->TokenizeLine(Line.Text, FTextRange(0, Line.Text.Len()), TokenizedLine);
+
+	const TCHAR* LineText = *Line.Text;
+	const int32 LineLen = Line.Text.Len();
+
+	Line.Runs.Reset(TokenizedLine.Tokens.Num());
+
+	// Parse the tokens, generating the styled runs for the line
+	EParseState ParseState = Line.EntryState;
+	for(const FPythonSyntaxTokenizer::FToken& Token : TokenizedLine.Tokens)
+	{
+		const TCHAR* TokenText = LineText + Token.Range.BeginIndex;
+		const int32 TokenLen = Token.Range.Len();
+		auto TokenEquals = [TokenText, TokenLen](const TCHAR* Match)
+		{
+			return FCString::Strlen(Match) == TokenLen && FCString::Strncmp(TokenText, Match, TokenLen) == 0;
+		};
+
+		bool hasNextChar = false;
+		if (Token.Range.EndIndex < LineLen) {
+			const TCHAR NextChar = LineText[Token.Range.EndIndex];
+			if (TChar<WIDECHAR>::IsAlpha(NextChar) || NextChar==TEXT('_')) {
+				hasNextChar = true;
 			}
-			
-			const FTextRange ModelRange(ModelString->Len(), ModelString->Len() + TokenText.Len());
-			ModelString->Append(TokenText);
-
-			FRunInfo RunInfo(TEXT("SyntaxHighlight.PY.Normal"));
-			FTextBlockStyle TextBlockStyle = SyntaxTextStyle.NormalTextStyle;
-
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
-			const bool bIsWhitespace = FString(TokenText).TrimEnd().IsEmpty();
-#else
-			const bool bIsWhitespace = FString(TokenText).TrimTrailing().IsEmpty();
-#endif
-			if(!bIsWhitespace)
+		}
+
+		bool bIsWhitespace = true;
+		for (int32 Index = 0; Index < TokenLen; Index++)
+		{
+			if (!FChar::IsWhitespace(TokenText[Index]))
 			{
-				bool bHasMatchedSyntax = false;
-				if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Syntax)
-				{
-					if (ParseState == EParseState::None && TokenText == TEXT("\"\"\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForMultiLineString;
-					}
-					else if (ParseState == EParseState::LookingForMultiLineString && TokenText == TEXT("\"\"\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if(ParseState == EParseState::None && TokenText == TEXT("\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForString;
-						bHasMatchedSyntax = true;
-					}
-					else if(ParseState == EParseState::LookingForString && TokenText == TEXT("\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if(ParseState == EParseState::None && TokenText == TEXT("\'"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForCharacter;
-						bHasMatchedSyntax = true;
-					}
-					else if(ParseState == EParseState::LookingForCharacter && TokenText == TEXT("\'"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					//else if(ParseState == EParseState::None && TokenText.StartsWith(TEXT("#")))
-					//{
-					//	RunInfo.Name = TEXT("SyntaxHighlight.CPP.PreProcessorKeyword");
-					//	TextBlockStyle = SyntaxTextStyle.PreProcessorKeywordTextStyle;
-					//	ParseState = EParseState::None;
-					//}
-					else if(ParseState == EParseState::None && TokenText == TEXT("#"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Comment");
-						TextBlockStyle = SyntaxTextStyle.CommentTextStyle;
-						ParseState = EParseState::LookingForSingleLineComment;
-					}
+				bIsWhitespace = false;
+				break;
+			}
+		}
 
-					else if(ParseState == EParseState::None && !hasNextChar && Token.SyntaxType==FPythonSyntaxTokenizer::ESyntaxType::Keywords)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Keyword");
-						TextBlockStyle = SyntaxTextStyle.KeywordTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if (ParseState == EParseState::None && !hasNextChar && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Function)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.BuiltIn");
-						TextBlockStyle = SyntaxTextStyle.BuiltInKeywordTextStyle;
-						ParseState = EParseState::None;
-						if (TokenText == TEXT("def") || TokenText == TEXT("class")) {
-							bHasMatchedSyntax = true;
-							ParseState = EParseState::LookingForDefine;
-						}
-					}
-					else if (ParseState == EParseState::LookingForDefine && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Terminals)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.NormalTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if (ParseState == EParseState::None && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Operators)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Operator");
-						TextBlockStyle = SyntaxTextStyle.OperatorTextStyle;
-						ParseState = EParseState::None;
-					}
+		ERunStyle Style = ERunStyle::Normal;
 
+		if(!bIsWhitespace)
+		{
+			bool bHasMatchedSyntax = false;
+			if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Syntax)
+			{
+				if (ParseState == EParseState::None && TokenEquals(TEXT("\"\"\"")))
+				{
+					Style = ERunStyle::String;
+					ParseState = EParseState::LookingForMultiLineString;
 				}
-				
-				// It's possible that we fail to match a syntax token if we're in a state where it isn't parsed
-				// In this case, we treat it as a literal token
-				if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Literal || !bHasMatchedSyntax)
+				else if (ParseState == EParseState::LookingForMultiLineString && TokenEquals(TEXT("\"\"\"")))
 				{
-					if(ParseState == EParseState::LookingForString)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-					}
-					else if (ParseState == EParseState::LookingForDefine)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Define");
-						TextBlockStyle = SyntaxTextStyle.DefineTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForCharacter)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForSingleLineComment)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Comment");
-						TextBlockStyle = SyntaxTextStyle.CommentTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForMultiLineString)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
+					Style = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && TokenEquals(TEXT("\"")))
+				{
+					Style = ERunStyle::String;
+					ParseState = EParseState::LookingForString;
+					bHasMatchedSyntax = true;
+				}
+				else if(ParseState == EParseState::LookingForString && TokenEquals(TEXT("\"")))
+				{
+					Style = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && TokenEquals(TEXT("\'")))
+				{
+					Style = ERunStyle::String;
+					ParseState = EParseState::LookingForCharacter;
+					bHasMatchedSyntax = true;
+				}
+				else if(ParseState == EParseState::LookingForCharacter && TokenEquals(TEXT("\'")))
+				{
+					Style = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && TokenEquals(TEXT("#")))
+				{
+					Style = ERunStyle::Comment;
+					ParseState = EParseState::LookingForSingleLineComment;
+				}
+				else if(ParseState == EParseState::None && !hasNextChar && Token.SyntaxType==FPythonSyntaxTokenizer::ESyntaxType::Keywords)
+				{
+					Style = ERunStyle::Keyword;
+				}
+				else if (ParseState == EParseState::None && !hasNextChar && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Function)
+				{
+					Style = ERunStyle::BuiltIn;
+					if (TokenEquals(TEXT("def")) || TokenEquals(TEXT("class"))) {
+						bHasMatchedSyntax = true;
+						ParseState = EParseState::LookingForDefine;
 					}
 				}
-
-				TSharedRef< ISlateRun > Run = FSlateTextRun::Create(RunInfo, ModelString, TextBlockStyle, ModelRange);
-				Runs.Add(Run);
+				else if (ParseState == EParseState::LookingForDefine && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Terminals)
+				{
+					Style = ERunStyle::Normal;
+					ParseState = EParseState::None;
+				}
+				else if (ParseState == EParseState::None && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Operators)
+				{
+					Style = ERunStyle::Operator;
+				}
 			}
-			else
+
+			// It's possible that we fail to match a syntax token if we're in a state where it isn't parsed
+			// In this case, we treat it as a literal token
+			if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Literal || !bHasMatchedSyntax)
 			{
-				RunInfo.Name = TEXT("SyntaxHighlight.CPP.WhiteSpace");
-				TSharedRef< ISlateRun > Run = FWhiteSpaceTextRun::Create(RunInfo, ModelString, TextBlockStyle, ModelRange, 4);
-				Runs.Add(Run);
+				if(ParseState == EParseState::LookingForString || ParseState == EParseState::LookingForCharacter || ParseState == EParseState::LookingForMultiLineString)
+				{
+					Style = ERunStyle::String;
+				}
+				else if (ParseState == EParseState::LookingForDefine)
+				{
+					Style = ERunStyle::Define;
+				}
+				else if(ParseState == EParseState::LookingForSingleLineComment)
+				{
+					Style = ERunStyle::Comment;
+				}
 			}
 		}
+		else
+		{
+			Style = ERunStyle::WhiteSpace;
+		}
 
-		LinesToAdd.Emplace(MoveTemp(ModelString), MoveTemp(Runs));
+		FCachedRun CachedRun;
+		CachedRun.Range = Token.Range;
+		CachedRun.Style = Style;
+		Line.Runs.Add(CachedRun);
 	}
 
-	TargetTextLayout.AddLines(LinesToAdd);
+	Line.ExitState = ParseState;
 }
 
+namespace
+{
+	// py.editor.tokenizer_benchmark [file]: tokenize a large file (a generated one by default)
+	// from scratch and then after single line edits, like when typing in the editor
+	static void consoleTokenizerBenchmark(const TArray<FString>& Args)
+	{
+		FString Source;
+		const FString Path = FString::Join(Args, TEXT(" "));
+		if (!Path.IsEmpty())
+		{
+			if (!FFileHelper::LoadFileToString(Source, *Path))
+			{
+				UE_LOG(LogTemp, Error, TEXT("unable to load %s"), *Path);
+				return;
+			}
+		}
+		else
+		{
+			const TCHAR* Block = TEXT("class Spawner(object):\n")
+				TEXT("    \"\"\"spawn actors in a grid\"\"\"\n")
+				TEXT("    def __init__(self, world, count=10):\n")
+				TEXT("        self.world = world  # the target world\n")
+				TEXT("        self.actors = [None] * count\n")
+				TEXT("    def spawn(self, cls, x, y):\n")
+				TEXT("        if x >= 0 and y >= 0 or not self.actors:\n")
+				TEXT("            return self.world.actor_spawn(cls, FVector(x * 100, y * 100, 0))\n")
+				TEXT("        raise ValueError('invalid position %d %d' % (x, y))\n")
+				TEXT("\n");
+			for (int32 Index = 0; Index < 500; Index++)
+			{
+				Source += Block;
+			}
+		}
+
+		TSharedRef< FPYRichTextSyntaxHighlighterTextLayoutMarshaller > Marshaller = FPYRichTextSyntaxHighlighterTextLayoutMarshaller::Create(FPYRichTextSyntaxHighlighterTextLayoutMarshaller::FSyntaxTextStyle());
+
+		double StartTime = FPlatformTime::Seconds();
+		int32 Lines = Marshaller->UpdateCachedLines(Source);
+		UE_LOG(LogTemp, Display, TEXT("full tokenization: %d lines in %.3fms"), Lines, (FPlatformTime::Seconds() - StartTime) * 1000);
+
+		// type 100 characters in the middle of the document
+		const int32 EditOffset = Source.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Source.Len() / 2);
+		int32 TotalLines = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < 100; Index++)
+		{
+			Source.InsertAt(EditOffset, TEXT('x'));
+			TotalLines += Marshaller->UpdateCachedLines(Source);
+		}
+		UE_LOG(LogTemp, Display, TEXT("single character edits: %d lines tokenized, %.3fms per edit"), TotalLines, (FPlatformTime::Seconds() - StartTime) * 10);
+
+		// opening a multi-line string dirties everything after it, closing it restores the cached lines
+		StartTime = FPlatformTime::Seconds();
+		Source.InsertAt(EditOffset, TEXT("\"\"\""));
+		Lines = Marshaller->UpdateCachedLines(Source);
+		UE_LOG(LogTemp, Display, TEXT("multi-line string opened: %d lines tokenized in %.3fms"), Lines, (FPlatformTime::Seconds() - StartTime) * 1000);
+
+		StartTime = FPlatformTime::Seconds();
+		Source.RemoveAt(EditOffset, 3);
+		Lines = Marshaller->UpdateCachedLines(Source);
+		UE_LOG(LogTemp, Display, TEXT("multi-line string closed: %d lines tokenized in %.3fms"), Lines, (FPlatformTime::Seconds() - StartTime) * 1000);
+	}
+}
 
+FAutoConsoleCommand TokenizerBenchmarkCommand(
+	TEXT("py.editor.tokenizer_benchmark"),
+	*NSLOCTEXT("PythonEditor", "CommandText_TokenizerBenchmark", "Benchmark the python editor syntax highlighter").ToString(),
+	FConsoleCommandWithArgsDelegate::CreateStatic(consoleTokenizerBenchmark));
@@ -62,9 +62,56 @@ public:
 	void EnableSyntaxHighlighting(const bool bEnable);
 	bool IsSyntaxHighlightingEnabled() const;
 
+	/** Parser state at the boundaries of a line (strings and definitions can span multiple lines) */
+	enum class EParseState : uint8
+	{
+		None,
+		LookingForString,
+		LookingForCharacter,
+		LookingForDefine,
+		LookingForSingleLineComment,
+		LookingForMultiLineString,
+	};
+
+	enum class ERunStyle : uint8
+	{
+		Normal,
+		Operator,
+		Keyword,
+		String,
+		Comment,
+		BuiltIn,
+		Define,
+		WhiteSpace,
+	};
+
+	/** A styled range of a line, relative to the line text */
+	struct FCachedRun
+	{
+		FTextRange Range;
+		ERunStyle Style;
+	};
+
+	/** A tokenized line, reused until its text or the state it starts with change */
+	struct FCachedLine
+	{
+		FString Text;
+		EParseState EntryState;
+		EParseState ExitState;
+		TArray<FCachedRun> Runs;
+	};
+
+	/** Update the per line cache for the new text, returns the number of lines tokenized again */
+	int32 UpdateCachedLines(const FString& SourceString);
+
 protected:
 
-	void ParseTokens(const FString& SourceString, FTextLayout& TargetTextLayout, TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines);
+	void ParseLine(FCachedLine& Line) const;
+
+	TSharedRef< ISlateRun > CreateRun(const TSharedRef<FString>& ModelString, const FCachedRun& CachedRun) const;
+
+	/** Lines of the last text set, in order */
+	TArray<FCachedLine> CachedLines;
 
 
 	/** Tokenizer used to style the text */
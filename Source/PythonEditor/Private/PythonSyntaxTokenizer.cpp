@@ -1,7 +1,11 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "PythonSyntaxTokenizer.h"
-#include "Runtime/Core/Public/Internationalization/BreakIterator.h"
+
+static bool IsIdentifierChar(TCHAR Character)
+{
+	return FChar::IsAlnum(Character) || Character == TEXT('_');
+}
 
 TSharedRef< FPythonSyntaxTokenizer > FPythonSyntaxTokenizer::Create(TArray<FRule> InRules)
 {
@@ -14,73 +18,159 @@ FPythonSyntaxTokenizer::~FPythonSyntaxTokenizer()
 
 void FPythonSyntaxTokenizer::Process(TArray<FTokenizedLine>& OutTokenizedLines, const FString& Input)
 {
-#if UE_ENABLE_ICU
 	TArray<FTextRange> LineRanges;
 	FTextRange::CalculateLineRangesFromString(Input, LineRanges);
 	TokenizeLineRanges(Input, LineRanges, OutTokenizedLines);
-#else
-	FTokenizedLine FakeTokenizedLine;
-	FakeTokenizedLine.Range = FTextRange(0, Input.Len());
-	FakeTokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, FakeTokenizedLine.Range));
-	OutTokenizedLines.Add(FakeTokenizedLine);
-#endif
 }
 
 FPythonSyntaxTokenizer::FPythonSyntaxTokenizer(TArray<FRule> InRules)
 	: Rules(MoveTemp(InRules))
 {
+	for (int32 Index = 0; Index < 128; Index++)
+	{
+		RootAsciiChildren[Index] = INDEX_NONE;
+	}
+
+	TrieNodes.AddDefaulted();
+
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); RuleIndex++)
+	{
+		const FString& MatchText = Rules[RuleIndex].MatchText;
+		int32 NodeIndex = 0;
+		for (const TCHAR Character : MatchText)
+		{
+			int32 ChildIndex = FindChild(NodeIndex, Character);
+			if (ChildIndex == INDEX_NONE)
+			{
+				ChildIndex = TrieNodes.AddDefaulted();
+				TArray<TPair<TCHAR, int32>>& Children = TrieNodes[NodeIndex].Children;
+				int32 InsertAt = 0;
+				while (InsertAt < Children.Num() && Children[InsertAt].Key < Character)
+				{
+					InsertAt++;
+				}
+				Children.Insert(TPair<TCHAR, int32>(Character, ChildIndex), InsertAt);
+				if (NodeIndex == 0 && (uint32)Character < 128)
+				{
+					RootAsciiChildren[Character] = ChildIndex;
+				}
+			}
+			NodeIndex = ChildIndex;
+		}
+
+		// duplicated rules keep the first one
+		if (NodeIndex != 0 && TrieNodes[NodeIndex].RuleIndex == INDEX_NONE)
+		{
+			TrieNodes[NodeIndex].RuleIndex = RuleIndex;
+		}
+	}
 }
 
-void FPythonSyntaxTokenizer::TokenizeLineRanges(const FString& Input, const TArray<FTextRange>& LineRanges, TArray<FTokenizedLine>& OutTokenizedLines)
+int32 FPythonSyntaxTokenizer::FindChild(int32 NodeIndex, TCHAR Character) const
 {
-	TSharedRef<IBreakIterator> WBI = FBreakIterator::CreateWordBreakIterator();
-	WBI->SetString(Input);
+	if (NodeIndex == 0 && (uint32)Character < 128)
+	{
+		return RootAsciiChildren[Character];
+	}
 
-	// Tokenize line ranges
-	for(const FTextRange& LineRange : LineRanges)
+	for (const TPair<TCHAR, int32>& Child : TrieNodes[NodeIndex].Children)
 	{
-		FTokenizedLine TokenizedLine;
-		TokenizedLine.Range = LineRange;
+		if (Child.Key == Character)
+		{
+			return Child.Value;
+		}
+		if (Child.Key > Character)
+		{
+			break;
+		}
+	}
+	return INDEX_NONE;
+}
 
-		if(TokenizedLine.Range.IsEmpty())
+int32 FPythonSyntaxTokenizer::MatchRule(const TCHAR* Text, int32 Offset, int32 EndIndex) const
+{
+	int32 MatchedRule = INDEX_NONE;
+	int32 NodeIndex = 0;
+	for (int32 CurrentOffset = Offset; CurrentOffset < EndIndex; CurrentOffset++)
+	{
+		NodeIndex = FindChild(NodeIndex, Text[CurrentOffset]);
+		if (NodeIndex == INDEX_NONE)
 		{
-			TokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, TokenizedLine.Range, ESyntaxType::None));
+			break;
 		}
-		else
+
+		const int32 RuleIndex = TrieNodes[NodeIndex].RuleIndex;
+		if (RuleIndex == INDEX_NONE)
 		{
-			int32 CurrentOffset = LineRange.BeginIndex;
-			while(CurrentOffset < LineRange.EndIndex)
-			{
-				// First check for a match against any syntax token rules
-				bool bHasMatchedSyntax = false;
-				for(const FRule& Rule : Rules)
-				{
-					if(FCString::Strncmp(&Input[CurrentOffset], *Rule.MatchText, Rule.MatchText.Len()) == 0)
-					{
-						const int32 SyntaxTokenEnd = CurrentOffset + Rule.MatchText.Len();
-						TokenizedLine.Tokens.Emplace(FToken(ETokenType::Syntax, FTextRange(CurrentOffset, SyntaxTokenEnd), Rule.SyntaxType));
+			continue;
+		}
+
+		// keywords must not be the beginning of a longer identifier ("import" vs "important")
+		const bool bWordRule = IsIdentifierChar(Text[CurrentOffset]);
+		if (!bWordRule || CurrentOffset + 1 >= EndIndex || !IsIdentifierChar(Text[CurrentOffset + 1]))
+		{
+			MatchedRule = RuleIndex;
+		}
+	}
+	return MatchedRule;
+}
 
-						check(SyntaxTokenEnd <= LineRange.EndIndex);
+void FPythonSyntaxTokenizer::TokenizeLine(const FString& Input, const FTextRange& LineRange, FTokenizedLine& OutTokenizedLine) const
+{
+	OutTokenizedLine.Range = LineRange;
+	OutTokenizedLine.Tokens.Reset();
 
-						bHasMatchedSyntax = true;
-						CurrentOffset = SyntaxTokenEnd;
-						break;
-					}
-				}
+	if (LineRange.IsEmpty())
+	{
+		OutTokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, LineRange, ESyntaxType::None));
+		return;
+	}
 
-				if(bHasMatchedSyntax)
-				{
-					continue;
-				}
+	const TCHAR* Text = *Input;
+	int32 CurrentOffset = LineRange.BeginIndex;
+	while (CurrentOffset < LineRange.EndIndex)
+	{
+		// First check for a match against any syntax token rules
+		const int32 RuleIndex = MatchRule(Text, CurrentOffset, LineRange.EndIndex);
+		if (RuleIndex != INDEX_NONE)
+		{
+			const FRule& Rule = Rules[RuleIndex];
+			const int32 SyntaxTokenEnd = CurrentOffset + Rule.MatchText.Len();
+			OutTokenizedLine.Tokens.Emplace(FToken(ETokenType::Syntax, FTextRange(CurrentOffset, SyntaxTokenEnd), Rule.SyntaxType));
+			CurrentOffset = SyntaxTokenEnd;
+			continue;
+		}
 
-				// If none matched, consume the character(s) as text
-				const int32 NextWordBoundary = WBI->MoveToCandidateAfter(CurrentOffset);
-				const int32 TextTokenEnd = (NextWordBoundary == INDEX_NONE) ? LineRange.EndIndex : FMath::Min(NextWordBoundary, LineRange.EndIndex);
-				TokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, FTextRange(CurrentOffset, TextTokenEnd), ESyntaxType::None));
-				CurrentOffset = TextTokenEnd;
+		// If none matched, consume a whole identifier (or number), a whitespace run or a single character as text
+		int32 TextTokenEnd = CurrentOffset + 1;
+		if (IsIdentifierChar(Text[CurrentOffset]))
+		{
+			while (TextTokenEnd < LineRange.EndIndex && IsIdentifierChar(Text[TextTokenEnd]))
+			{
+				TextTokenEnd++;
+			}
+		}
+		else if (FChar::IsWhitespace(Text[CurrentOffset]))
+		{
+			while (TextTokenEnd < LineRange.EndIndex && FChar::IsWhitespace(Text[TextTokenEnd]))
+			{
+				TextTokenEnd++;
 			}
 		}
+		OutTokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, FTextRange(CurrentOffset, TextTokenEnd), ESyntaxType::None));
+		CurrentOffset = TextTokenEnd;
+	}
+}
+
+void FPythonSyntaxTokenizer::TokenizeLineRanges(const FString& Input, const TArray<FTextRange>& LineRanges, TArray<FTokenizedLine>& OutTokenizedLines)
+{
+	OutTokenizedLines.Reserve(OutTokenizedLines.Num() + LineRanges.Num());
 
-		OutTokenizedLines.Add(TokenizedLine);
+	// Tokenize line ranges
+	for (const FTextRange& LineRange : LineRanges)
+	{
+		FTokenizedLine TokenizedLine;
+		TokenizeLine(Input, LineRange, TokenizedLine);
+		OutTokenizedLines.Add(MoveTemp(TokenizedLine));
 	}
 }
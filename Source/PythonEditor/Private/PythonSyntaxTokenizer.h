@@ -65,7 +65,7 @@ public:
 
 	/** 
 	 * Create a new tokenizer which will use the given rules to match syntax tokens
-	 * @param InRules Rules to control the tokenizer, processed in-order so the most greedy matches must come first
+	 * @param InRules Rules to control the tokenizer, the longest matching rule wins (identifier-like rules only match whole words)
 	 */
 	static TSharedRef< FPythonSyntaxTokenizer > Create(TArray<FRule> InRules);
 
@@ -73,13 +73,34 @@ public:
 
 	void Process(TArray<FTokenizedLine>& OutTokenizedLines, const FString& Input);
 
+	/** Tokenize a single line, token ranges are relative to Input */
+	void TokenizeLine(const FString& Input, const FTextRange& LineRange, FTokenizedLine& OutTokenizedLine) const;
+
 private:
 
 	FPythonSyntaxTokenizer(TArray<FRule> InRules);
 
 	void TokenizeLineRanges(const FString& Input, const TArray<FTextRange>& LineRanges, TArray<FTokenizedLine>& OutTokenizedLines);
 
-	/** Rules to control the tokenizer, processed in-order so the most greedy matches must come first */
+	/** Returns the index of the longest rule matching at Offset (INDEX_NONE if none matches) */
+	int32 MatchRule(const TCHAR* Text, int32 Offset, int32 EndIndex) const;
+
+	/** Node of the rules trie, children are sorted by character */
+	struct FTrieNode
+	{
+		TArray<TPair<TCHAR, int32>> Children;
+		int32 RuleIndex = INDEX_NONE;
+	};
+
+	int32 FindChild(int32 NodeIndex, TCHAR Character) const;
+
+	/** Rules to control the tokenizer, the longest match wins */
 	TArray<FRule> Rules;
 
+	/** Every rule string compiled in a single trie (the first node is the root) */
+	TArray<FTrieNode> TrieNodes;
+
+	/** Direct lookup of the root children for ASCII characters */
+	int32 RootAsciiChildren[128];
+
 };
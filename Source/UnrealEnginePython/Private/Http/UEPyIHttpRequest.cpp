@@ -2,8 +2,10 @@
 #include "UEPyIHttpRequest.h"
 
 #include "UEPyIHttpResponse.h"
+#include "UEPyAsyncio.h"
 
 #include "Runtime/Online/HTTP/Public/HttpManager.h"
+#include "HAL/ThreadSafeCounter.h"
 
 static PyObject *py_ue_ihttp_request_set_verb(ue_PyIHttpRequest *self, PyObject * args)
 {
@@ -63,6 +65,44 @@ static PyObject *py_ue_ihttp_request_append_to_header(ue_PyIHttpRequest *self, P
 	Py_RETURN_NONE;
 }
 
+#if ENGINE_MAJOR_VERSION == 5
+// streams the request body straight from a python buffer, read by the http thread
+class FUEPyHttpBufferArchive : public FArchive
+{
+public:
+	FUEPyHttpBufferArchive(const Py_buffer &InBuffer) : Buffer(InBuffer), Pos(0)
+	{
+		SetIsLoading(true);
+	}
+
+	~FUEPyHttpBufferArchive()
+	{
+		FScopePythonGIL gil;
+		PyBuffer_Release(&Buffer);
+	}
+
+	virtual void Serialize(void *V, int64 Length) override
+	{
+		if (Length < 0 || Pos + Length > (int64)Buffer.len)
+		{
+			SetError();
+			return;
+		}
+		FMemory::Memcpy(V, (uint8 *)Buffer.buf + Pos, Length);
+		Pos += Length;
+	}
+
+	virtual int64 Tell() override { return Pos; }
+	virtual int64 TotalSize() override { return Buffer.len; }
+	virtual void Seek(int64 InPos) override { Pos = InPos; }
+	virtual FString GetArchiveName() const override { return TEXT("FUEPyHttpBufferArchive"); }
+
+private:
+	Py_buffer Buffer;
+	int64 Pos;
+};
+#endif
+
 static PyObject *py_ue_ihttp_request_set_content(ue_PyIHttpRequest *self, PyObject * args)
 {
 
@@ -76,19 +116,136 @@ static PyObject *py_ue_ihttp_request_set_content(ue_PyIHttpRequest *self, PyObje
 	{
 		self->http_request->SetContentAsString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)));
 	}
-	else if (PyBytes_Check(py_obj))
+	else if (PyObject_CheckBuffer(py_obj))
 	{
-		char *buf = nullptr;
-		Py_ssize_t len = 0;
-		PyBytes_AsStringAndSize(py_obj, &buf, &len);
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_SIMPLE) < 0)
+		{
+			return nullptr;
+		}
+#if ENGINE_MAJOR_VERSION == 5
+		// the buffer (and its exporter) stays locked until the request is done with the body
+		TSharedRef<FArchive, ESPMode::ThreadSafe> stream = MakeShareable(new FUEPyHttpBufferArchive(py_buf));
+		if (!self->http_request->SetContentFromStream(stream))
+		{
+			return PyErr_Format(PyExc_Exception, "unable to set the request content");
+		}
+#else
 		TArray<uint8> data;
-		data.Append((uint8 *)buf, len);
-		self->http_request->SetContent(data);
+		data.Append((uint8 *)py_buf.buf, py_buf.len);
+		PyBuffer_Release(&py_buf);
+		self->http_request->SetContent(MoveTemp(data));
+#endif
+	}
+	else
+	{
+		return PyErr_Format(PyExc_TypeError, "argument is not a string or a buffer");
 	}
 
 	Py_RETURN_NONE;
 }
 
+static PyObject *py_ue_ihttp_request_set_content_from_file(ue_PyIHttpRequest *self, PyObject * args)
+{
+	char *filename;
+	if (!PyArg_ParseTuple(args, "s:set_content_from_file", &filename))
+	{
+		return NULL;
+	}
+
+	// the file is streamed by the http thread, it is never loaded in memory
+	if (!self->http_request->SetContentAsStreamedFile(UTF8_TO_TCHAR(filename)))
+	{
+		return PyErr_Format(PyExc_Exception, "unable to stream file %s", filename);
+	}
+
+	Py_RETURN_NONE;
+}
+
+#if PY_MAJOR_VERSION >= 3 && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+// receives the response body in place of the response content buffer, called by the http thread
+class FUEPyHttpChunkArchive : public FArchive
+{
+public:
+	FUEPyHttpChunkArchive(PyObject *InPyCallable) : PyCallable(InPyCallable), Pos(0)
+	{
+		SetIsSaving(true);
+		Py_INCREF(PyCallable);
+	}
+
+	~FUEPyHttpChunkArchive()
+	{
+		FScopePythonGIL gil;
+		Py_DECREF(PyCallable);
+	}
+
+	virtual void Serialize(void *V, int64 Length) override
+	{
+		if (Length <= 0 || IsError())
+			return;
+
+		FScopePythonGIL gil;
+		// a copy, the memory belongs to the http layer and python can keep references to the chunk
+		PyObject *py_chunk = PyBytes_FromStringAndSize((const char *)V, Length);
+		if (!py_chunk)
+		{
+			unreal_engine_py_log_error();
+			SetError();
+			return;
+		}
+
+		PyObject *ret = PyObject_CallFunctionObjArgs(PyCallable, py_chunk, nullptr);
+		if (!ret)
+		{
+			// aborts the download
+			unreal_engine_py_log_error();
+			SetError();
+		}
+		else
+		{
+			Py_DECREF(ret);
+		}
+
+		Py_DECREF(py_chunk);
+
+		Pos += Length;
+	}
+
+	virtual int64 Tell() override { return Pos; }
+	virtual int64 TotalSize() override { return Pos; }
+	virtual FString GetArchiveName() const override { return TEXT("FUEPyHttpChunkArchive"); }
+
+private:
+	PyObject *PyCallable;
+	int64 Pos;
+};
+#endif
+
+static PyObject *py_ue_ihttp_request_bind_on_content_chunk(ue_PyIHttpRequest *self, PyObject * args)
+{
+	PyObject *py_callable;
+	if (!PyArg_ParseTuple(args, "O:bind_on_content_chunk", &py_callable))
+	{
+		return nullptr;
+	}
+
+	if (!PyCallable_Check(py_callable))
+	{
+		return PyErr_Format(PyExc_Exception, "argument is not a callable");
+	}
+
+#if PY_MAJOR_VERSION >= 3 && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	TSharedRef<FArchive> stream = MakeShareable(new FUEPyHttpChunkArchive(py_callable));
+	if (!self->http_request->SetResponseBodyReceiveStream(stream))
+	{
+		return PyErr_Format(PyExc_Exception, "unable to stream the response body");
+	}
+	Py_RETURN_NONE;
+#else
+	return PyErr_Format(PyExc_Exception, "streaming the response body requires Unreal Engine 5.3");
+#endif
+}
+
 static PyObject *py_ue_ihttp_request_tick(ue_PyIHttpRequest *self, PyObject * args)
 {
 
@@ -112,6 +269,55 @@ static PyObject *py_ue_ihttp_request_process_request(ue_PyIHttpRequest *self, Py
 	Py_RETURN_NONE;
 }
 
+#if PY_MAJOR_VERSION >= 3
+// the returned asyncio future is completed with (request, response, successful),
+// response is None when the connection failed
+static PyObject *py_ue_ihttp_request_process_request_async(ue_PyIHttpRequest *self, PyObject * args)
+{
+	PyObject *py_future = ue_py_asyncio_new_future();
+	if (!py_future)
+		return nullptr;
+
+	TSharedPtr<FUEPyObjectRef> future = MakeShareable(new FUEPyObjectRef(py_future));
+	TSharedPtr<FUEPyObjectRef> request = MakeShareable(new FUEPyObjectRef((PyObject *)self));
+
+	self->http_request->OnProcessRequestComplete().BindLambda([future, request](FHttpRequestPtr http_request, FHttpResponsePtr http_response, bool successful) mutable
+	{
+		if (!future.IsValid())
+			return;
+
+		FScopePythonGIL gil;
+		PyObject *py_response = Py_None;
+		if (http_response.IsValid())
+		{
+			py_response = py_ue_new_ihttp_response(http_response, true);
+		}
+		else
+		{
+			Py_INCREF(py_response);
+		}
+		PyObject *py_result = Py_BuildValue((char *)"(ONO)", request->PyObj, py_response, successful ? Py_True : Py_False);
+		if (!ue_py_asyncio_resolve_future(future->PyObj, py_result, Py_None))
+			unreal_engine_py_log_error();
+		Py_DECREF(py_result);
+
+		// the request owns the delegate, break the cycle
+		future.Reset();
+		request.Reset();
+	});
+	self->on_process_request_complete = nullptr;
+
+	if (!self->http_request->ProcessRequest())
+	{
+		self->http_request->OnProcessRequestComplete().Unbind();
+		Py_DECREF(py_future);
+		return PyErr_Format(PyExc_Exception, "unable to process the HTTP request");
+	}
+
+	return py_future;
+}
+#endif
+
 static PyObject *py_ue_ihttp_request_cancel_request(ue_PyIHttpRequest *self, PyObject * args)
 {
 	self->http_request->CancelRequest();
@@ -141,7 +347,8 @@ static PyObject *py_ue_ihttp_request_get_response(ue_PyIHttpRequest *self, PyObj
 	{
 		return PyErr_Format(PyExc_Exception, "unable to retrieve IHttpResponse");
 	}
-	return py_ue_new_ihttp_response(response.Get());
+	EHttpRequestStatus::Type status = self->http_request->GetStatus();
+	return py_ue_new_ihttp_response(response, status != EHttpRequestStatus::NotStarted && status != EHttpRequestStatus::Processing);
 }
 
 void FPythonSmartHttpDelegate::OnRequestComplete(FHttpRequestPtr request, FHttpResponsePtr response, bool successful)
@@ -154,7 +361,7 @@ void FPythonSmartHttpDelegate::OnRequestComplete(FHttpRequestPtr request, FHttpR
 		return;
 	}
 
-	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"ONO", py_http_request, py_ue_new_ihttp_response(response.Get()), successful ? Py_True : Py_False);
+	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"ONO", py_http_request, py_ue_new_ihttp_response(response, true), successful ? Py_True : Py_False);
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -256,6 +463,7 @@ static PyObject *py_ue_ihttp_request_bind_on_request_progress(ue_PyIHttpRequest
 static PyMethodDef ue_PyIHttpRequest_methods[] = {
 	{ "bind_on_process_request_complete", (PyCFunction)py_ue_ihttp_request_bind_on_process_request_complete, METH_VARARGS, "" },
 	{ "bind_on_request_progress", (PyCFunction)py_ue_ihttp_request_bind_on_request_progress, METH_VARARGS, "" },
+	{ "bind_on_content_chunk", (PyCFunction)py_ue_ihttp_request_bind_on_content_chunk, METH_VARARGS, "" },
 	{ "append_to_header", (PyCFunction)py_ue_ihttp_request_append_to_header, METH_VARARGS, "" },
 	{ "cancel_request", (PyCFunction)py_ue_ihttp_request_cancel_request, METH_VARARGS, "" },
 	{ "get_elapsed_time", (PyCFunction)py_ue_ihttp_request_get_elapsed_time, METH_VARARGS, "" },
@@ -263,7 +471,11 @@ static PyMethodDef ue_PyIHttpRequest_methods[] = {
 	{ "get_status", (PyCFunction)py_ue_ihttp_request_get_status, METH_VARARGS, "" },
 	{ "get_verb", (PyCFunction)py_ue_ihttp_request_get_verb, METH_VARARGS, "" },
 	{ "process_request", (PyCFunction)py_ue_ihttp_request_process_request, METH_VARARGS, "" },
+#if PY_MAJOR_VERSION >= 3
+	{ "process_request_async", (PyCFunction)py_ue_ihttp_request_process_request_async, METH_VARARGS, "" },
+#endif
 	{ "set_content", (PyCFunction)py_ue_ihttp_request_set_content, METH_VARARGS, "" },
+	{ "set_content_from_file", (PyCFunction)py_ue_ihttp_request_set_content_from_file, METH_VARARGS, "" },
 	{ "set_header", (PyCFunction)py_ue_ihttp_request_set_header, METH_VARARGS, "" },
 	{ "set_url", (PyCFunction)py_ue_ihttp_request_set_url, METH_VARARGS, "" },
 	{ "set_verb", (PyCFunction)py_ue_ihttp_request_set_verb, METH_VARARGS, "" },
@@ -366,3 +578,177 @@ void ue_python_init_ihttp_request(PyObject *ue_module)
 	Py_INCREF(&ue_PyIHttpRequestType);
 	PyModule_AddObject(ue_module, "IHttpRequest", (PyObject *)&ue_PyIHttpRequestType);
 }
+
+// native side of process_http_requests(), the python objects are only touched with the GIL
+struct FUEPyHttpRequestBatch
+{
+	TArray<PyObject *> PyRequests;
+	TArray<FHttpResponsePtr> Responses;
+	TArray<bool> Succeeded;
+	FThreadSafeCounter Remaining;
+	PyObject *PyCallback;
+	PyObject *PyFuture;
+
+	~FUEPyHttpRequestBatch()
+	{
+		FScopePythonGIL gil;
+		for (PyObject *py_request : PyRequests)
+		{
+			Py_DECREF(py_request);
+		}
+		Py_XDECREF(PyCallback);
+		Py_XDECREF(PyFuture);
+	}
+
+	// the only moment the GIL is needed once the requests are running
+	void Complete()
+	{
+		FScopePythonGIL gil;
+
+		PyObject *py_results = PyList_New(PyRequests.Num());
+		for (int32 i = 0; i < PyRequests.Num(); i++)
+		{
+			PyObject *py_response = Py_None;
+			if (Responses[i].IsValid())
+			{
+				py_response = py_ue_new_ihttp_response(Responses[i], true);
+			}
+			else
+			{
+				Py_INCREF(py_response);
+			}
+			PyList_SetItem(py_results, i, Py_BuildValue((char *)"(ONO)", PyRequests[i], py_response, Succeeded[i] ? Py_True : Py_False));
+		}
+
+		if (PyCallback)
+		{
+			PyObject *ret = PyObject_CallFunctionObjArgs(PyCallback, py_results, nullptr);
+			if (!ret)
+				unreal_engine_py_log_error();
+			else
+				Py_DECREF(ret);
+		}
+
+#if PY_MAJOR_VERSION >= 3
+		if (PyFuture && !ue_py_asyncio_resolve_future(PyFuture, py_results, Py_None))
+			unreal_engine_py_log_error();
+#endif
+
+		Py_DECREF(py_results);
+	}
+};
+
+PyObject *py_unreal_engine_process_http_requests(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_requests;
+	PyObject *py_callback = nullptr;
+	static char *kw_names[] = { (char *)"requests", (char *)"callback", NULL };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:process_http_requests", kw_names, &py_requests, &py_callback))
+	{
+		return nullptr;
+	}
+
+	if (py_callback == Py_None)
+		py_callback = nullptr;
+
+	if (py_callback && !PyCallable_Check(py_callback))
+		return PyErr_Format(PyExc_TypeError, "callback is not a callable");
+
+	PyObject *py_iter = PyObject_GetIter(py_requests);
+	if (!py_iter)
+		return nullptr;
+
+	TSharedPtr<FUEPyHttpRequestBatch, ESPMode::ThreadSafe> batch = MakeShareable(new FUEPyHttpRequestBatch());
+	batch->PyCallback = nullptr;
+	batch->PyFuture = nullptr;
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		// plain urls are GET requests
+		PyObject *py_request = py_item;
+		if (PyUnicodeOrString_Check(py_item))
+		{
+			py_request = PyObject_CallFunction((PyObject *)&ue_PyIHttpRequestType, (char *)"sO", "GET", py_item);
+			Py_DECREF(py_item);
+			if (!py_request)
+			{
+				Py_DECREF(py_iter);
+				return nullptr;
+			}
+		}
+		else if (!PyObject_IsInstance(py_item, (PyObject *)&ue_PyIHttpRequestType))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_TypeError, "requests must be IHttpRequest objects or urls");
+		}
+		batch->PyRequests.Add(py_request);
+	}
+	Py_DECREF(py_iter);
+
+	if (PyErr_Occurred())
+		return nullptr;
+
+	int32 num_requests = batch->PyRequests.Num();
+	batch->Responses.AddDefaulted(num_requests);
+	batch->Succeeded.AddZeroed(num_requests);
+	batch->Remaining.Set(num_requests);
+
+	PyObject *ret = nullptr;
+	if (py_callback)
+	{
+		Py_INCREF(py_callback);
+		batch->PyCallback = py_callback;
+		Py_INCREF(Py_None);
+		ret = Py_None;
+	}
+	else
+	{
+#if PY_MAJOR_VERSION >= 3
+		ret = ue_py_asyncio_new_future();
+		if (!ret)
+			return nullptr;
+		Py_INCREF(ret);
+		batch->PyFuture = ret;
+#else
+		return PyErr_Format(PyExc_Exception, "a callback is required");
+#endif
+	}
+
+	if (num_requests == 0)
+	{
+		batch->Complete();
+		return ret;
+	}
+
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> http_requests;
+	for (int32 i = 0; i < num_requests; i++)
+	{
+		ue_PyIHttpRequest *py_request = (ue_PyIHttpRequest *)batch->PyRequests[i];
+		py_request->on_process_request_complete = nullptr;
+		// the lambdas drop the batch on completion, so the requests do not keep it alive
+		py_request->http_request->OnProcessRequestComplete().BindLambda([batch, i](FHttpRequestPtr http_request, FHttpResponsePtr http_response, bool successful) mutable
+		{
+			if (!batch.IsValid())
+				return;
+			batch->Responses[i] = http_response;
+			batch->Succeeded[i] = successful;
+			if (batch->Remaining.Decrement() == 0)
+			{
+				batch->Complete();
+			}
+			batch.Reset();
+		});
+		http_requests.Add(py_request->http_request);
+	}
+
+	// the requests start without bouncing on the GIL
+	Py_BEGIN_ALLOW_THREADS;
+	for (TSharedRef<IHttpRequest, ESPMode::ThreadSafe> &http_request : http_requests)
+	{
+		http_request->ProcessRequest();
+	}
+	Py_END_ALLOW_THREADS;
+
+	return ret;
+}
@@ -44,4 +44,7 @@ protected:
 
 
 
-void ue_python_init_ihttp_request(PyObject *);
\ No newline at end of file
+void ue_python_init_ihttp_request(PyObject *);
+
+// issues all of the requests and gathers the (request, response, successful) tuples with a single GIL hand-off
+PyObject *py_unreal_engine_process_http_requests(PyObject *, PyObject *, PyObject *);
@@ -13,9 +13,16 @@ static PyObject *py_ue_ihttp_response_get_content_as_string(ue_PyIHttpResponse *
 	return PyUnicode_FromString(TCHAR_TO_UTF8(*self->http_response->GetContentAsString()));
 }
 
+// zero-copy view of the body, valid as long as the view (that keeps the response alive)
+static PyObject *py_ue_ihttp_response_get_content_view(ue_PyIHttpResponse *self, PyObject * args)
+{
+	return PyMemoryView_FromObject((PyObject *)self);
+}
+
 static PyMethodDef ue_PyIHttpResponse_methods[] = {
 		{ "get_response_code", (PyCFunction)py_ue_ihttp_response_get_response_code, METH_VARARGS, "" },
 		{ "get_content_as_string", (PyCFunction)py_ue_ihttp_response_get_content_as_string, METH_VARARGS, "" },
+		{ "get_content_view", (PyCFunction)py_ue_ihttp_response_get_content_view, METH_VARARGS, "" },
 		{ NULL }  /* Sentinel */
 };
 
@@ -26,12 +33,33 @@ static PyObject *ue_PyIHttpResponse_str(ue_PyIHttpResponse *self)
 		self->http_response);
 }
 
+static int ue_PyIHttpResponse_getbuffer(ue_PyIHttpResponse *self, Py_buffer *view, int flags)
+{
+	if (!self->content_complete)
+	{
+		PyErr_SetString(PyExc_BufferError, "the response content is still being received");
+		view->obj = nullptr;
+		return -1;
+	}
+
+	const TArray<uint8> &content = self->http_response->GetContent();
+	return PyBuffer_FillInfo(view, (PyObject *)self, (void *)content.GetData(), content.Num(), 1, flags);
+}
+
+static PyBufferProcs ue_PyIHttpResponse_buffer_procs;
+
+static void ue_PyIHttpResponse_dealloc(ue_PyIHttpResponse *self)
+{
+	self->http_response_ptr.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
 static PyTypeObject ue_PyIHttpResponseType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.IHttpResponse", /* tp_name */
 	sizeof(ue_PyIHttpResponse), /* tp_basicsize */
 	0,                         /* tp_itemsize */
-	0,       /* tp_dealloc */
+	(destructor)ue_PyIHttpResponse_dealloc,       /* tp_dealloc */
 	0,                         /* tp_print */
 	0,                         /* tp_getattr */
 	0,                         /* tp_setattr */
@@ -65,6 +93,10 @@ void ue_python_init_ihttp_response(PyObject *ue_module)
 
 	ue_PyIHttpResponseType.tp_base = &ue_PyIHttpBaseType;
 
+	memset(&ue_PyIHttpResponse_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyIHttpResponse_buffer_procs.bf_getbuffer = (getbufferproc)ue_PyIHttpResponse_getbuffer;
+	ue_PyIHttpResponseType.tp_as_buffer = &ue_PyIHttpResponse_buffer_procs;
+
 	if (PyType_Ready(&ue_PyIHttpResponseType) < 0)
 		return;
 
@@ -72,10 +104,12 @@ void ue_python_init_ihttp_response(PyObject *ue_module)
 	PyModule_AddObject(ue_module, "IHttpResponse", (PyObject *)&ue_PyIHttpResponseType);
 }
 
-PyObject *py_ue_new_ihttp_response(IHttpResponse *response)
+PyObject *py_ue_new_ihttp_response(FHttpResponsePtr response, bool content_complete)
 {
 	ue_PyIHttpResponse *ret = (ue_PyIHttpResponse *)PyObject_New(ue_PyIHttpResponse, &ue_PyIHttpResponseType);
-	ret->http_response = response;
-	ret->base.http_base = response;
+	ret->http_response = response.Get();
+	new(&ret->http_response_ptr) FHttpResponsePtr(response);
+	ret->content_complete = content_complete;
+	ret->base.http_base = response.Get();
 	return (PyObject *)ret;
 }
\ No newline at end of file
@@ -14,8 +14,12 @@ typedef struct
 	ue_PyIHttpBase base;
 	/* Type-specific fields go here. */
 	IHttpResponse *http_response;
+	// keeps the response (and its content buffer) alive
+	FHttpResponsePtr http_response_ptr;
+	// the content is exposed via the buffer protocol only when it cannot grow anymore
+	bool content_complete;
 } ue_PyIHttpResponse;
 
 
 void ue_python_init_ihttp_response(PyObject *);
-PyObject *py_ue_new_ihttp_response(IHttpResponse *);
\ No newline at end of file
+PyObject *py_ue_new_ihttp_response(FHttpResponsePtr, bool content_complete);
\ No newline at end of file
@@ -2,12 +2,17 @@
 
 #include "PyActor.h"
 #include "UEPyModule.h"
+#include "UEPyTickScheduler.h"
 
 APyActor::APyActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
 	PythonTickForceDisabled = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLowPriority = false;
+	bPythonTickScheduled = false;
 	PythonDisableAutoBinding = false;
 
 }
@@ -124,6 +129,11 @@ void APyActor::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled && PyObject_HasAttrString(py_actor_instance, (char *)"tick"))
+	{
+		bPythonTickScheduled = FUnrealEnginePythonTickScheduler::Get()->Register(this, &PrimaryActorTick, py_actor_instance, PrimaryActorTick.TickGroup, PythonTickInterval, PythonTickLowPriority);
+	}
+
 	if (!PyObject_HasAttrString(py_actor_instance, (char *)"begin_play"))
 		return;
 
@@ -143,7 +153,7 @@ void APyActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (!py_actor_instance)
+	if (!py_actor_instance || bPythonTickScheduled)
 		return;
 
 	FScopePythonGIL gil;
@@ -168,6 +178,12 @@ void APyActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (bPythonTickScheduled)
+	{
+		FUnrealEnginePythonTickScheduler::Get()->Unregister(this);
+		bPythonTickScheduled = false;
+	}
+
 	if (PyObject_HasAttrString(py_actor_instance, (char *)"end_play"))
 	{
 		PyObject *ep_ret = PyObject_CallMethod(py_actor_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
@@ -2,6 +2,7 @@
 
 #include "PyCharacter.h"
 #include "UEPyModule.h"
+#include "UEPyTickScheduler.h"
 #include "Components/InputComponent.h"
 
 APyCharacter::APyCharacter()
@@ -9,6 +10,10 @@ APyCharacter::APyCharacter()
 	PrimaryActorTick.bCanEverTick = true;
 
 	PythonTickForceDisabled = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLowPriority = false;
+	bPythonTickScheduled = false;
 	PythonDisableAutoBinding = false;
 
 }
@@ -131,6 +136,11 @@ void APyCharacter::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled && PyObject_HasAttrString(py_character_instance, (char *)"tick"))
+	{
+		bPythonTickScheduled = FUnrealEnginePythonTickScheduler::Get()->Register(this, &PrimaryActorTick, py_character_instance, PrimaryActorTick.TickGroup, PythonTickInterval, PythonTickLowPriority);
+	}
+
 	if (!PyObject_HasAttrString(py_character_instance, (char *)"begin_play"))
 		return;
 
@@ -151,7 +161,7 @@ void APyCharacter::Tick(float DeltaTime)
 
 	Super::Tick(DeltaTime);
 
-	if (!py_character_instance)
+	if (!py_character_instance || bPythonTickScheduled)
 		return;
 
 	FScopePythonGIL gil;
@@ -458,6 +468,12 @@ void APyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (bPythonTickScheduled)
+	{
+		FUnrealEnginePythonTickScheduler::Get()->Unregister(this);
+		bPythonTickScheduled = false;
+	}
+
 	if (PyObject_HasAttrString(py_character_instance, (char *)"end_play"))
 	{
 		PyObject *ep_ret = PyObject_CallMethod(py_character_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
@@ -1,12 +1,17 @@
 
 #include "PyPawn.h"
 #include "UEPyModule.h"
+#include "UEPyTickScheduler.h"
 
 APyPawn::APyPawn()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
 	PythonTickForceDisabled = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLowPriority = false;
+	bPythonTickScheduled = false;
 	PythonDisableAutoBinding = false;
 	
 }
@@ -115,6 +120,11 @@ void APyPawn::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled && PyObject_HasAttrString(py_pawn_instance, (char *)"tick"))
+	{
+		bPythonTickScheduled = FUnrealEnginePythonTickScheduler::Get()->Register(this, &PrimaryActorTick, py_pawn_instance, PrimaryActorTick.TickGroup, PythonTickInterval, PythonTickLowPriority);
+	}
+
 	if (!PyObject_HasAttrString(py_pawn_instance, (char *)"begin_play"))
 		return;
 
@@ -131,7 +141,7 @@ void APyPawn::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (!py_pawn_instance)
+	if (!py_pawn_instance || bPythonTickScheduled)
 		return;
 
 	FScopePythonGIL gil;
@@ -153,6 +163,12 @@ void APyPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (bPythonTickScheduled)
+	{
+		FUnrealEnginePythonTickScheduler::Get()->Unregister(this);
+		bPythonTickScheduled = false;
+	}
+
 	if (PyObject_HasAttrString(py_pawn_instance, (char *)"end_play")) {
 		PyObject *ep_ret = PyObject_CallMethod(py_pawn_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
 
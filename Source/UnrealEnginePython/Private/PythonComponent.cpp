@@ -1,6 +1,7 @@
 
 #include "PythonComponent.h"
 #include "UEPyModule.h"
+#include "UEPyTickScheduler.h"
 
 UPythonComponent::UPythonComponent()
 {
@@ -12,6 +13,10 @@ UPythonComponent::UPythonComponent()
 	PrimaryComponentTick.bCanEverTick = true;
 
 	PythonTickForceDisabled = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLowPriority = false;
+	bPythonTickScheduled = false;
 	PythonDisableAutoBinding = false;
 	PythonTickEnableGenerator = false;
 
@@ -118,6 +123,11 @@ void UPythonComponent::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled && !PythonTickEnableGenerator && PyObject_HasAttrString(py_component_instance, (char *)"tick"))
+	{
+		bPythonTickScheduled = FUnrealEnginePythonTickScheduler::Get()->Register(this, &PrimaryComponentTick, py_component_instance, PrimaryComponentTick.TickGroup, PythonTickInterval, PythonTickLowPriority);
+	}
+
 	if (!PyObject_HasAttrString(py_component_instance, (char *)"begin_play"))
 	{
 		return;
@@ -139,6 +149,12 @@ void UPythonComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (bPythonTickScheduled)
+	{
+		FUnrealEnginePythonTickScheduler::Get()->Unregister(this);
+		bPythonTickScheduled = false;
+	}
+
 	if (PyObject_HasAttrString(py_component_instance, (char *)"end_play"))
 	{
 		PyObject *ep_ret = PyObject_CallMethod(py_component_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
@@ -161,7 +177,7 @@ void UPythonComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!py_component_instance)
+	if (!py_component_instance || bPythonTickScheduled)
 		return;
 
 	FScopePythonGIL gil;
@@ -1,7 +1,15 @@
-
 #include "PythonFunction.h"
 #include "UEPyModule.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("UnrealEnginePython"), STATGROUP_UnrealEnginePython, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Python Function Calls"), STAT_PythonFunctionCalls, STATGROUP_UnrealEnginePython);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Python Function Marshal (ms)"), STAT_PythonFunctionMarshalTime, STATGROUP_UnrealEnginePython);
 
+// totals for get_python_function_stats(), protected by the GIL
+static uint64 PythonFunctionCalls = 0;
+static uint64 PythonFunctionMarshalCycles = 0;
+static uint64 PythonFunctionTupleReuses = 0;
 
 void UPythonFunction::SetPyCallable(PyObject *callable)
 {
@@ -9,6 +17,41 @@ void UPythonFunction::SetPyCallable(PyObject *callable)
 	Py_INCREF(py_callable);
 }
 
+FPythonFunctionSignature &UPythonFunction::GetSignature()
+{
+	if (!bSignatureCached)
+	{
+		Signature.bIsStatic = HasAnyFunctionFlags(FUNC_Static);
+		Signature.ReturnProperty = nullptr;
+		Signature.PyArgs = nullptr;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+		for (TFieldIterator<FProperty> It(this); It && (It->PropertyFlags & CPF_Parm); ++It)
+		{
+			FProperty *prop = *It;
+#else
+		for (TFieldIterator<UProperty> It(this); It && (It->PropertyFlags & CPF_Parm); ++It)
+		{
+			UProperty *prop = *It;
+#endif
+			if (prop->PropertyFlags & CPF_ReturnParm)
+			{
+				Signature.ReturnProperty = prop;
+				continue;
+			}
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+			// resolve the converter now, not in the middle of the first call
+			ue_py_get_property_kind(prop);
+#endif
+			Signature.Params.Add(prop);
+			if (!prop->HasAnyPropertyFlags(CPF_IsPlainOldData | CPF_NoDestructor))
+			{
+				Signature.DestroyParams.Add(prop);
+			}
+		}
+		bSignatureCached = true;
+	}
+	return Signature;
+}
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 18)
 void UPythonFunction::CallPythonCallable(UObject *Context, FFrame& Stack, RESULT_DECL)
@@ -19,32 +62,35 @@ void UPythonFunction::CallPythonCallable(FFrame& Stack, RESULT_DECL)
 
 	FScopePythonGIL gil;
 
+	uint32 marshal_start = FPlatformTime::Cycles();
+
 #if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 18))
 	UObject *Context = Stack.Object;
 #endif
 
 	UPythonFunction *function = static_cast<UPythonFunction *>(Stack.CurrentNativeFunction);
+	FPythonFunctionSignature &signature = function->GetSignature();
 
 	bool on_error = false;
-	bool is_static = function->HasAnyFunctionFlags(FUNC_Static);
+	bool has_self = Context && !signature.bIsStatic;
 
-	// count the number of arguments
-	Py_ssize_t argn = (Context && !is_static) ? 1 : 0;
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
-	TFieldIterator<FProperty> IArgs(function);
-#else
-	TFieldIterator<UProperty> IArgs(function);
-#endif
-	for (; IArgs && ((IArgs->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm); ++IArgs) {
-		argn++;
-	}
+	Py_ssize_t argn = signature.Params.Num() + (has_self ? 1 : 0);
 #if defined(UEPY_MEMORY_DEBUG)
 	UE_LOG(LogPython, Warning, TEXT("Initializing %d parameters"), argn);
 #endif
-	PyObject *py_args = PyTuple_New(argn);
-	argn = 0;
 
-	if (Context && !is_static) {
+	// new references, released after the call
+	PyObject *small_args[UEPY_PYTHON_FUNCTION_SMALL_ARITY];
+	TArray<PyObject *> big_args;
+	PyObject **args = small_args;
+	if (argn > UEPY_PYTHON_FUNCTION_SMALL_ARITY)
+	{
+		big_args.AddZeroed(argn);
+		args = big_args.GetData();
+	}
+	Py_ssize_t converted = 0;
+
+	if (has_self) {
 		PyObject *py_obj = (PyObject *)ue_get_python_uobject(Context);
 		if (!py_obj) {
 			unreal_engine_py_log_error();
@@ -52,35 +98,15 @@ void UPythonFunction::CallPythonCallable(FFrame& Stack, RESULT_DECL)
 		}
 		else {
 			Py_INCREF(py_obj);
-			PyTuple_SetItem(py_args, argn++, py_obj);
+			args[converted++] = py_obj;
 		}
 	}
 
 	uint8 *frame = Stack.Locals;
+	bool is_blueprint_call = *Stack.Code != EX_EndFunctionParms;
 
-	// is it a blueprint call ?
-	if (*Stack.Code == EX_EndFunctionParms) {
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
-		for (FProperty *prop = (FProperty *)function->ChildProperties; prop; prop = (FProperty *)prop->Next) {
-#else
-		for (UProperty *prop = (UProperty *)function->Children; prop; prop = (UProperty *)prop->Next) {
-#endif
-			if (prop->PropertyFlags & CPF_ReturnParm)
-				continue;
-			if (!on_error) {
-				PyObject *arg = ue_py_convert_property(prop, (uint8 *)Stack.Locals, 0);
-				if (!arg) {
-					unreal_engine_py_log_error();
-					on_error = true;
-				}
-				else {
-					PyTuple_SetItem(py_args, argn++, arg);
-				}
-			}
-		}
-	}
-	else {
-		//UE_LOG(LogPython, Warning, TEXT("BLUEPRINT CALL"));
+	if (is_blueprint_call) {
+		// parameters are evaluated from the script bytecode into a temporary frame
 		frame = (uint8 *)FMemory_Alloca(function->PropertiesSize);
 		FMemory::Memzero(frame, function->PropertiesSize);
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
@@ -89,62 +115,132 @@ void UPythonFunction::CallPythonCallable(FFrame& Stack, RESULT_DECL)
 		for (UProperty *prop = (UProperty *)function->Children; *Stack.Code != EX_EndFunctionParms; prop = (UProperty *)prop->Next) {
 #endif
 			Stack.Step(Stack.Object, prop->ContainerPtrToValuePtr<uint8>(frame));
-			if (prop->PropertyFlags & CPF_ReturnParm)
-				continue;
-			if (!on_error) {
-				PyObject *arg = ue_py_convert_property(prop, frame, 0);
-				if (!arg) {
-					unreal_engine_py_log_error();
-					on_error = true;
-				}
-				else {
-					PyTuple_SetItem(py_args, argn++, arg);
-				}
-			}
 		}
 	}
 
 	Stack.Code++;
 
-	if (on_error || !function->py_callable) {
-		Py_DECREF(py_args);
-		return;
-	}
-
-	PyObject *ret = PyObject_CallObject(function->py_callable, py_args);
-	Py_DECREF(py_args);
-	if (!ret) {
-		unreal_engine_py_log_error();
-		return;
+	for (int32 i = 0; i < signature.Params.Num() && !on_error; i++) {
+		PyObject *arg = ue_py_convert_property(signature.Params[i], frame, 0);
+		if (!arg) {
+			unreal_engine_py_log_error();
+			on_error = true;
+		}
+		else {
+			args[converted++] = arg;
+		}
 	}
 
-	// get return value (if required)
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
-	FProperty *return_property = function->GetReturnProperty();
+	PyObject *ret = nullptr;
+	if (!on_error && function->py_callable) {
+		uint32 marshal_cycles = FPlatformTime::Cycles() - marshal_start;
+#if PY_VERSION_HEX >= 0x03090000
+		ret = PyObject_Vectorcall(function->py_callable, args, argn, nullptr);
 #else
-	UProperty *return_property = function->GetReturnProperty();
+		PyObject *py_args = nullptr;
+		if (signature.PyArgs && PyTuple_GET_SIZE(signature.PyArgs) == argn) {
+			// take it, a recursive call will allocate its own tuple
+			py_args = signature.PyArgs;
+			signature.PyArgs = nullptr;
+			PythonFunctionTupleReuses++;
+		}
+		else {
+			py_args = PyTuple_New(argn);
+		}
+		// the tuple steals the references
+		for (Py_ssize_t i = 0; i < argn; i++) {
+			PyTuple_SET_ITEM(py_args, i, args[i]);
+		}
+		converted = 0;
+
+		ret = PyObject_Call(function->py_callable, py_args, nullptr);
+
+		// keep the tuple for the next call only if the callable did not retain it
+		if (argn > 0 && argn <= UEPY_PYTHON_FUNCTION_SMALL_ARITY && Py_REFCNT(py_args) == 1 && !signature.PyArgs) {
+			for (Py_ssize_t i = 0; i < argn; i++) {
+				PyObject *item = PyTuple_GET_ITEM(py_args, i);
+				PyTuple_SET_ITEM(py_args, i, nullptr);
+				Py_DECREF(item);
+			}
+			signature.PyArgs = py_args;
+		}
+		else {
+			Py_DECREF(py_args);
+		}
 #endif
-	if (return_property && function->ReturnValueOffset != MAX_uint16) {
+		marshal_start = FPlatformTime::Cycles();
+
+		if (!ret) {
+			unreal_engine_py_log_error();
+		}
+		// get return value (if required)
+		else if (signature.ReturnProperty && function->ReturnValueOffset != MAX_uint16) {
 #if defined(UEPY_MEMORY_DEBUG)
-		UE_LOG(LogPython, Warning, TEXT("FOUND RETURN VALUE"));
+			UE_LOG(LogPython, Warning, TEXT("FOUND RETURN VALUE"));
 #endif
-		if (ue_py_convert_pyobject(ret, return_property, frame, 0)) {
-			// copy value to stack result value
-			FMemory::Memcpy(RESULT_PARAM, frame + function->ReturnValueOffset, return_property->ArrayDim * return_property->ElementSize);
+			if (ue_py_convert_pyobject(ret, signature.ReturnProperty, frame, 0)) {
+				// copy value to stack result value
+				FMemory::Memcpy(RESULT_PARAM, frame + function->ReturnValueOffset, signature.ReturnProperty->ArrayDim * signature.ReturnProperty->ElementSize);
+			}
+			else {
+				UE_LOG(LogPython, Error, TEXT("Invalid return value type for function %s"), *function->GetFName().ToString());
+			}
 		}
-		else {
-			UE_LOG(LogPython, Error, TEXT("Invalid return value type for function %s"), *function->GetFName().ToString());
+		Py_XDECREF(ret);
+
+		marshal_cycles += FPlatformTime::Cycles() - marshal_start;
+		PythonFunctionCalls++;
+		PythonFunctionMarshalCycles += marshal_cycles;
+		INC_DWORD_STAT(STAT_PythonFunctionCalls);
+		INC_FLOAT_STAT_BY(STAT_PythonFunctionMarshalTime, FPlatformTime::ToMilliseconds(marshal_cycles));
+	}
+
+	for (Py_ssize_t i = 0; i < converted; i++) {
+		Py_DECREF(args[i]);
+	}
+
+	if (is_blueprint_call) {
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+		for (FProperty *prop : signature.DestroyParams) {
+#else
+		for (UProperty *prop : signature.DestroyParams) {
+#endif
+			prop->DestroyValue_InContainer(frame);
 		}
 	}
-	Py_DECREF(ret);
 }
 
 UPythonFunction::~UPythonFunction()
 {
 	FScopePythonGIL gil;
 	Py_XDECREF(py_callable);
+	Py_XDECREF(Signature.PyArgs);
 	FUnrealEnginePythonHouseKeeper::Get()->UnregisterPyUObject(this);
 #if defined(UEPY_MEMORY_DEBUG)
 	UE_LOG(LogPython, Warning, TEXT("PythonFunction callable %p XDECREF'ed"), this);
 #endif
 }
+
+PyObject *py_unreal_engine_get_python_function_stats(PyObject * self, PyObject * args)
+{
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromUnsignedLongLong(PythonFunctionCalls);
+	PyDict_SetItemString(py_stats, "calls", py_value);
+	Py_DECREF(py_value);
+
+	double marshal_time = FPlatformTime::GetSecondsPerCycle() * PythonFunctionMarshalCycles;
+	py_value = PyFloat_FromDouble(marshal_time);
+	PyDict_SetItemString(py_stats, "marshal_time", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(PythonFunctionCalls > 0 ? marshal_time / PythonFunctionCalls : 0);
+	PyDict_SetItemString(py_stats, "mean_marshal_time", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(PythonFunctionTupleReuses);
+	PyDict_SetItemString(py_stats, "tuple_reuses", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
@@ -1,9 +1,16 @@
 
 #include "PythonHouseKeeper.h"
+#include "Misc/ScopeLock.h"
+#include "UEPyUScriptStruct.h"
 
 void FUnrealEnginePythonHouseKeeper::AddReferencedObjects(FReferenceCollector& InCollector)
 {
     InCollector.AddReferencedObjects(PythonTrackedObjects);
+    InCollector.AddReferencedObjects(PythonPinnedObjects);
+}
+
+FUnrealEnginePythonHouseKeeper::FUnrealEnginePythonHouseKeeper() : Reclaimed(0), Sweeps(0), LastSweepTime(0), TotalSweepTime(0), RegistryNum(0), bListening(false)
+{
 }
 
 FUnrealEnginePythonHouseKeeper *FUnrealEnginePythonHouseKeeper::Get()
@@ -12,6 +19,9 @@ FUnrealEnginePythonHouseKeeper *FUnrealEnginePythonHouseKeeper::Get()
     if (!Singleton)
     {
         Singleton = new FUnrealEnginePythonHouseKeeper();
+        // wrappers are detached as soon as their UObject is destroyed
+        GUObjectArray.AddUObjectDeleteListener(Singleton);
+        Singleton->bListening = true;
         // register a new delegate for the GC
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
         FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(Singleton, &FUnrealEnginePythonHouseKeeper::RunGCDelegate);
@@ -32,16 +42,85 @@ int32 FUnrealEnginePythonHouseKeeper::RunGC()
 {
     int32 Garbaged = PyUObjectsGC();
     Garbaged += DelegatesGC();
+    ue_py_uscriptstruct_freelists_sweep();
     return Garbaged;
 }
 
+FUnrealEnginePythonHouseKeeper::FPythonUOjectTracker *FUnrealEnginePythonHouseKeeper::FindTracker(int32 Index) const
+{
+    if (Index < 0)
+        return nullptr;
+    int32 Chunk = Index / RegistryChunkSize;
+    if (Chunk >= RegistryChunks.Num() || !RegistryChunks[Chunk])
+        return nullptr;
+    FPythonUOjectTracker *Tracker = &RegistryChunks[Chunk][Index % RegistryChunkSize];
+    if (!Tracker->PyUObject)
+        return nullptr;
+    return Tracker;
+}
+
+FUnrealEnginePythonHouseKeeper::FPythonUOjectTracker *FUnrealEnginePythonHouseKeeper::FindOrAddTracker(int32 Index)
+{
+    int32 Chunk = Index / RegistryChunkSize;
+    if (Chunk >= RegistryChunks.Num())
+    {
+        RegistryChunks.AddZeroed(Chunk + 1 - RegistryChunks.Num());
+    }
+    if (!RegistryChunks[Chunk])
+    {
+        RegistryChunks[Chunk] = new FPythonUOjectTracker[RegistryChunkSize];
+    }
+    return &RegistryChunks[Chunk][Index % RegistryChunkSize];
+}
+
+// detach the wrapper from its (dead) UObject and empty the slot, requires the RegistryLock
+void FUnrealEnginePythonHouseKeeper::ReleaseTracker(FPythonUOjectTracker *Tracker)
+{
+    Tracker->PyUObject->ue_object = nullptr;
+    if (!Tracker->bPythonOwned)
+        PendingReleases.Add(Tracker->PyUObject);
+    *Tracker = FPythonUOjectTracker();
+    RegistryNum--;
+    Reclaimed++;
+}
+
+void FUnrealEnginePythonHouseKeeper::NotifyUObjectDeleted(const UObjectBase *Object, int32 Index)
+{
+    ue_py_uscriptstruct_freelists_notify_deleted(Object);
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(Index);
+    if (!Tracker)
+        return;
+#if defined(UEPY_MEMORY_DEBUG)
+    UE_LOG(LogPython, Warning, TEXT("Detaching UObject at %p (refcnt: %d)"), Object, Tracker->PyUObject->ob_base.ob_refcnt);
+#endif
+    // no python api here, we could be out of the game thread without the GIL
+    ReleaseTracker(Tracker);
+}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 23)
+void FUnrealEnginePythonHouseKeeper::OnUObjectArrayShutdown()
+{
+    if (bListening)
+    {
+        GUObjectArray.RemoveUObjectDeleteListener(this);
+        bListening = false;
+    }
+}
+#endif
+
 bool FUnrealEnginePythonHouseKeeper::IsValidPyUObject(ue_PyUObject *PyUObject)
 {
     if (!PyUObject)
         return false;
 
+    // wrappers of destroyed UObjects have been detached by NotifyUObjectDeleted()
     UObject *Object = PyUObject->ue_object;
-    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
+    if (!Object)
+        return false;
+
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
     if (!Tracker)
     {
         return false;
@@ -56,7 +135,8 @@ bool FUnrealEnginePythonHouseKeeper::IsValidPyUObject(ue_PyUObject *PyUObject)
 
 void FUnrealEnginePythonHouseKeeper::TrackUObject(UObject *Object)
 {
-    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
     if (!Tracker)
     {
         return;
@@ -72,77 +152,121 @@ void FUnrealEnginePythonHouseKeeper::TrackUObject(UObject *Object)
 
 void FUnrealEnginePythonHouseKeeper::UntrackUObject(UObject *Object)
 {
+    if (!Object)
+        return;
+    PythonTrackedObjects.Remove(Object);
+    // the python owned wrapper is going away, do not leave a dangling slot
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
+    if (Tracker && Tracker->bPythonOwned)
+    {
+        *Tracker = FPythonUOjectTracker();
+        RegistryNum--;
+    }
+}
+
+void FUnrealEnginePythonHouseKeeper::DisownUObject(UObject *Object)
+{
+    if (!Object)
+        return;
     PythonTrackedObjects.Remove(Object);
+    // the slot keeps pointing to the wrapper, so the UObject is still mapped to a single wrapper
+    // and the delete listener will detach (and release) it
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
+    if (Tracker)
+        Tracker->bPythonOwned = false;
+}
+
+void FUnrealEnginePythonHouseKeeper::PinUObject(UObject *Object)
+{
+    PythonPinnedObjects.Add(Object);
+}
+
+void FUnrealEnginePythonHouseKeeper::UnpinUObject(UObject *Object)
+{
+    PythonPinnedObjects.RemoveSingleSwap(Object);
 }
 
 void FUnrealEnginePythonHouseKeeper::RegisterPyUObject(UObject *Object, ue_PyUObject *InPyUObject)
 {
-    UObjectPyMapping.Add(Object, FPythonUOjectTracker(Object, InPyUObject));
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindOrAddTracker(GUObjectArray.ObjectToIndex(Object));
+    if (Tracker->PyUObject)
+    {
+        if (Tracker->PyUObject == InPyUObject)
+            return;
+        // the previous wrapper is replaced, release it like a dead one
+        ReleaseTracker(Tracker);
+    }
+    *Tracker = FPythonUOjectTracker(Object, InPyUObject);
+    RegistryNum++;
 }
 
 void FUnrealEnginePythonHouseKeeper::UnregisterPyUObject(UObject *Object)
 {
-    UObjectPyMapping.Remove(Object);
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
+    if (!Tracker)
+        return;
+    // the UObject is going to be destroyed, python references to the wrapper will be invalid
+    Tracker->PyUObject->ue_object = nullptr;
+    *Tracker = FPythonUOjectTracker();
+    RegistryNum--;
 }
 
 ue_PyUObject *FUnrealEnginePythonHouseKeeper::GetPyUObject(UObject *Object)
 {
-    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
+    // the delete listener could empty the slot from the async purge thread
+    FScopeLock Lock(&RegistryLock);
+    FPythonUOjectTracker *Tracker = FindTracker(GUObjectArray.ObjectToIndex(Object));
     if (!Tracker)
     {
         return nullptr;
     }
 
+    // a different serial number means the slot has been recycled
     if (!Tracker->Owner.IsValid(true))
     {
 #if defined(UEPY_MEMORY_DEBUG)
         UE_LOG(LogPython, Warning, TEXT("DEFREF'ing UObject at %p (refcnt: %d)"), Object, Tracker->PyUObject->ob_base.ob_refcnt);
 #endif
-        if (!Tracker->bPythonOwned)
-            Py_DECREF((PyObject *)Tracker->PyUObject);
-        UnregisterPyUObject(Object);
+        ReleaseTracker(Tracker);
         return nullptr;
-}
+    }
 
     return Tracker->PyUObject;
 }
 
+// release the wrappers detached by the delete listener, only the dead entries are visited
 uint32 FUnrealEnginePythonHouseKeeper::PyUObjectsGC()
 {
-    uint32 Garbaged = 0;
-    TArray<UObject *> BrokenList;
-    for (auto &UObjectPyItem : UObjectPyMapping)
+    if (PendingReleases.Num() == 0)
+        return 0;
+
+    double StartTime = FPlatformTime::Seconds();
+
+    TArray<ue_PyUObject *> BrokenList;
     {
-        UObject *Object = UObjectPyItem.Key;
-        FPythonUOjectTracker &Tracker = UObjectPyItem.Value;
-#if defined(UEPY_MEMORY_DEBUG)
-        UE_LOG(LogPython, Warning, TEXT("Checking for UObject at %p"), Object);
-#endif
-        if (!Tracker.Owner.IsValid(true))
-        {
-#if defined(UEPY_MEMORY_DEBUG)
-            UE_LOG(LogPython, Warning, TEXT("Removing UObject at %p (refcnt: %d)"), Object, Tracker.PyUObject->ob_base.ob_refcnt);
-#endif
-            BrokenList.Add(Object);
-            Garbaged++;
+        FScopeLock Lock(&RegistryLock);
+        BrokenList = MoveTemp(PendingReleases);
+        PendingReleases.Reset();
     }
-        else
-        {
+
+    // DECREF'ing could run python code (and register new wrappers), so it is done out of the lock
+    for (ue_PyUObject *PyUObject : BrokenList)
+    {
 #if defined(UEPY_MEMORY_DEBUG)
-            UE_LOG(LogPython, Error, TEXT("UObject at %p %s is in use"), Object, *Object->GetName());
+        UE_LOG(LogPython, Warning, TEXT("Removing ue_PyUObject at %p (refcnt: %d)"), PyUObject, PyUObject->ob_base.ob_refcnt);
 #endif
-}
+        Py_DECREF((PyObject *)PyUObject);
     }
 
-    for (UObject *Object : BrokenList)
-    {
-        FPythonUOjectTracker &Tracker = UObjectPyMapping[Object];
-        if (!Tracker.bPythonOwned)
-            Py_DECREF((PyObject *)Tracker.PyUObject);
-        UnregisterPyUObject(Object);
-    }
+    LastSweepTime = FPlatformTime::Seconds() - StartTime;
+    TotalSweepTime += LastSweepTime;
+    Sweeps++;
 
-    return Garbaged;
+    return BrokenList.Num();
 
 }
 
@@ -0,0 +1,1315 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyAsyncio.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+#include "Engine/LatentActionManager.h"
+#include "PythonDelegate.h"
+#include "UEPyUScriptStruct.h"
+#include "Wrappers/UEPyFGraphEvent.h"
+
+// asyncio is imported on first use, not at plugin startup
+static PyObject *ue_py_asyncio_module = nullptr;
+static PyObject *ue_py_asyncio_handle_type = nullptr;
+static PyObject *ue_py_asyncio_timer_handle_type = nullptr;
+static PyObject *ue_py_asyncio_future_type = nullptr;
+static PyObject *ue_py_asyncio_task_type = nullptr;
+static PyObject *ue_py_asyncio_get_running_loop = nullptr;
+static PyObject *ue_py_asyncio_set_running_loop = nullptr;
+// unreal_engine.UnrealEventLoop, a subclass of the native loop and of asyncio.AbstractEventLoop
+static PyObject *ue_py_event_loop_class = nullptr;
+static PyObject *ue_py_default_event_loop = nullptr;
+static PyObject *ue_py_asyncio_set_future_callable = nullptr;
+
+extern PyTypeObject ue_PyUnrealEventLoopBaseType;
+
+static bool ue_py_asyncio_import()
+{
+	if (ue_py_event_loop_class)
+		return true;
+
+	PyObject *py_asyncio = PyImport_ImportModule("asyncio");
+	if (!py_asyncio)
+		return false;
+
+	PyObject *py_abstract_loop = PyObject_GetAttrString(py_asyncio, "AbstractEventLoop");
+	ue_py_asyncio_handle_type = PyObject_GetAttrString(py_asyncio, "Handle");
+	ue_py_asyncio_timer_handle_type = PyObject_GetAttrString(py_asyncio, "TimerHandle");
+	ue_py_asyncio_future_type = PyObject_GetAttrString(py_asyncio, "Future");
+	ue_py_asyncio_task_type = PyObject_GetAttrString(py_asyncio, "Task");
+	ue_py_asyncio_get_running_loop = PyObject_GetAttrString(py_asyncio, "_get_running_loop");
+	ue_py_asyncio_set_running_loop = PyObject_GetAttrString(py_asyncio, "_set_running_loop");
+
+	if (!py_abstract_loop || !ue_py_asyncio_handle_type || !ue_py_asyncio_timer_handle_type || !ue_py_asyncio_future_type ||
+		!ue_py_asyncio_task_type || !ue_py_asyncio_get_running_loop || !ue_py_asyncio_set_running_loop)
+	{
+		Py_XDECREF(py_abstract_loop);
+		Py_CLEAR(ue_py_asyncio_handle_type);
+		Py_CLEAR(ue_py_asyncio_timer_handle_type);
+		Py_CLEAR(ue_py_asyncio_future_type);
+		Py_CLEAR(ue_py_asyncio_task_type);
+		Py_CLEAR(ue_py_asyncio_get_running_loop);
+		Py_CLEAR(ue_py_asyncio_set_running_loop);
+		Py_DECREF(py_asyncio);
+		return false;
+	}
+
+	// the native methods win over the AbstractEventLoop stubs, while isinstance() checks are satisfied
+	ue_py_event_loop_class = PyObject_CallFunction((PyObject *)&PyType_Type, (char *)"s(OO){s:s}", "UnrealEventLoop",
+		(PyObject *)&ue_PyUnrealEventLoopBaseType, py_abstract_loop, "__module__", "unreal_engine");
+	Py_DECREF(py_abstract_loop);
+	if (!ue_py_event_loop_class)
+	{
+		Py_DECREF(py_asyncio);
+		return false;
+	}
+
+	ue_py_asyncio_module = py_asyncio;
+	return true;
+}
+
+static ue_PyUnrealEventLoop *ue_py_asyncio_default_loop()
+{
+	if (ue_py_default_event_loop)
+		return (ue_PyUnrealEventLoop *)ue_py_default_event_loop;
+
+	if (!ue_py_asyncio_import())
+		return nullptr;
+
+	ue_py_default_event_loop = PyObject_CallObject(ue_py_event_loop_class, nullptr);
+	if (!ue_py_default_event_loop)
+		return nullptr;
+
+	// asyncio.get_event_loop() and asyncio.ensure_future() outside of coroutines get the unreal loop too
+	PyObject *ret = PyObject_CallMethod(ue_py_asyncio_module, (char *)"set_event_loop", (char *)"O", ue_py_default_event_loop);
+	if (!ret)
+		unreal_engine_py_log_error();
+	else
+		Py_DECREF(ret);
+
+	return (ue_PyUnrealEventLoop *)ue_py_default_event_loop;
+}
+
+// the running unreal loop (when called from a callback) or the default one, borrowed
+static ue_PyUnrealEventLoop *ue_py_asyncio_current_loop()
+{
+	if (!ue_py_asyncio_import())
+		return nullptr;
+
+	PyObject *py_loop = PyObject_CallObject(ue_py_asyncio_get_running_loop, nullptr);
+	if (!py_loop)
+		return nullptr;
+	Py_DECREF(py_loop);
+
+	if (py_loop == Py_None)
+		return ue_py_asyncio_default_loop();
+
+	if (!PyObject_IsInstance(py_loop, (PyObject *)&ue_PyUnrealEventLoopBaseType))
+	{
+		PyErr_Format(PyExc_RuntimeError, "the running event loop is not an UnrealEventLoop");
+		return nullptr;
+	}
+
+	return (ue_PyUnrealEventLoop *)py_loop;
+}
+
+PyObject *ue_py_asyncio_set_future(PyObject *py_future, PyObject *py_result, PyObject *py_exception)
+{
+	PyObject *py_cancelled = PyObject_CallMethod(py_future, (char *)"cancelled", nullptr);
+	if (!py_cancelled)
+		return nullptr;
+	bool cancelled = PyObject_IsTrue(py_cancelled) != 0;
+	Py_DECREF(py_cancelled);
+	if (cancelled)
+		Py_RETURN_NONE;
+
+	if (py_exception != Py_None)
+		return PyObject_CallMethod(py_future, (char *)"set_exception", (char *)"O", py_exception);
+	return PyObject_CallMethod(py_future, (char *)"set_result", (char *)"O", py_result);
+}
+
+static PyObject *py_ue_asyncio_set_future(PyObject *self, PyObject * args)
+{
+	PyObject *py_future;
+	PyObject *py_result;
+	PyObject *py_exception;
+	if (!PyArg_ParseTuple(args, "OOO", &py_future, &py_result, &py_exception))
+	{
+		return nullptr;
+	}
+
+	return ue_py_asyncio_set_future(py_future, py_result, py_exception);
+}
+
+static PyMethodDef ue_py_asyncio_set_future_def = { "_set_future", py_ue_asyncio_set_future, METH_VARARGS, "" };
+
+bool ue_py_asyncio_resolve_future(PyObject *py_future, PyObject *py_result, PyObject *py_exception)
+{
+	// asyncio futures must be completed by their loop
+	PyObject *py_loop = PyObject_CallMethod(py_future, (char *)"get_loop", nullptr);
+	if (!py_loop)
+		return false;
+
+	PyObject *ret = PyObject_CallMethod(py_loop, (char *)"call_soon_threadsafe", (char *)"OOOO", ue_py_asyncio_set_future_callable, py_future, py_result, py_exception);
+	Py_DECREF(py_loop);
+	if (!ret)
+		return false;
+	Py_DECREF(ret);
+	return true;
+}
+
+// bound to the future as the 'self' of the builtin
+static PyObject *py_ue_asyncio_future_callback(PyObject *py_future, PyObject * args)
+{
+	Py_ssize_t num_args = PyTuple_Size(args);
+	PyObject *py_result = args;
+	if (num_args == 0)
+		py_result = Py_None;
+	else if (num_args == 1)
+		py_result = PyTuple_GetItem(args, 0);
+
+	if (!ue_py_asyncio_resolve_future(py_future, py_result, Py_None))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef ue_py_asyncio_future_callback_def = { "_future_callback", py_ue_asyncio_future_callback, METH_VARARGS, "" };
+
+PyObject *ue_py_asyncio_new_future_callback(PyObject *py_future)
+{
+	return PyCFunction_New(&ue_py_asyncio_future_callback_def, py_future);
+}
+
+PyObject *ue_py_asyncio_new_future()
+{
+	if (!ue_py_asyncio_import())
+		return nullptr;
+
+	PyObject *py_loop = PyObject_CallObject(ue_py_asyncio_get_running_loop, nullptr);
+	if (!py_loop)
+		return nullptr;
+
+	if (py_loop == Py_None)
+	{
+		Py_DECREF(py_loop);
+		py_loop = (PyObject *)ue_py_asyncio_default_loop();
+		if (!py_loop)
+			return nullptr;
+		Py_INCREF(py_loop);
+	}
+
+	PyObject *py_future = PyObject_CallMethod(py_loop, (char *)"create_future", nullptr);
+	Py_DECREF(py_loop);
+	return py_future;
+}
+
+void FUEPyEventLoop::Start()
+{
+	if (bClosed || TickerHandle.IsValid())
+		return;
+#if ENGINE_MAJOR_VERSION == 5
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(AsShared(), &FUEPyEventLoop::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(AsShared(), &FUEPyEventLoop::Tick));
+#endif
+}
+
+void FUEPyEventLoop::ClearTimer(FUEPyEventLoopTimer &Timer)
+{
+	if (Timer.TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(Timer.TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(Timer.TickerHandle);
+#endif
+	}
+	else if (UWorld *TimerWorld = Timer.World.Get())
+	{
+		TimerWorld->GetTimerManager().ClearTimer(Timer.TimerHandle);
+	}
+}
+
+void FUEPyEventLoop::Close()
+{
+	if (bClosed)
+		return;
+	bClosed = true;
+
+	if (TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+		TickerHandle.Reset();
+	}
+
+	// releasing the handles could run python code touching the loop
+	TMap<PyObject *, FUEPyEventLoopTimer> OldTimers = MoveTemp(Timers);
+	TArray<PyObject *> OldReady = MoveTemp(Ready);
+	TArray<PyObject *> OldNextFrame = MoveTemp(NextFrame);
+	Timers.Empty();
+	Ready.Empty();
+	NextFrame.Empty();
+
+	for (TPair<PyObject *, FUEPyEventLoopTimer> &Pair : OldTimers)
+	{
+		ClearTimer(Pair.Value);
+		Py_DECREF(Pair.Key);
+	}
+	for (PyObject *py_handle : OldReady)
+	{
+		Py_DECREF(py_handle);
+	}
+	for (PyObject *py_future : OldNextFrame)
+	{
+		Py_DECREF(py_future);
+	}
+	Py_CLEAR(PyExceptionHandler);
+}
+
+double FUEPyEventLoop::Time() const
+{
+	if (bHasWorld)
+	{
+		if (UWorld *LoopWorld = World.Get())
+			return LoopWorld->GetTimeSeconds();
+	}
+	return FPlatformTime::Seconds();
+}
+
+void FUEPyEventLoop::Schedule(PyObject *py_handle, double Delay, UWorld *TimerWorld)
+{
+	// FTimerManager clears timers with a non positive rate
+	if (Delay <= 0)
+	{
+		Ready.Add(py_handle);
+		return;
+	}
+
+	TWeakPtr<FUEPyEventLoop> WeakLoop = AsShared();
+	FUEPyEventLoopTimer Timer;
+	if (TimerWorld)
+	{
+		Timer.World = TimerWorld;
+		TimerWorld->GetTimerManager().SetTimer(Timer.TimerHandle, FTimerDelegate::CreateLambda([WeakLoop, py_handle]()
+		{
+			if (TSharedPtr<FUEPyEventLoop> Loop = WeakLoop.Pin())
+				Loop->OnTimer(py_handle);
+		}), (float)Delay, false);
+	}
+	else
+	{
+		FTickerDelegate TickerDelegate = FTickerDelegate::CreateLambda([WeakLoop, py_handle](float DeltaTime)
+		{
+			if (TSharedPtr<FUEPyEventLoop> Loop = WeakLoop.Pin())
+				Loop->OnTimer(py_handle);
+			return false;
+		});
+#if ENGINE_MAJOR_VERSION == 5
+		Timer.TickerHandle = FTSTicker::GetCoreTicker().AddTicker(TickerDelegate, (float)Delay);
+#else
+		Timer.TickerHandle = FTicker::GetCoreTicker().AddTicker(TickerDelegate, (float)Delay);
+#endif
+	}
+
+	// TimerHandle.cancel() notifies the loop only for scheduled handles
+	if (PyObject_SetAttrString(py_handle, "_scheduled", Py_True) < 0)
+		PyErr_Clear();
+	Timers.Add(py_handle, Timer);
+}
+
+void FUEPyEventLoop::OnTimer(PyObject *py_handle)
+{
+	FScopePythonGIL gil;
+
+	// cancelled handles (and the ones of a closed loop) are no more in the map
+	if (Timers.Remove(py_handle) == 0)
+		return;
+
+	if (PyObject_SetAttrString(py_handle, "_scheduled", Py_False) < 0)
+		PyErr_Clear();
+	Ready.Add(py_handle);
+}
+
+void FUEPyEventLoop::CancelTimer(PyObject *py_handle)
+{
+	FUEPyEventLoopTimer Timer;
+	if (!Timers.RemoveAndCopyValue(py_handle, Timer))
+		return;
+
+	ClearTimer(Timer);
+	Py_DECREF(py_handle);
+}
+
+void FUEPyEventLoop::RunHandle(PyObject *py_handle)
+{
+	PyObject *py_cancelled = PyObject_GetAttrString(py_handle, "_cancelled");
+	bool cancelled = false;
+	if (py_cancelled)
+	{
+		cancelled = PyObject_IsTrue(py_cancelled) != 0;
+		Py_DECREF(py_cancelled);
+	}
+	else
+	{
+		PyErr_Clear();
+	}
+
+	if (!cancelled)
+	{
+		// Handle._run() reports the callback exceptions to call_exception_handler()
+		PyObject *ret = PyObject_CallMethod(py_handle, (char *)"_run", nullptr);
+		if (!ret)
+			unreal_engine_py_log_error();
+		else
+			Py_DECREF(ret);
+		HandlesRun++;
+	}
+
+	Py_DECREF(py_handle);
+}
+
+bool FUEPyEventLoop::Tick(float DeltaTime)
+{
+	if (bClosed)
+		return false;
+	if (bStopped)
+		return true;
+
+	FScopePythonGIL gil;
+
+	// a callback could drop the last reference to the python loop
+	TSharedRef<FUEPyEventLoop> KeepAlive = AsShared();
+	PyObject *py_loop = PyLoop;
+	Py_INCREF(py_loop);
+
+	Frames++;
+	double Start = FPlatformTime::Seconds();
+
+	if (NextFrame.Num() > 0)
+	{
+		TArray<PyObject *> Futures = MoveTemp(NextFrame);
+		NextFrame.Reset();
+		for (PyObject *py_future : Futures)
+		{
+			// the done callbacks are scheduled with call_soon()
+			PyObject *ret = ue_py_asyncio_set_future(py_future, Py_None, Py_None);
+			if (!ret)
+				unreal_engine_py_log_error();
+			else
+				Py_DECREF(ret);
+			Py_DECREF(py_future);
+		}
+	}
+
+	if (Ready.Num() > 0)
+	{
+		PyObject *py_previous_loop = PyObject_CallObject(ue_py_asyncio_get_running_loop, nullptr);
+		if (!py_previous_loop)
+		{
+			unreal_engine_py_log_error();
+			py_previous_loop = Py_None;
+			Py_INCREF(py_previous_loop);
+		}
+
+		PyObject *ret = PyObject_CallFunctionObjArgs(ue_py_asyncio_set_running_loop, py_loop, nullptr);
+		if (!ret)
+			unreal_engine_py_log_error();
+		else
+			Py_DECREF(ret);
+
+		int32 Ran = 0;
+		while (Ready.Num() > 0 && !bClosed && !bStopped)
+		{
+			// callbacks scheduled by this batch run in the next one
+			TArray<PyObject *> Batch = MoveTemp(Ready);
+			Ready.Reset();
+
+			int32 Index = 0;
+			while (Index < Batch.Num())
+			{
+				if (bClosed || bStopped || (Ran > 0 && FPlatformTime::Seconds() - Start >= FrameBudget))
+					break;
+				RunHandle(Batch[Index++]);
+				Ran++;
+			}
+
+			if (Index < Batch.Num())
+			{
+				if (bClosed)
+				{
+					for (; Index < Batch.Num(); Index++)
+					{
+						Py_DECREF(Batch[Index]);
+					}
+					break;
+				}
+				// postponed callbacks stay ahead of the ones scheduled in this frame
+				Batch.RemoveAt(0, Index, false);
+				Batch.Append(Ready);
+				Ready = MoveTemp(Batch);
+				if (!bStopped)
+					OverBudgetFrames++;
+				break;
+			}
+
+			if (Ready.Num() > 0 && FPlatformTime::Seconds() - Start >= FrameBudget)
+			{
+				OverBudgetFrames++;
+				break;
+			}
+		}
+
+		ret = PyObject_CallFunctionObjArgs(ue_py_asyncio_set_running_loop, py_previous_loop, nullptr);
+		if (!ret)
+			unreal_engine_py_log_error();
+		else
+			Py_DECREF(ret);
+		Py_DECREF(py_previous_loop);
+	}
+
+	LastFrameTime = FPlatformTime::Seconds() - Start;
+
+	Py_DECREF(py_loop);
+	return !bClosed;
+}
+
+static PyObject *ue_py_event_loop_new_handle(PyObject *py_loop, PyObject *py_when, PyObject *py_callback, PyObject *py_args, PyObject *py_context)
+{
+	PyObject *py_handle_args = nullptr;
+	// the context argument is not available before python 3.7
+	if (py_when)
+	{
+		if (py_context != Py_None)
+			py_handle_args = PyTuple_Pack(5, py_when, py_callback, py_args, py_loop, py_context);
+		else
+			py_handle_args = PyTuple_Pack(4, py_when, py_callback, py_args, py_loop);
+	}
+	else
+	{
+		if (py_context != Py_None)
+			py_handle_args = PyTuple_Pack(4, py_callback, py_args, py_loop, py_context);
+		else
+			py_handle_args = PyTuple_Pack(3, py_callback, py_args, py_loop);
+	}
+
+	if (!py_handle_args)
+		return nullptr;
+
+	PyObject *py_handle = PyObject_CallObject(py_when ? ue_py_asyncio_timer_handle_type : ue_py_asyncio_handle_type, py_handle_args);
+	Py_DECREF(py_handle_args);
+	return py_handle;
+}
+
+// parses (fixed arguments, callback, *args, context=None), py_args is a new reference
+static bool ue_py_event_loop_parse_callback(PyObject *args, PyObject *kwargs, Py_ssize_t fixed, const char *name, PyObject **py_callback, PyObject **py_args, PyObject **py_context)
+{
+	Py_ssize_t num_args = PyTuple_Size(args);
+	if (num_args < fixed + 1)
+	{
+		PyErr_Format(PyExc_TypeError, "%s() takes at least %d positional arguments", name, (int)(fixed + 1));
+		return false;
+	}
+
+	*py_callback = PyTuple_GetItem(args, fixed);
+	if (!PyCallable_Check(*py_callback))
+	{
+		PyErr_Format(PyExc_TypeError, "a callable object was expected by %s()", name);
+		return false;
+	}
+
+	*py_context = Py_None;
+	if (kwargs)
+	{
+		Py_ssize_t num_kwargs = PyDict_Size(kwargs);
+		PyObject *py_context_arg = PyDict_GetItemString(kwargs, "context");
+		if (py_context_arg)
+		{
+			*py_context = py_context_arg;
+			num_kwargs--;
+		}
+		if (num_kwargs > 0)
+		{
+			PyErr_Format(PyExc_TypeError, "%s() only accepts the context keyword argument", name);
+			return false;
+		}
+	}
+
+	*py_args = PyTuple_GetSlice(args, fixed + 1, num_args);
+	return *py_args != nullptr;
+}
+
+static PyObject *ue_py_event_loop_closed_error()
+{
+	return PyErr_Format(PyExc_RuntimeError, "Event loop is closed");
+}
+
+static PyObject *ue_py_event_loop_new_future(ue_PyUnrealEventLoop *self)
+{
+	PyObject *py_args = PyTuple_New(0);
+	PyObject *py_kwargs = Py_BuildValue((char *)"{s:O}", "loop", (PyObject *)self);
+	PyObject *py_future = PyObject_Call(ue_py_asyncio_future_type, py_args, py_kwargs);
+	Py_DECREF(py_args);
+	Py_DECREF(py_kwargs);
+	return py_future;
+}
+
+// schedule a TimerHandle on timer_world (or on the core ticker)
+static PyObject *ue_py_event_loop_schedule(ue_PyUnrealEventLoop *self, double delay, PyObject *py_callback, PyObject *py_args, PyObject *py_context, UWorld *timer_world)
+{
+	PyObject *py_when = PyFloat_FromDouble(self->loop->Time() + delay);
+	PyObject *py_handle = ue_py_event_loop_new_handle((PyObject *)self, py_when, py_callback, py_args, py_context);
+	Py_DECREF(py_when);
+	if (!py_handle)
+		return nullptr;
+
+	// the loop owns a reference until the handle runs or is cancelled
+	Py_INCREF(py_handle);
+	self->loop->Schedule(py_handle, delay, timer_world);
+	return py_handle;
+}
+
+// the world of a world bound loop, nullptr (without exception) for the ticker driven ones
+static bool ue_py_event_loop_timer_world(ue_PyUnrealEventLoop *self, UWorld **world)
+{
+	*world = nullptr;
+	if (!self->loop->bHasWorld)
+		return true;
+
+	*world = self->loop->World.Get();
+	if (!*world)
+	{
+		PyErr_Format(PyExc_RuntimeError, "the world of the event loop has been destroyed");
+		return false;
+	}
+	return true;
+}
+
+static PyObject *py_ue_event_loop_call_soon(ue_PyUnrealEventLoop *self, PyObject * args, PyObject *kwargs)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	PyObject *py_callback;
+	PyObject *py_args;
+	PyObject *py_context;
+	if (!ue_py_event_loop_parse_callback(args, kwargs, 0, "call_soon", &py_callback, &py_args, &py_context))
+		return nullptr;
+
+	PyObject *py_handle = ue_py_event_loop_new_handle((PyObject *)self, nullptr, py_callback, py_args, py_context);
+	Py_DECREF(py_args);
+	if (!py_handle)
+		return nullptr;
+
+	Py_INCREF(py_handle);
+	self->loop->Ready.Add(py_handle);
+	return py_handle;
+}
+
+static PyObject *py_ue_event_loop_call_later(ue_PyUnrealEventLoop *self, PyObject * args, PyObject *kwargs)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	PyObject *py_callback;
+	PyObject *py_args;
+	PyObject *py_context;
+	if (!ue_py_event_loop_parse_callback(args, kwargs, 1, "call_later", &py_callback, &py_args, &py_context))
+		return nullptr;
+
+	double delay = PyFloat_AsDouble(PyTuple_GetItem(args, 0));
+	UWorld *world = nullptr;
+	if ((delay == -1 && PyErr_Occurred()) || !ue_py_event_loop_timer_world(self, &world))
+	{
+		Py_DECREF(py_args);
+		return nullptr;
+	}
+
+	PyObject *py_handle = ue_py_event_loop_schedule(self, delay, py_callback, py_args, py_context, world);
+	Py_DECREF(py_args);
+	return py_handle;
+}
+
+static PyObject *py_ue_event_loop_call_at(ue_PyUnrealEventLoop *self, PyObject * args, PyObject *kwargs)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	PyObject *py_callback;
+	PyObject *py_args;
+	PyObject *py_context;
+	if (!ue_py_event_loop_parse_callback(args, kwargs, 1, "call_at", &py_callback, &py_args, &py_context))
+		return nullptr;
+
+	double when = PyFloat_AsDouble(PyTuple_GetItem(args, 0));
+	UWorld *world = nullptr;
+	if ((when == -1 && PyErr_Occurred()) || !ue_py_event_loop_timer_world(self, &world))
+	{
+		Py_DECREF(py_args);
+		return nullptr;
+	}
+
+	PyObject *py_handle = ue_py_event_loop_schedule(self, when - self->loop->Time(), py_callback, py_args, py_context, world);
+	Py_DECREF(py_args);
+	return py_handle;
+}
+
+static PyObject *py_ue_event_loop_time(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	return PyFloat_FromDouble(self->loop->Time());
+}
+
+static PyObject *py_ue_event_loop_create_future(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	return ue_py_event_loop_new_future(self);
+}
+
+static PyObject *py_ue_event_loop_create_task(ue_PyUnrealEventLoop *self, PyObject * args, PyObject *kwargs)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	PyObject *py_coro;
+	PyObject *py_name = Py_None;
+	PyObject *py_context = Py_None;
+	static char *kw_names[] = { (char *)"coro", (char *)"name", (char *)"context", NULL };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO:create_task", kw_names, &py_coro, &py_name, &py_context))
+	{
+		return nullptr;
+	}
+
+	PyObject *py_task_args = PyTuple_Pack(1, py_coro);
+	PyObject *py_task_kwargs = Py_BuildValue((char *)"{s:O}", "loop", (PyObject *)self);
+	// name and context are only passed when specified, older pythons do not support them
+	if (py_name != Py_None)
+		PyDict_SetItemString(py_task_kwargs, "name", py_name);
+	if (py_context != Py_None)
+		PyDict_SetItemString(py_task_kwargs, "context", py_context);
+
+	PyObject *py_task = PyObject_Call(ue_py_asyncio_task_type, py_task_args, py_task_kwargs);
+	Py_DECREF(py_task_args);
+	Py_DECREF(py_task_kwargs);
+	return py_task;
+}
+
+static PyObject *py_ue_event_loop_run_in_executor(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	Py_ssize_t num_args = PyTuple_Size(args);
+	if (num_args < 2)
+		return PyErr_Format(PyExc_TypeError, "run_in_executor() takes at least 2 positional arguments");
+
+	PyObject *py_executor = PyTuple_GetItem(args, 0);
+	PyObject *py_func = PyTuple_GetItem(args, 1);
+	if (!PyCallable_Check(py_func))
+		return PyErr_Format(PyExc_TypeError, "a callable object was expected by run_in_executor()");
+
+	// (func, *args)
+	PyObject *py_call_args = PyTuple_GetSlice(args, 1, num_args);
+	if (!py_call_args)
+		return nullptr;
+
+	// a real executor is honoured, otherwise the task graph is used
+	if (py_executor != Py_None)
+	{
+		PyObject *py_submit = PyObject_GetAttrString(py_executor, "submit");
+		PyObject *py_concurrent_future = py_submit ? PyObject_CallObject(py_submit, py_call_args) : nullptr;
+		Py_XDECREF(py_submit);
+		Py_DECREF(py_call_args);
+		if (!py_concurrent_future)
+			return nullptr;
+
+		PyObject *py_wrap_future = PyObject_GetAttrString(ue_py_asyncio_module, "wrap_future");
+		if (!py_wrap_future)
+		{
+			Py_DECREF(py_concurrent_future);
+			return nullptr;
+		}
+		PyObject *py_wrap_args = PyTuple_Pack(1, py_concurrent_future);
+		PyObject *py_wrap_kwargs = Py_BuildValue((char *)"{s:O}", "loop", (PyObject *)self);
+		PyObject *py_future = PyObject_Call(py_wrap_future, py_wrap_args, py_wrap_kwargs);
+		Py_DECREF(py_wrap_future);
+		Py_DECREF(py_wrap_args);
+		Py_DECREF(py_wrap_kwargs);
+		Py_DECREF(py_concurrent_future);
+		return py_future;
+	}
+
+	// the task graph runs callables without arguments
+	PyObject *py_callable = py_func;
+	if (num_args > 2)
+	{
+		PyObject *py_functools = PyImport_ImportModule("functools");
+		PyObject *py_partial = py_functools ? PyObject_GetAttrString(py_functools, "partial") : nullptr;
+		Py_XDECREF(py_functools);
+		py_callable = py_partial ? PyObject_CallObject(py_partial, py_call_args) : nullptr;
+		Py_XDECREF(py_partial);
+		if (!py_callable)
+		{
+			Py_DECREF(py_call_args);
+			return nullptr;
+		}
+	}
+	else
+	{
+		Py_INCREF(py_callable);
+	}
+	Py_DECREF(py_call_args);
+
+	PyObject *py_future = ue_py_event_loop_new_future(self);
+	if (!py_future)
+	{
+		Py_DECREF(py_callable);
+		return nullptr;
+	}
+
+	PyObject *py_graph_event = py_ue_new_fgraph_event(py_callable, FGraphEventArray(), ENamedThreads::AnyThread);
+	Py_DECREF(py_callable);
+	py_ue_fgraph_event_add_future((ue_PyFGraphEvent *)py_graph_event, py_future);
+	Py_DECREF(py_graph_event);
+
+	return py_future;
+}
+
+static PyObject *py_ue_event_loop_get_debug(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_event_loop_set_debug(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_is_running(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	if (!self->loop->bClosed && !self->loop->bStopped)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_event_loop_is_closed(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	if (self->loop->bClosed)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_event_loop_close(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	self->loop->Close();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_stop(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	self->loop->bStopped = true;
+	Py_RETURN_NONE;
+}
+
+// the loop is driven by the engine, run_forever() just resumes a stopped loop
+static PyObject *py_ue_event_loop_run_forever(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+	self->loop->bStopped = false;
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_run_until_complete(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	return PyErr_Format(PyExc_RuntimeError, "the UnrealEventLoop is driven by the engine ticker, use create_task() instead of run_until_complete()");
+}
+
+static PyObject *py_ue_event_loop_default_exception_handler(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_context;
+	if (!PyArg_ParseTuple(args, "O!:default_exception_handler", &PyDict_Type, &py_context))
+	{
+		return nullptr;
+	}
+
+	PyObject *py_message = PyDict_GetItemString(py_context, "message");
+	if (py_message && PyUnicode_Check(py_message))
+		UE_LOG(LogPython, Error, TEXT("asyncio: %s"), UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_message)));
+	else
+		UE_LOG(LogPython, Error, TEXT("asyncio: Unhandled exception in event loop"));
+
+	PyObject *py_key = nullptr;
+	PyObject *py_value = nullptr;
+	Py_ssize_t pos = 0;
+	while (PyDict_Next(py_context, &pos, &py_key, &py_value))
+	{
+		if (!PyUnicode_Check(py_key) || !PyUnicode_CompareWithASCIIString(py_key, "message") || !PyUnicode_CompareWithASCIIString(py_key, "exception"))
+			continue;
+		PyObject *py_repr = PyObject_Repr(py_value);
+		if (!py_repr)
+		{
+			PyErr_Clear();
+			continue;
+		}
+		UE_LOG(LogPython, Error, TEXT("%s: %s"), UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_key)), UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_repr)));
+		Py_DECREF(py_repr);
+	}
+
+	PyObject *py_exception = PyDict_GetItemString(py_context, "exception");
+	if (py_exception && PyExceptionInstance_Check(py_exception))
+	{
+		Py_INCREF(py_exception);
+		Py_INCREF(Py_TYPE(py_exception));
+		PyErr_Restore((PyObject *)Py_TYPE(py_exception), py_exception, PyException_GetTraceback(py_exception));
+		unreal_engine_py_log_error();
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_call_exception_handler(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_context;
+	if (!PyArg_ParseTuple(args, "O!:call_exception_handler", &PyDict_Type, &py_context))
+	{
+		return nullptr;
+	}
+
+	if (!self->loop->PyExceptionHandler)
+		return py_ue_event_loop_default_exception_handler(self, args);
+
+	// exceptions of the handler must not propagate to the asyncio internals
+	PyObject *ret = PyObject_CallFunctionObjArgs(self->loop->PyExceptionHandler, (PyObject *)self, py_context, nullptr);
+	if (!ret)
+		unreal_engine_py_log_error();
+	else
+		Py_DECREF(ret);
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_set_exception_handler(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_handler;
+	if (!PyArg_ParseTuple(args, "O:set_exception_handler", &py_handler))
+	{
+		return nullptr;
+	}
+
+	if (py_handler != Py_None && !PyCallable_Check(py_handler))
+		return PyErr_Format(PyExc_TypeError, "argument is not a callable");
+
+	Py_CLEAR(self->loop->PyExceptionHandler);
+	if (py_handler != Py_None)
+	{
+		Py_INCREF(py_handler);
+		self->loop->PyExceptionHandler = py_handler;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_get_exception_handler(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	if (!self->loop->PyExceptionHandler)
+		Py_RETURN_NONE;
+	Py_INCREF(self->loop->PyExceptionHandler);
+	return self->loop->PyExceptionHandler;
+}
+
+static PyObject *py_ue_event_loop_timer_handle_cancelled(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_handle;
+	if (!PyArg_ParseTuple(args, "O:_timer_handle_cancelled", &py_handle))
+	{
+		return nullptr;
+	}
+
+	self->loop->CancelTimer(py_handle);
+	Py_RETURN_NONE;
+}
+
+// there are no async generators hooks nor default executors to shutdown, an already completed awaitable
+static PyObject *py_ue_event_loop_shutdown(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_future = ue_py_event_loop_new_future(self);
+	if (!py_future)
+		return nullptr;
+	PyObject *ret = PyObject_CallMethod(py_future, (char *)"set_result", (char *)"O", Py_None);
+	if (!ret)
+	{
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+	Py_DECREF(ret);
+	return py_future;
+}
+
+static PyObject *py_ue_event_loop_next_frame(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	PyObject *py_future = ue_py_event_loop_new_future(self);
+	if (!py_future)
+		return nullptr;
+
+	Py_INCREF(py_future);
+	self->loop->NextFrame.Add(py_future);
+	return py_future;
+}
+
+static PyObject *ue_py_event_loop_world_timer(ue_PyUnrealEventLoop *self, PyObject *py_world, float seconds)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	ue_PyUObject *py_u_world = ue_is_pyuobject(py_world);
+	if (!py_u_world)
+		return PyErr_Format(PyExc_Exception, "argument is not a UObject");
+
+	UWorld *world = ue_get_uworld(py_u_world);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	PyObject *py_future = ue_py_event_loop_new_future(self);
+	if (!py_future)
+		return nullptr;
+
+	PyObject *py_args = PyTuple_Pack(3, py_future, Py_None, Py_None);
+	PyObject *py_handle = ue_py_event_loop_schedule(self, seconds, ue_py_asyncio_set_future_callable, py_args, Py_None, world);
+	Py_DECREF(py_args);
+	if (!py_handle)
+	{
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+	Py_DECREF(py_handle);
+
+	return py_future;
+}
+
+static PyObject *py_ue_event_loop_world_timer(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_world;
+	float seconds;
+	if (!PyArg_ParseTuple(args, "Of:world_timer", &py_world, &seconds))
+	{
+		return nullptr;
+	}
+
+	return ue_py_event_loop_world_timer(self, py_world, seconds);
+}
+
+static PyObject *ue_py_event_loop_latent_action(ue_PyUnrealEventLoop *self, PyObject *py_owner)
+{
+	if (self->loop->bClosed)
+		return ue_py_event_loop_closed_error();
+
+	// the callback target lives as long as its owner
+	UObject *owner = self->loop->bHasWorld ? self->loop->World.Get() : nullptr;
+	if (py_owner && py_owner != Py_None)
+	{
+		owner = ue_py_check_type<UObject>(py_owner);
+		if (!owner)
+			return PyErr_Format(PyExc_Exception, "argument is not a UObject");
+	}
+	if (!owner)
+		return PyErr_Format(PyExc_Exception, "an owner is required for latent actions of loops not bound to a world");
+
+	PyObject *py_future = ue_py_event_loop_new_future(self);
+	if (!py_future)
+		return nullptr;
+
+	PyObject *py_callback = ue_py_asyncio_new_future_callback(py_future);
+	if (!py_callback)
+	{
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+
+	static UFunction *fake_callable = UPythonDelegate::StaticClass()->FindFunctionByName(FName("PyFakeCallable"));
+	UPythonDelegate *py_delegate = FUnrealEnginePythonHouseKeeper::Get()->NewDelegate(owner, py_callback, fake_callable);
+	Py_DECREF(py_callback);
+
+	// latent actions are identified by (callback target, uuid)
+	static int32 latent_uuid = 0;
+	FLatentActionInfo latent_info(0, ++latent_uuid, TEXT("PyFakeCallable"), py_delegate);
+
+	PyObject *py_latent_info = py_ue_new_owned_uscriptstruct(FLatentActionInfo::StaticStruct(), (uint8 *)&latent_info);
+	if (!py_latent_info)
+	{
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+
+	return Py_BuildValue((char *)"NN", py_latent_info, py_future);
+}
+
+static PyObject *py_ue_event_loop_latent_action(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	PyObject *py_owner = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:latent_action", &py_owner))
+	{
+		return nullptr;
+	}
+
+	return ue_py_event_loop_latent_action(self, py_owner);
+}
+
+static PyObject *py_ue_event_loop_set_frame_budget(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	float budget;
+	if (!PyArg_ParseTuple(args, "f:set_frame_budget", &budget))
+	{
+		return nullptr;
+	}
+
+	if (budget < 0)
+		return PyErr_Format(PyExc_ValueError, "the frame budget cannot be negative");
+
+	self->loop->FrameBudget = budget / 1000.0;
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_event_loop_get_frame_budget(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	return PyFloat_FromDouble(self->loop->FrameBudget * 1000.0);
+}
+
+static PyObject *py_ue_event_loop_get_stats(ue_PyUnrealEventLoop *self, PyObject * args)
+{
+	TSharedPtr<FUEPyEventLoop> loop = self->loop;
+
+	PyObject *py_dict = PyDict_New();
+
+	PyObject *py_value = PyLong_FromLong(loop->Ready.Num());
+	PyDict_SetItemString(py_dict, "ready", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(loop->Timers.Num());
+	PyDict_SetItemString(py_dict, "timers", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(loop->NextFrame.Num());
+	PyDict_SetItemString(py_dict, "next_frame", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(loop->HandlesRun);
+	PyDict_SetItemString(py_dict, "handles_run", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(loop->Frames);
+	PyDict_SetItemString(py_dict, "frames", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(loop->OverBudgetFrames);
+	PyDict_SetItemString(py_dict, "over_budget_frames", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(loop->LastFrameTime);
+	PyDict_SetItemString(py_dict, "last_frame_time", py_value);
+	Py_DECREF(py_value);
+
+	return py_dict;
+}
+
+static PyMethodDef ue_PyUnrealEventLoop_methods[] = {
+	{ "call_soon", (PyCFunction)py_ue_event_loop_call_soon, METH_VARARGS | METH_KEYWORDS, "" },
+	// the GIL is enough to protect the ready queue
+	{ "call_soon_threadsafe", (PyCFunction)py_ue_event_loop_call_soon, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "call_later", (PyCFunction)py_ue_event_loop_call_later, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "call_at", (PyCFunction)py_ue_event_loop_call_at, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "time", (PyCFunction)py_ue_event_loop_time, METH_VARARGS, "" },
+	{ "create_future", (PyCFunction)py_ue_event_loop_create_future, METH_VARARGS, "" },
+	{ "create_task", (PyCFunction)py_ue_event_loop_create_task, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "run_in_executor", (PyCFunction)py_ue_event_loop_run_in_executor, METH_VARARGS, "" },
+	{ "get_debug", (PyCFunction)py_ue_event_loop_get_debug, METH_VARARGS, "" },
+	{ "set_debug", (PyCFunction)py_ue_event_loop_set_debug, METH_VARARGS, "" },
+	{ "is_running", (PyCFunction)py_ue_event_loop_is_running, METH_VARARGS, "" },
+	{ "is_closed", (PyCFunction)py_ue_event_loop_is_closed, METH_VARARGS, "" },
+	{ "close", (PyCFunction)py_ue_event_loop_close, METH_VARARGS, "" },
+	{ "stop", (PyCFunction)py_ue_event_loop_stop, METH_VARARGS, "" },
+	{ "run_forever", (PyCFunction)py_ue_event_loop_run_forever, METH_VARARGS, "" },
+	{ "run_until_complete", (PyCFunction)py_ue_event_loop_run_until_complete, METH_VARARGS, "" },
+	{ "call_exception_handler", (PyCFunction)py_ue_event_loop_call_exception_handler, METH_VARARGS, "" },
+	{ "default_exception_handler", (PyCFunction)py_ue_event_loop_default_exception_handler, METH_VARARGS, "" },
+	{ "set_exception_handler", (PyCFunction)py_ue_event_loop_set_exception_handler, METH_VARARGS, "" },
+	{ "get_exception_handler", (PyCFunction)py_ue_event_loop_get_exception_handler, METH_VARARGS, "" },
+	{ "_timer_handle_cancelled", (PyCFunction)py_ue_event_loop_timer_handle_cancelled, METH_VARARGS, "" },
+	{ "shutdown_asyncgens", (PyCFunction)py_ue_event_loop_shutdown, METH_VARARGS, "" },
+	{ "shutdown_default_executor", (PyCFunction)py_ue_event_loop_shutdown, METH_VARARGS, "" },
+	{ "next_frame", (PyCFunction)py_ue_event_loop_next_frame, METH_VARARGS, "" },
+	{ "world_timer", (PyCFunction)py_ue_event_loop_world_timer, METH_VARARGS, "" },
+	{ "latent_action", (PyCFunction)py_ue_event_loop_latent_action, METH_VARARGS, "" },
+	{ "set_frame_budget", (PyCFunction)py_ue_event_loop_set_frame_budget, METH_VARARGS, "" },
+	{ "get_frame_budget", (PyCFunction)py_ue_event_loop_get_frame_budget, METH_VARARGS, "" },
+	{ "get_stats", (PyCFunction)py_ue_event_loop_get_stats, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyUnrealEventLoop_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	ue_PyUnrealEventLoop *self = (ue_PyUnrealEventLoop *)type->tp_alloc(type, 0);
+	if (!self)
+		return nullptr;
+
+	TSharedPtr<FUEPyEventLoop> loop = MakeShareable(new FUEPyEventLoop());
+	loop->PyLoop = (PyObject *)self;
+	loop->PyExceptionHandler = nullptr;
+	loop->bHasWorld = false;
+	loop->FrameBudget = 0.002;
+	loop->bClosed = false;
+	loop->bStopped = false;
+	loop->HandlesRun = 0;
+	loop->Frames = 0;
+	loop->OverBudgetFrames = 0;
+	loop->LastFrameTime = 0;
+	new(&self->loop) TSharedPtr<FUEPyEventLoop>(loop);
+
+	return (PyObject *)self;
+}
+
+static int ue_PyUnrealEventLoop_init(ue_PyUnrealEventLoop *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_world = nullptr;
+	float frame_budget = 2;
+	static char *kw_names[] = { (char *)"world", (char *)"frame_budget", NULL };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Of:UnrealEventLoop", kw_names, &py_world, &frame_budget))
+	{
+		return -1;
+	}
+
+	if (py_world && py_world != Py_None)
+	{
+		ue_PyUObject *py_u_world = ue_is_pyuobject(py_world);
+		UWorld *world = py_u_world ? ue_get_uworld(py_u_world) : nullptr;
+		if (!world)
+		{
+			PyErr_SetString(PyExc_Exception, "unable to retrieve UWorld from argument");
+			return -1;
+		}
+		self->loop->World = world;
+		self->loop->bHasWorld = true;
+	}
+
+	self->loop->FrameBudget = FMath::Max(frame_budget, 0.f) / 1000.0;
+	self->loop->Start();
+	return 0;
+}
+
+static PyObject *ue_PyUnrealEventLoop_str(ue_PyUnrealEventLoop *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.UnrealEventLoop running=%d closed=%d ready=%d timers=%d>",
+		(!self->loop->bClosed && !self->loop->bStopped) ? 1 : 0, self->loop->bClosed ? 1 : 0, self->loop->Ready.Num(), self->loop->Timers.Num());
+}
+
+static void ue_PyUnrealEventLoop_dealloc(ue_PyUnrealEventLoop *self)
+{
+	self->loop->Close();
+	self->loop.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyTypeObject ue_PyUnrealEventLoopBaseType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.UnrealEventLoopBase", /* tp_name */
+	sizeof(ue_PyUnrealEventLoop), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyUnrealEventLoop_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	(reprfunc)ue_PyUnrealEventLoop_str,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyUnrealEventLoop_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,        /* tp_flags */
+	"Unreal Engine asyncio Event Loop",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyUnrealEventLoop_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_asyncio(PyObject *ue_module)
+{
+	ue_PyUnrealEventLoopBaseType.tp_new = ue_PyUnrealEventLoop_new;
+	ue_PyUnrealEventLoopBaseType.tp_init = (initproc)ue_PyUnrealEventLoop_init;
+
+	if (PyType_Ready(&ue_PyUnrealEventLoopBaseType) < 0)
+		return;
+
+	ue_py_asyncio_set_future_callable = PyCFunction_New(&ue_py_asyncio_set_future_def, nullptr);
+
+	Py_INCREF(&ue_PyUnrealEventLoopBaseType);
+	PyModule_AddObject(ue_module, "UnrealEventLoopBase", (PyObject *)&ue_PyUnrealEventLoopBaseType);
+}
+
+PyObject *py_unreal_engine_get_event_loop(PyObject * self, PyObject * args)
+{
+	PyObject *py_loop = (PyObject *)ue_py_asyncio_default_loop();
+	if (!py_loop)
+		return nullptr;
+	Py_INCREF(py_loop);
+	return py_loop;
+}
+
+PyObject *py_unreal_engine_new_event_loop(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	if (!ue_py_asyncio_import())
+		return nullptr;
+	return PyObject_Call(ue_py_event_loop_class, args, kwargs);
+}
+
+PyObject *py_unreal_engine_next_frame(PyObject * self, PyObject * args)
+{
+	ue_PyUnrealEventLoop *py_loop = ue_py_asyncio_current_loop();
+	if (!py_loop)
+		return nullptr;
+	return py_ue_event_loop_next_frame(py_loop, args);
+}
+
+PyObject *py_unreal_engine_world_timer(PyObject * self, PyObject * args)
+{
+	PyObject *py_world;
+	float seconds;
+	if (!PyArg_ParseTuple(args, "Of:world_timer", &py_world, &seconds))
+	{
+		return nullptr;
+	}
+
+	ue_PyUnrealEventLoop *py_loop = ue_py_asyncio_current_loop();
+	if (!py_loop)
+		return nullptr;
+	return ue_py_event_loop_world_timer(py_loop, py_world, seconds);
+}
+
+PyObject *py_unreal_engine_latent_action(PyObject * self, PyObject * args)
+{
+	PyObject *py_owner = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:latent_action", &py_owner))
+	{
+		return nullptr;
+	}
+
+	ue_PyUnrealEventLoop *py_loop = ue_py_asyncio_current_loop();
+	if (!py_loop)
+		return nullptr;
+	return ue_py_event_loop_latent_action(py_loop, py_owner);
+}
+
+#endif
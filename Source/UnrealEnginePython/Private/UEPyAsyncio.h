@@ -0,0 +1,114 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+#include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+// a scheduled asyncio TimerHandle, backed by the world FTimerManager or by the core ticker
+struct FUEPyEventLoopTimer
+{
+	TWeakObjectPtr<UWorld> World;
+	FTimerHandle TimerHandle;
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
+
+// native state of an UnrealEventLoop, everything is accessed from the game thread with the GIL held
+// (call_soon_threadsafe only needs the GIL)
+class FUEPyEventLoop : public TSharedFromThis<FUEPyEventLoop>
+{
+public:
+	bool Tick(float DeltaTime);
+	void Start();
+	void Close();
+
+	double Time() const;
+	// takes ownership of py_handle
+	void Schedule(PyObject *py_handle, double Delay, UWorld *TimerWorld);
+	void OnTimer(PyObject *py_handle);
+	void CancelTimer(PyObject *py_handle);
+
+	// borrowed, the python loop owns this state and closes it when deallocated
+	PyObject *PyLoop;
+	PyObject *PyExceptionHandler;
+	TWeakObjectPtr<UWorld> World;
+	bool bHasWorld;
+	// seconds of callbacks per frame, at least one callback runs every frame
+	double FrameBudget;
+	bool bClosed;
+	bool bStopped;
+
+	// asyncio Handles ready to run
+	TArray<PyObject *> Ready;
+	// futures completed at the beginning of the next frame
+	TArray<PyObject *> NextFrame;
+	TMap<PyObject *, FUEPyEventLoopTimer> Timers;
+
+	uint64 HandlesRun;
+	uint64 Frames;
+	// frames ending with callbacks postponed by the budget
+	uint64 OverBudgetFrames;
+	double LastFrameTime;
+
+private:
+	void RunHandle(PyObject *py_handle);
+	void ClearTimer(FUEPyEventLoopTimer &Timer);
+
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TSharedPtr<FUEPyEventLoop> loop;
+} ue_PyUnrealEventLoop;
+
+// keeps a python object (like an asyncio future) alive in native delegates, the reference is released with the GIL
+struct FUEPyObjectRef
+{
+	PyObject *PyObj;
+
+	FUEPyObjectRef(PyObject *py_obj) : PyObj(py_obj)
+	{
+		Py_INCREF(PyObj);
+	}
+
+	~FUEPyObjectRef()
+	{
+		FScopePythonGIL gil;
+		Py_DECREF(PyObj);
+	}
+};
+
+void ue_python_init_asyncio(PyObject *);
+
+// a new future of the running loop (or of the default unreal loop), the GIL must be held
+PyObject *ue_py_asyncio_new_future();
+// complete the future from any thread (the GIL must be held), py_exception can be Py_None
+bool ue_py_asyncio_resolve_future(PyObject *py_future, PyObject *py_result, PyObject *py_exception);
+// complete the future from its loop
+PyObject *ue_py_asyncio_set_future(PyObject *py_future, PyObject *py_result, PyObject *py_exception);
+// a callable completing py_future with its arguments (None, the only argument or a tuple)
+PyObject *ue_py_asyncio_new_future_callback(PyObject *py_future);
+
+PyObject *py_unreal_engine_get_event_loop(PyObject *, PyObject *);
+PyObject *py_unreal_engine_new_event_loop(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_next_frame(PyObject *, PyObject *);
+PyObject *py_unreal_engine_world_timer(PyObject *, PyObject *);
+PyObject *py_unreal_engine_latent_action(PyObject *, PyObject *);
+
+#endif
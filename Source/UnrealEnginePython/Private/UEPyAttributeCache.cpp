@@ -0,0 +1,218 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyAttributeCache.h"
+
+#include "Runtime/Core/Public/Misc/CoreDelegates.h"
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+FUnrealEnginePythonAttributeCache *FUnrealEnginePythonAttributeCache::Get()
+{
+	static FUnrealEnginePythonAttributeCache *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonAttributeCache();
+		Singleton->ResetStats();
+		Singleton->Invalidations = 0;
+		// classes can be garbage collected (and their memory reused), drop their buckets
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RunGCDelegate);
+#else
+		FCoreUObjectDelegates::PostGarbageCollect.AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RunGCDelegate);
+#endif
+#if ENGINE_MAJOR_VERSION == 5
+		// hot reload and live coding regenerate properties and functions
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason Reason)
+		{
+			FScopePythonGIL gil;
+			FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+		});
+#endif
+#if WITH_EDITOR
+		// GEditor is not available when the module starts
+		if (GEditor)
+		{
+			Singleton->RegisterEditorDelegates();
+		}
+		else
+		{
+			FCoreDelegates::OnPostEngineInit.AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RegisterEditorDelegates);
+		}
+#endif
+	}
+	return Singleton;
+}
+
+void FUnrealEnginePythonAttributeCache::RegisterEditorDelegates()
+{
+#if WITH_EDITOR
+	if (!GEditor)
+		return;
+	// blueprint compilation regenerates the class in place, so every cached FProperty is gone
+	GEditor->OnBlueprintCompiled().AddLambda([]()
+	{
+		FScopePythonGIL gil;
+		FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+	});
+#endif
+}
+
+TMap<UObject *, FUnrealEnginePythonAttributeCache::FAttributeCacheBucket> &FUnrealEnginePythonAttributeCache::GetCacheForObject(UObject *Object, UObject *&Owner)
+{
+	if (Object->IsA<UStruct>() || Object->IsA<UEnum>())
+	{
+		Owner = Object;
+		return TypesCache;
+	}
+	Owner = Object->GetClass();
+	return InstancesCache;
+}
+
+const FUEPyCachedAttribute *FUnrealEnginePythonAttributeCache::Find(UObject *Object, PyObject *PyName)
+{
+	if (!PyUnicode_CheckExact(PyName) || !PyUnicode_CHECK_INTERNED(PyName))
+		return nullptr;
+
+	UObject *Owner = nullptr;
+	TMap<UObject *, FAttributeCacheBucket> &Cache = GetCacheForObject(Object, Owner);
+	FAttributeCacheBucket *Bucket = Cache.Find(Owner);
+	if (!Bucket)
+		return nullptr;
+
+	FUEPyCachedAttribute *Attribute = Bucket->Attributes.Find(PyName);
+	if (Attribute)
+	{
+		Hits++;
+	}
+	return Attribute;
+}
+
+void FUnrealEnginePythonAttributeCache::Add(UObject *Object, PyObject *PyName, const FUEPyCachedAttribute &Attribute)
+{
+	Misses++;
+	if (!PyUnicode_CheckExact(PyName) || !PyUnicode_CHECK_INTERNED(PyName))
+		return;
+
+	UObject *Owner = nullptr;
+	TMap<UObject *, FAttributeCacheBucket> &Cache = GetCacheForObject(Object, Owner);
+	FAttributeCacheBucket *Bucket = Cache.Find(Owner);
+	if (!Bucket)
+	{
+		Bucket = &Cache.Add(Owner, FAttributeCacheBucket(Owner));
+	}
+
+	if (!Bucket->Attributes.Contains(PyName))
+	{
+		// keep the interned string alive, its address is the key
+		Py_INCREF(PyName);
+	}
+	Bucket->Attributes.Add(PyName, Attribute);
+}
+
+void FUnrealEnginePythonAttributeCache::ReleaseBucket(FAttributeCacheBucket &Bucket)
+{
+	for (auto &Pair : Bucket.Attributes)
+	{
+		Py_DECREF(Pair.Key);
+	}
+	Bucket.Attributes.Empty();
+}
+
+void FUnrealEnginePythonAttributeCache::Invalidate()
+{
+	for (auto &Pair : InstancesCache)
+	{
+		ReleaseBucket(Pair.Value);
+	}
+	for (auto &Pair : TypesCache)
+	{
+		ReleaseBucket(Pair.Value);
+	}
+	InstancesCache.Empty();
+	TypesCache.Empty();
+	Invalidations++;
+}
+
+void FUnrealEnginePythonAttributeCache::RunGCDelegate()
+{
+	FScopePythonGIL gil;
+	for (TMap<UObject *, FAttributeCacheBucket> *Cache : { &InstancesCache, &TypesCache })
+	{
+		for (auto It = Cache->CreateIterator(); It; ++It)
+		{
+			if (!It.Value().Owner.IsValid(true))
+			{
+				ReleaseBucket(It.Value());
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void FUnrealEnginePythonAttributeCache::ResetStats()
+{
+	Hits = 0;
+	Misses = 0;
+}
+
+int32 FUnrealEnginePythonAttributeCache::NumEntries() const
+{
+	int32 Entries = 0;
+	for (const auto &Pair : InstancesCache)
+	{
+		Entries += Pair.Value.Attributes.Num();
+	}
+	for (const auto &Pair : TypesCache)
+	{
+		Entries += Pair.Value.Attributes.Num();
+	}
+	return Entries;
+}
+
+PyObject *py_unreal_engine_get_attribute_cache_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonAttributeCache *Cache = FUnrealEnginePythonAttributeCache::Get();
+
+	uint64 Lookups = Cache->Hits + Cache->Misses;
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromUnsignedLongLong(Cache->Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(Lookups > 0 ? (double)Cache->Hits / (double)Lookups : 0);
+	PyDict_SetItemString(py_stats, "hit_rate", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(Lookups > 0 ? (double)Cache->Misses / (double)Lookups : 0);
+	PyDict_SetItemString(py_stats, "miss_rate", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(Cache->NumEntries());
+	PyDict_SetItemString(py_stats, "entries", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->Invalidations);
+	PyDict_SetItemString(py_stats, "invalidations", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_reset_attribute_cache_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonAttributeCache::Get()->ResetStats();
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_flush_attribute_cache(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,74 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+
+// cache of the reflection lookups done by ue_PyUObject_getattro/setattro
+// entries are keyed by (owner, interned python string): the owner is the UClass
+// for plain UObjects, while UStruct/UEnum wrappers use the wrapped object itself
+
+enum class EUEPyCachedAttributeKind : uint8
+{
+	Property,
+	Function,
+	EnumValue,
+};
+
+struct FUEPyCachedAttribute
+{
+	EUEPyCachedAttributeKind Kind;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FProperty *Property;
+#else
+	UProperty *Property;
+#endif
+	UFunction *Function;
+	int64 EnumValue;
+};
+
+class FUnrealEnginePythonAttributeCache
+{
+	struct FAttributeCacheBucket
+	{
+		FWeakObjectPtr Owner;
+		TMap<PyObject *, FUEPyCachedAttribute> Attributes;
+
+		FAttributeCacheBucket(UObject *InOwner) : Owner(InOwner)
+		{
+		}
+	};
+
+public:
+	static FUnrealEnginePythonAttributeCache *Get();
+
+	// Object is the UObject wrapped by the ue_PyUObject being accessed
+	// the python string must be interned, otherwise the lookup is always a miss
+	const FUEPyCachedAttribute *Find(UObject *Object, PyObject *PyName);
+	void Add(UObject *Object, PyObject *PyName, const FUEPyCachedAttribute &Attribute);
+
+	// drop every entry (classes recompiled, hot reloaded or regenerated by python)
+	void Invalidate();
+
+	void ResetStats();
+	int32 NumEntries() const;
+
+	uint64 Hits;
+	uint64 Misses;
+	uint64 Invalidations;
+
+private:
+	TMap<UObject *, FAttributeCacheBucket> &GetCacheForObject(UObject *Object, UObject *&Owner);
+	void RunGCDelegate();
+	void RegisterEditorDelegates();
+	void ReleaseBucket(FAttributeCacheBucket &Bucket);
+
+	// plain UObjects, keyed by UClass
+	TMap<UObject *, FAttributeCacheBucket> InstancesCache;
+	// UClass/UScriptStruct/UEnum wrappers, keyed by the wrapped object
+	TMap<UObject *, FAttributeCacheBucket> TypesCache;
+};
+
+PyObject *py_unreal_engine_get_attribute_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_reset_attribute_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_attribute_cache(PyObject *, PyObject *);
@@ -0,0 +1,262 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyCallPlan.h"
+
+FUEPyFunctionCallPlan::~FUEPyFunctionCallPlan()
+{
+	for (FUEPyCallPlanParam &Param : Params)
+	{
+		Py_XDECREF(Param.PyName);
+	}
+}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+static void ue_py_import_param_default(FProperty *prop, const FString &value, uint8 *buffer)
+#else
+static void ue_py_import_param_default(UProperty *prop, const FString &value, uint8 *buffer)
+#endif
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 17)
+	prop->ImportText_Direct(*value, prop->ContainerPtrToValuePtr<uint8>(buffer), NULL, PPF_None);
+#else
+	prop->ImportText(*value, prop->ContainerPtrToValuePtr<uint8>(buffer), PPF_Localized, NULL);
+#endif
+}
+
+void FUEPyFunctionCallPlan::PrepareBuffer(uint8 *Buffer) const
+{
+	FMemory::Memcpy(Buffer, Template.GetData(), ParmsSize);
+	for (auto *Prop : InitParams)
+	{
+		Prop->InitializeValue_InContainer(Buffer);
+	}
+	for (const auto &Pair : TextDefaults)
+	{
+		ue_py_import_param_default(Pair.Key, Pair.Value, Buffer);
+	}
+}
+
+void FUEPyFunctionCallPlan::DestroyBuffer(uint8 *Buffer) const
+{
+	for (auto *Prop : DestroyParams)
+	{
+		Prop->DestroyValue_InContainer(Buffer);
+	}
+}
+
+FUnrealEnginePythonCallPlans *FUnrealEnginePythonCallPlans::Get()
+{
+	static FUnrealEnginePythonCallPlans *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonCallPlans();
+		Singleton->bEnabled = true;
+		Singleton->ResetStats();
+		// functions can be garbage collected (and their memory reused), drop their plans
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(Singleton, &FUnrealEnginePythonCallPlans::RunGCDelegate);
+#else
+		FCoreUObjectDelegates::PostGarbageCollect.AddRaw(Singleton, &FUnrealEnginePythonCallPlans::RunGCDelegate);
+#endif
+	}
+	return Singleton;
+}
+
+TSharedPtr<FUEPyFunctionCallPlan> FUnrealEnginePythonCallPlans::FindOrBuild(UFunction *Function)
+{
+	if (!bEnabled)
+		return nullptr;
+
+	TSharedPtr<FUEPyFunctionCallPlan> *Plan = Plans.Find(Function);
+	// the weak pointer catches a new function allocated at the address of a collected one
+	if (Plan && (*Plan)->Function.Get() == Function)
+	{
+		Hits++;
+		return *Plan;
+	}
+
+	Misses++;
+	TSharedPtr<FUEPyFunctionCallPlan> NewPlan = Build(Function);
+	if (NewPlan.IsValid())
+	{
+		Plans.Add(Function, NewPlan);
+	}
+	else
+	{
+		Plans.Remove(Function);
+	}
+	return NewPlan;
+}
+
+TSharedPtr<FUEPyFunctionCallPlan> FUnrealEnginePythonCallPlans::Build(UFunction *Function)
+{
+	TSharedPtr<FUEPyFunctionCallPlan> Plan = MakeShareable(new FUEPyFunctionCallPlan(Function));
+	Plan->Template.AddZeroed(Function->ParmsSize);
+	uint8 *Template = Plan->Template.GetData();
+
+	bool bAfterReturn = false;
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		FProperty *Prop = *It;
+#else
+	for (TFieldIterator<UProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		UProperty *Prop = *It;
+#endif
+		// let the reflection based path report the error
+		if (!Prop->IsInContainer(Function->ParmsSize))
+			return nullptr;
+
+		bool bIsPOD = Prop->HasAnyPropertyFlags(CPF_IsPlainOldData);
+		if (bIsPOD)
+		{
+			if (!Prop->HasAnyPropertyFlags(CPF_ZeroConstructor))
+			{
+				Prop->InitializeValue_InContainer(Template);
+			}
+		}
+		else if (!Prop->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			Plan->InitParams.Add(Prop);
+		}
+
+		if (!Prop->HasAnyPropertyFlags(CPF_NoDestructor))
+		{
+			Plan->DestroyParams.Add(Prop);
+		}
+
+		if (Prop->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			if (!Plan->ReturnProperty)
+			{
+				Plan->ReturnProperty = Prop;
+			}
+			bAfterReturn = true;
+			continue;
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+		if (Prop->HasAnyPropertyFlags(CPF_OutParm) && (Prop->IsA<FArrayProperty>() || !Prop->HasAnyPropertyFlags(CPF_ConstParm)))
+#else
+		if (Prop->HasAnyPropertyFlags(CPF_OutParm) && (Prop->IsA<UArrayProperty>() || !Prop->HasAnyPropertyFlags(CPF_ConstParm)))
+#endif
+		{
+			Plan->OutParams.Add(Prop);
+		}
+
+#if WITH_EDITOR
+		FString DefaultValue = Function->GetMetaData(FName(*(FString("CPP_Default_") + Prop->GetName())));
+		if (!DefaultValue.IsEmpty())
+		{
+			// object references in the template would not be seen by the GC
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+			if (bIsPOD && !Prop->IsA<FObjectPropertyBase>())
+#else
+			if (bIsPOD && !Prop->IsA<UObjectPropertyBase>())
+#endif
+			{
+				ue_py_import_param_default(Prop, DefaultValue, Template);
+			}
+			else
+			{
+				Plan->TextDefaults.Emplace(Prop, DefaultValue);
+			}
+		}
+#endif
+
+		// args after the return value are never filled from python
+		if (!bAfterReturn)
+		{
+			FUEPyCallPlanParam Param;
+			Param.Property = Prop;
+#if PY_MAJOR_VERSION >= 3
+			Param.PyName = PyUnicode_InternFromString(TCHAR_TO_UTF8(*Prop->GetName()));
+#else
+			Param.PyName = PyString_InternFromString(TCHAR_TO_UTF8(*Prop->GetName()));
+#endif
+			if (!Param.PyName)
+			{
+				PyErr_Clear();
+				return nullptr;
+			}
+			Plan->Params.Add(Param);
+		}
+	}
+
+	return Plan;
+}
+
+void FUnrealEnginePythonCallPlans::Invalidate()
+{
+	Plans.Empty();
+}
+
+void FUnrealEnginePythonCallPlans::RunGCDelegate()
+{
+	FScopePythonGIL gil;
+	for (auto It = Plans.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->Function.IsValid(true))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FUnrealEnginePythonCallPlans::ResetStats()
+{
+	Hits = 0;
+	Misses = 0;
+}
+
+PyObject *py_unreal_engine_set_ufunction_call_plans(PyObject * self, PyObject * args)
+{
+	PyObject *py_bool = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:set_ufunction_call_plans", &py_bool))
+	{
+		return nullptr;
+	}
+
+	FUnrealEnginePythonCallPlans *CallPlans = FUnrealEnginePythonCallPlans::Get();
+	CallPlans->bEnabled = !py_bool || PyObject_IsTrue(py_bool);
+	if (!CallPlans->bEnabled)
+	{
+		CallPlans->Invalidate();
+	}
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_get_ufunction_call_plan_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonCallPlans *CallPlans = FUnrealEnginePythonCallPlans::Get();
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyBool_FromLong(CallPlans->bEnabled);
+	PyDict_SetItemString(py_stats, "enabled", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(CallPlans->Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(CallPlans->Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(CallPlans->NumPlans());
+	PyDict_SetItemString(py_stats, "plans", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_flush_ufunction_call_plans(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonCallPlans *CallPlans = FUnrealEnginePythonCallPlans::Get();
+	CallPlans->Invalidate();
+	CallPlans->ResetStats();
+	Py_RETURN_NONE;
+}
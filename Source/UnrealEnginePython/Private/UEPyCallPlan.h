@@ -0,0 +1,89 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+
+// per-UFunction call plans used by py_ue_ufunction_call
+// a plan is computed the first time a function is called from python and stores
+// everything that does not depend on the actual arguments: parameter layout,
+// interned kwargs names and a template buffer with the default values already imported
+
+struct FUEPyCallPlanParam
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FProperty *Property;
+#else
+	UProperty *Property;
+#endif
+	// interned property name, used for kwargs lookups
+	PyObject *PyName;
+};
+
+struct FUEPyFunctionCallPlan
+{
+	FWeakObjectPtr Function;
+	int32 ParmsSize;
+
+	// input params (everything before the return value) in declaration order
+	TArray<FUEPyCallPlanParam> Params;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FProperty *ReturnProperty;
+	// out params returned to python (return value excluded)
+	TArray<FProperty *> OutParams;
+	// non POD params that must be constructed on every call
+	TArray<FProperty *> InitParams;
+	// params with a destructor
+	TArray<FProperty *> DestroyParams;
+	// defaults that cannot live in the template (it cannot own memory or object references)
+	TArray<TPair<FProperty *, FString>> TextDefaults;
+#else
+	UProperty *ReturnProperty;
+	TArray<UProperty *> OutParams;
+	TArray<UProperty *> InitParams;
+	TArray<UProperty *> DestroyParams;
+	TArray<TPair<UProperty *, FString>> TextDefaults;
+#endif
+
+	// ParmsSize bytes, POD params are already initialized and hold their defaults
+	TArray<uint8> Template;
+
+	FUEPyFunctionCallPlan(UFunction *InFunction) : Function(InFunction), ParmsSize(InFunction->ParmsSize), ReturnProperty(nullptr)
+	{
+	}
+
+	// releases the interned names, requires the GIL
+	~FUEPyFunctionCallPlan();
+
+	// copy the template into Buffer and finish the initialization of the non POD params
+	void PrepareBuffer(uint8 *Buffer) const;
+	void DestroyBuffer(uint8 *Buffer) const;
+};
+
+class FUnrealEnginePythonCallPlans
+{
+public:
+	static FUnrealEnginePythonCallPlans *Get();
+
+	// returns an invalid pointer when plans are disabled or the function cannot be planned,
+	// the caller must fallback to the reflection based path
+	TSharedPtr<FUEPyFunctionCallPlan> FindOrBuild(UFunction *Function);
+
+	void Invalidate();
+	void ResetStats();
+
+	bool bEnabled;
+	uint64 Hits;
+	uint64 Misses;
+	int32 NumPlans() const { return Plans.Num(); }
+
+private:
+	TSharedPtr<FUEPyFunctionCallPlan> Build(UFunction *Function);
+	void RunGCDelegate();
+
+	TMap<UFunction *, TSharedPtr<FUEPyFunctionCallPlan>> Plans;
+};
+
+PyObject *py_unreal_engine_set_ufunction_call_plans(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_ufunction_call_plan_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_ufunction_call_plans(PyObject *, PyObject *);
@@ -9,7 +9,7 @@ static void ue_pycallable_dealloc(ue_PyCallable *self)
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
-static PyObject* ue_pycallable_call(ue_PyCallable *self, PyObject *args, PyObject *kw)
+static bool ue_pycallable_is_valid(ue_PyCallable *self)
 {
 	if (!self->u_function ||
 		!self->u_target ||
@@ -22,6 +22,15 @@ static PyObject* ue_pycallable_call(ue_PyCallable *self, PyObject *args, PyObjec
 		self->u_function->IsPendingKillOrUnreachable() ||
 		self->u_target->IsPendingKillOrUnreachable())
 #endif
+	{
+		return false;
+	}
+	return true;
+}
+
+static PyObject* ue_pycallable_call(ue_PyCallable *self, PyObject *args, PyObject *kw)
+{
+	if (!ue_pycallable_is_valid(self))
 	{
 		return PyErr_Format(PyExc_Exception, "UFunction/UObject is in invalid state for python callable");
 	}
@@ -29,6 +38,18 @@ static PyObject* ue_pycallable_call(ue_PyCallable *self, PyObject *args, PyObjec
 	return py_ue_ufunction_call(self->u_function, self->u_target, args, 0, kw);
 }
 
+#if PY_VERSION_HEX >= 0x03080000
+static PyObject* ue_pycallable_vectorcall(ue_PyCallable *self, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+	if (!ue_pycallable_is_valid(self))
+	{
+		return PyErr_Format(PyExc_Exception, "UFunction/UObject is in invalid state for python callable");
+	}
+
+	return py_ue_ufunction_vectorcall(self->u_function, self->u_target, args, PyVectorcall_NARGS(nargsf), kwnames);
+}
+#endif
+
 static PyTypeObject ue_PyCallableType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.Callable", /* tp_name */
@@ -66,6 +87,17 @@ void ue_python_init_callable(PyObject *ue_module)
 {
 	ue_PyCallableType.tp_new = PyType_GenericNew;
 
+#if PY_VERSION_HEX >= 0x03080000
+	// calls from python skip the args tuple and the kwargs dict
+	ue_PyCallableType.tp_vectorcall_offset = offsetof(ue_PyCallable, vectorcall);
+	ue_PyCallableType.tp_call = PyVectorcall_Call;
+#if PY_VERSION_HEX >= 0x03090000
+	ue_PyCallableType.tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+#else
+	ue_PyCallableType.tp_flags |= _Py_TPFLAGS_HAVE_VECTORCALL;
+#endif
+#endif
+
 	if (PyType_Ready(&ue_PyCallableType) < 0)
 		return;
 
@@ -78,6 +110,9 @@ PyObject *py_ue_new_callable(UFunction *u_function, UObject *u_target)
 	ue_PyCallable *ret = (ue_PyCallable *)PyObject_New(ue_PyCallable, &ue_PyCallableType);
 	ret->u_function = u_function;
 	ret->u_target = u_target;
+#if PY_VERSION_HEX >= 0x03080000
+	ret->vectorcall = (vectorcallfunc)ue_pycallable_vectorcall;
+#endif
 	return (PyObject *)ret;
 }
 
@@ -10,6 +10,9 @@ typedef struct
 		/* Type-specific fields go here. */
 		UFunction *u_function;
 	UObject *u_target;
+#if PY_VERSION_HEX >= 0x03080000
+	vectorcallfunc vectorcall;
+#endif
 } ue_PyCallable;
 
 PyObject *py_ue_new_callable(UFunction *, UObject *);
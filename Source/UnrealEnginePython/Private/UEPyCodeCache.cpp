@@ -0,0 +1,336 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyCodeCache.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Hash/CityHash.h"
+
+#include "include/marshal.h"
+
+// strings are usually one-liners from the console or blueprints, the cache is simply dropped when full
+#define UEPY_CODE_CACHE_MAX_STRINGS 512
+
+// magic, flags (python >= 3.7), source mtime, source size (python >= 3.3)
+#if PY_VERSION_HEX >= 0x03070000
+#define UEPY_PYC_HEADER_SIZE 16
+#elif PY_MAJOR_VERSION >= 3
+#define UEPY_PYC_HEADER_SIZE 12
+#else
+#define UEPY_PYC_HEADER_SIZE 8
+#endif
+
+FUnrealEnginePythonCodeCache *FUnrealEnginePythonCodeCache::Get()
+{
+	static FUnrealEnginePythonCodeCache *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonCodeCache();
+		Singleton->Hits = 0;
+		Singleton->Misses = 0;
+		Singleton->DiskHits = 0;
+		Singleton->DiskWrites = 0;
+		Singleton->CompileTime = 0;
+		Singleton->CompileTimeSaved = 0;
+		Singleton->bPersistent = false;
+		Singleton->PersistentDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealEnginePython"), TEXT("CodeCache"));
+	}
+	return Singleton;
+}
+
+static uint32 ue_py_pyc_read_uint32(const uint8 *Data)
+{
+	return (uint32)Data[0] | ((uint32)Data[1] << 8) | ((uint32)Data[2] << 16) | ((uint32)Data[3] << 24);
+}
+
+static void ue_py_pyc_write_uint32(uint8 *Data, uint32 Value)
+{
+	Data[0] = Value & 0xff;
+	Data[1] = (Value >> 8) & 0xff;
+	Data[2] = (Value >> 16) & 0xff;
+	Data[3] = (Value >> 24) & 0xff;
+}
+
+PyObject *ue_py_code_from_pyc(const TArray<uint8> &Data, const FFileStatData *Source)
+{
+	if (Data.Num() < UEPY_PYC_HEADER_SIZE || ue_py_pyc_read_uint32(Data.GetData()) != (uint32)PyImport_GetMagicNumber())
+	{
+		PyErr_SetString(PyExc_RuntimeError, "Bad magic number in .pyc file");
+		return nullptr;
+	}
+
+	if (Source)
+	{
+		const uint8 *Header = Data.GetData() + UEPY_PYC_HEADER_SIZE - 4;
+#if PY_MAJOR_VERSION >= 3
+		bool bValid = ue_py_pyc_read_uint32(Header - 4) == (uint32)Source->ModificationTime.ToUnixTimestamp() && ue_py_pyc_read_uint32(Header) == (uint32)Source->FileSize;
+#else
+		bool bValid = ue_py_pyc_read_uint32(Header) == (uint32)Source->ModificationTime.ToUnixTimestamp();
+#endif
+		if (!bValid)
+		{
+			PyErr_SetString(PyExc_RuntimeError, "Stale .pyc file");
+			return nullptr;
+		}
+	}
+
+	PyObject *Code = PyMarshal_ReadObjectFromString((char *)Data.GetData() + UEPY_PYC_HEADER_SIZE, Data.Num() - UEPY_PYC_HEADER_SIZE);
+	if (!Code || !PyCode_Check(Code))
+	{
+		Py_XDECREF(Code);
+		PyErr_SetString(PyExc_RuntimeError, "Bad code object in .pyc file");
+		return nullptr;
+	}
+	return Code;
+}
+
+void FUnrealEnginePythonCodeCache::SetPersistent(bool bInPersistent)
+{
+	bPersistent = bInPersistent;
+	if (bPersistent)
+	{
+		IFileManager::Get().MakeDirectory(*PersistentDir, true);
+	}
+}
+
+FString FUnrealEnginePythonCodeCache::GetPersistentPath(const FString &Path) const
+{
+	FTCHARToUTF8 UTF8Path(*Path);
+	uint64 Hash = CityHash64(UTF8Path.Get(), UTF8Path.Length());
+	return FPaths::Combine(PersistentDir, FString::Printf(TEXT("%s.%016llx.pyc"), *FPaths::GetBaseFilename(Path), Hash));
+}
+
+PyObject *FUnrealEnginePythonCodeCache::LoadPersistent(const FString &Path, const FFileStatData &StatData)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *GetPersistentPath(Path), FILEREAD_Silent))
+		return nullptr;
+
+	PyObject *Code = ue_py_code_from_pyc(Data, &StatData);
+	if (!Code)
+	{
+		// stale or written by another python version, it will be overwritten
+		PyErr_Clear();
+		return nullptr;
+	}
+	DiskHits++;
+	return Code;
+}
+
+void FUnrealEnginePythonCodeCache::SavePersistent(const FString &Path, const FFileStatData &StatData, PyObject *Code)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_marshalled = PyMarshal_WriteObjectToString(Code, Py_MARSHAL_VERSION);
+	if (!py_marshalled)
+	{
+		PyErr_Clear();
+		return;
+	}
+
+	TArray<uint8> Data;
+	Data.AddZeroed(UEPY_PYC_HEADER_SIZE);
+	ue_py_pyc_write_uint32(Data.GetData(), (uint32)PyImport_GetMagicNumber());
+	// timestamp based pyc (flags = 0)
+	ue_py_pyc_write_uint32(Data.GetData() + UEPY_PYC_HEADER_SIZE - 8, (uint32)StatData.ModificationTime.ToUnixTimestamp());
+	ue_py_pyc_write_uint32(Data.GetData() + UEPY_PYC_HEADER_SIZE - 4, (uint32)StatData.FileSize);
+	Data.Append((uint8 *)PyBytes_AsString(py_marshalled), PyBytes_Size(py_marshalled));
+	Py_DECREF(py_marshalled);
+
+	if (FFileHelper::SaveArrayToFile(Data, *GetPersistentPath(Path)))
+	{
+		DiskWrites++;
+	}
+#endif
+}
+
+PyObject *FUnrealEnginePythonCodeCache::GetFileCode(const FString &Path)
+{
+	FFileStatData StatData = IFileManager::Get().GetStatData(*Path);
+	if (!StatData.bIsValid)
+	{
+		return PyErr_Format(PyExc_IOError, "unable to open file %s", TCHAR_TO_UTF8(*Path));
+	}
+
+	FFileEntry *Entry = Files.Find(Path);
+	if (Entry && Entry->TimeStamp == StatData.ModificationTime && Entry->Size == StatData.FileSize)
+	{
+		Hits++;
+		CompileTimeSaved += Entry->LoadTime;
+		Py_INCREF(Entry->Code);
+		return Entry->Code;
+	}
+
+	Misses++;
+
+	double StartTime = FPlatformTime::Seconds();
+
+	bool bIsPyc = Path.EndsWith(TEXT(".pyc"));
+	PyObject *Code = nullptr;
+	if (bPersistent && !bIsPyc)
+	{
+		Code = LoadPersistent(Path, StatData);
+	}
+
+	if (!Code)
+	{
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *Path))
+		{
+			return PyErr_Format(PyExc_IOError, "unable to read file %s", TCHAR_TO_UTF8(*Path));
+		}
+
+		if (bIsPyc)
+		{
+			Code = ue_py_code_from_pyc(Data, nullptr);
+		}
+		else
+		{
+			// the tokenizer takes care of newlines and coding cookies
+			Data.Add(0);
+			Code = Py_CompileString((char *)Data.GetData(), TCHAR_TO_UTF8(*Path), Py_file_input);
+			if (Code && bPersistent)
+			{
+				SavePersistent(Path, StatData, Code);
+			}
+		}
+
+		if (!Code)
+			return nullptr;
+	}
+
+	double LoadTime = FPlatformTime::Seconds() - StartTime;
+	CompileTime += LoadTime;
+
+	if (Entry)
+	{
+		Py_DECREF(Entry->Code);
+	}
+	else
+	{
+		Entry = &Files.Add(Path);
+	}
+	Entry->Code = Code;
+	Entry->TimeStamp = StatData.ModificationTime;
+	Entry->Size = StatData.FileSize;
+	Entry->LoadTime = LoadTime;
+
+	Py_INCREF(Code);
+	return Code;
+}
+
+PyObject *FUnrealEnginePythonCodeCache::GetStringCode(const char *Source)
+{
+	int32 Len = FCStringAnsi::Strlen(Source);
+	uint64 Hash = CityHash64(Source, Len);
+
+	FStringEntry *Entry = Strings.Find(Hash);
+	if (Entry && Entry->Source.Num() == Len + 1 && !FMemory::Memcmp(Entry->Source.GetData(), Source, Len))
+	{
+		Hits++;
+		CompileTimeSaved += Entry->LoadTime;
+		Py_INCREF(Entry->Code);
+		return Entry->Code;
+	}
+
+	Misses++;
+
+	double StartTime = FPlatformTime::Seconds();
+	PyObject *Code = Py_CompileString(Source, "<string>", Py_file_input);
+	if (!Code)
+		return nullptr;
+	double LoadTime = FPlatformTime::Seconds() - StartTime;
+	CompileTime += LoadTime;
+
+	if (Entry)
+	{
+		// hash collision, the newest string wins
+		Py_DECREF(Entry->Code);
+	}
+	else
+	{
+		if (Strings.Num() >= UEPY_CODE_CACHE_MAX_STRINGS)
+		{
+			for (TPair<uint64, FStringEntry> &Pair : Strings)
+			{
+				Py_DECREF(Pair.Value.Code);
+			}
+			Strings.Empty();
+		}
+		Entry = &Strings.Add(Hash);
+	}
+	Entry->Code = Code;
+	Entry->Source.SetNumUninitialized(Len + 1);
+	FMemory::Memcpy(Entry->Source.GetData(), Source, Len + 1);
+	Entry->LoadTime = LoadTime;
+
+	Py_INCREF(Code);
+	return Code;
+}
+
+void FUnrealEnginePythonCodeCache::Flush()
+{
+	for (TPair<FString, FFileEntry> &Pair : Files)
+	{
+		Py_DECREF(Pair.Value.Code);
+	}
+	Files.Empty();
+	for (TPair<uint64, FStringEntry> &Pair : Strings)
+	{
+		Py_DECREF(Pair.Value.Code);
+	}
+	Strings.Empty();
+	Hits = 0;
+	Misses = 0;
+	DiskHits = 0;
+	DiskWrites = 0;
+	CompileTime = 0;
+	CompileTimeSaved = 0;
+}
+
+PyObject *py_unreal_engine_get_code_cache_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonCodeCache *Cache = FUnrealEnginePythonCodeCache::Get();
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyBool_FromLong(Cache->IsPersistent());
+	PyDict_SetItemString(py_stats, "persistent", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->DiskHits);
+	PyDict_SetItemString(py_stats, "disk_hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Cache->DiskWrites);
+	PyDict_SetItemString(py_stats, "disk_writes", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(Cache->NumEntries());
+	PyDict_SetItemString(py_stats, "entries", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(Cache->CompileTime);
+	PyDict_SetItemString(py_stats, "compile_time", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(Cache->CompileTimeSaved);
+	PyDict_SetItemString(py_stats, "compile_time_saved", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_flush_code_cache(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonCodeCache::Get()->Flush();
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,66 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+
+// code objects compiled by FUnrealEnginePythonModule::RunFile and RunString
+// files are keyed by path and validated against their modification time and size,
+// strings are keyed by their hash. Compiled files can be persisted (as standard timestamp
+// based .pyc files) in Saved/UnrealEnginePython/CodeCache by setting PersistentCodeCache
+// in the [Python] section of the engine config.
+
+class FUnrealEnginePythonCodeCache
+{
+	struct FFileEntry
+	{
+		PyObject *Code;
+		FDateTime TimeStamp;
+		int64 Size;
+		// seconds spent to compile (or unmarshal) the code
+		double LoadTime;
+	};
+
+	struct FStringEntry
+	{
+		PyObject *Code;
+		TArray<ANSICHAR> Source;
+		double LoadTime;
+	};
+
+public:
+	static FUnrealEnginePythonCodeCache *Get();
+
+	// both return a new reference or nullptr with the python error set, require the GIL
+	PyObject *GetFileCode(const FString &Path);
+	PyObject *GetStringCode(const char *Source);
+
+	void SetPersistent(bool bInPersistent);
+	bool IsPersistent() const { return bPersistent; }
+	void Flush();
+
+	uint64 Hits;
+	uint64 Misses;
+	uint64 DiskHits;
+	uint64 DiskWrites;
+	double CompileTime;
+	double CompileTimeSaved;
+	int32 NumEntries() const { return Files.Num() + Strings.Num(); }
+
+private:
+	FString GetPersistentPath(const FString &Path) const;
+	PyObject *LoadPersistent(const FString &Path, const FFileStatData &StatData);
+	void SavePersistent(const FString &Path, const FFileStatData &StatData, PyObject *Code);
+
+	TMap<FString, FFileEntry> Files;
+	TMap<uint64, FStringEntry> Strings;
+	bool bPersistent;
+	FString PersistentDir;
+};
+
+// code object from the content of a .pyc file (magic number and header are validated),
+// Source is checked against the timestamp/size header when not null
+PyObject *ue_py_code_from_pyc(const TArray<uint8> &Data, const FFileStatData *Source);
+
+PyObject *py_unreal_engine_get_code_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_code_cache(PyObject *, PyObject *);
@@ -35,6 +35,7 @@
 #include "Wrappers/UEPyFARFilter.h"
 #include "Wrappers/UEPyFVector.h"
 #include "Wrappers/UEPyFAssetData.h"
+#include "Wrappers/UEPyFAssetLoadRequest.h"
 #include "Wrappers/UEPyFEditorViewportClient.h"
 #include "Wrappers/UEPyIAssetEditorInstance.h"
 #include "Editor/MainFrame/Public/Interfaces/IMainFrameModule.h"
@@ -1217,8 +1218,9 @@ PyObject *py_unreal_engine_get_assets_by_class(PyObject * self, PyObject * args)
 {
 	char *path;
 	PyObject *py_recursive = nullptr;
+	PyObject *py_return_asset_data = nullptr;
 
-	if (!PyArg_ParseTuple(args, "s|O:get_assets_by_class", &path, &py_recursive))
+	if (!PyArg_ParseTuple(args, "s|OO:get_assets_by_class", &path, &py_recursive, &py_return_asset_data))
 	{
 		return NULL;
 	}
@@ -1237,10 +1239,21 @@ PyObject *py_unreal_engine_get_assets_by_class(PyObject * self, PyObject * args)
 
 	PyObject *assets_list = PyList_New(0);
 
+	bool return_asset_data = false;
+	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
+		return_asset_data = true;
+
 	for (FAssetData asset : assets)
 	{
 		if (!asset.IsValid())
 			continue;
+		if (return_asset_data)
+		{
+			PyObject *ret = py_ue_new_fassetdata(asset);
+			PyList_Append(assets_list, ret);
+			Py_DECREF(ret);
+			continue;
+		}
 		ue_PyUObject *ret = ue_get_python_uobject(asset.GetAsset());
 		if (ret)
 		{
@@ -1251,6 +1264,140 @@ PyObject *py_unreal_engine_get_assets_by_class(PyObject * self, PyObject * args)
 	return assets_list;
 }
 
+// the registry query runs without the GIL, loading is done in batches by an FAssetLoadRequest
+static PyObject *ue_py_load_assets_async(TArray<FAssetData> &assets, PyObject *py_callback, int batch_size, int max_in_flight, PyObject *py_return_asset_data)
+{
+	assets.RemoveAll([](const FAssetData &asset) { return !asset.IsValid(); });
+
+	bool return_asset_data = false;
+	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
+		return_asset_data = true;
+
+	return py_ue_new_fasset_load_request(assets, py_callback, batch_size, max_in_flight, return_asset_data);
+}
+
+static bool ue_py_check_load_assets_async_args(PyObject *py_callback, int batch_size, int max_in_flight)
+{
+	if (!PyCallable_Check(py_callback))
+	{
+		PyErr_SetString(PyExc_Exception, "argument is not callable");
+		return false;
+	}
+
+	if (batch_size < 1 || max_in_flight < 1)
+	{
+		PyErr_SetString(PyExc_ValueError, "batch_size and max_in_flight must be greater than 0");
+		return false;
+	}
+
+	return true;
+}
+
+PyObject *py_unreal_engine_get_assets_async(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	char *path;
+	PyObject *py_callback;
+	PyObject *py_recursive = nullptr;
+	int batch_size = 32;
+	int max_in_flight = 64;
+	PyObject *py_return_asset_data = nullptr;
+
+	static char *kw_names[] = { (char *)"path", (char *)"callback", (char *)"recursive", (char *)"batch_size", (char *)"max_in_flight", (char *)"return_asset_data", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "sO|OiiO:get_assets_async", kw_names, &path, &py_callback, &py_recursive, &batch_size, &max_in_flight, &py_return_asset_data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_check_load_assets_async_args(py_callback, batch_size, max_in_flight))
+		return nullptr;
+
+	bool recursive = false;
+	if (py_recursive && PyObject_IsTrue(py_recursive))
+		recursive = true;
+
+	TArray<FAssetData> assets;
+	FName package_path = FName(UTF8_TO_TCHAR(path));
+
+	Py_BEGIN_ALLOW_THREADS;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().GetAssetsByPath(package_path, assets, recursive);
+	Py_END_ALLOW_THREADS;
+
+	return ue_py_load_assets_async(assets, py_callback, batch_size, max_in_flight, py_return_asset_data);
+}
+
+PyObject *py_unreal_engine_get_assets_by_class_async(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	char *path;
+	PyObject *py_callback;
+	PyObject *py_recursive = nullptr;
+	int batch_size = 32;
+	int max_in_flight = 64;
+	PyObject *py_return_asset_data = nullptr;
+
+	static char *kw_names[] = { (char *)"path", (char *)"callback", (char *)"recursive", (char *)"batch_size", (char *)"max_in_flight", (char *)"return_asset_data", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "sO|OiiO:get_assets_by_class_async", kw_names, &path, &py_callback, &py_recursive, &batch_size, &max_in_flight, &py_return_asset_data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_check_load_assets_async_args(py_callback, batch_size, max_in_flight))
+		return nullptr;
+
+	bool recursive = false;
+	if (py_recursive && PyObject_IsTrue(py_recursive))
+		recursive = true;
+
+	TArray<FAssetData> assets;
+	FTopLevelAssetPath class_path = FTopLevelAssetPath(UTF8_TO_TCHAR(path));
+
+	Py_BEGIN_ALLOW_THREADS;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().GetAssetsByClass(class_path, assets, recursive);
+	Py_END_ALLOW_THREADS;
+
+	return ue_py_load_assets_async(assets, py_callback, batch_size, max_in_flight, py_return_asset_data);
+}
+
+PyObject *py_unreal_engine_get_assets_by_filter_async(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *pyfilter;
+	PyObject *py_callback;
+	int batch_size = 32;
+	int max_in_flight = 64;
+	PyObject *py_return_asset_data = nullptr;
+
+	static char *kw_names[] = { (char *)"filter", (char *)"callback", (char *)"batch_size", (char *)"max_in_flight", (char *)"return_asset_data", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|iiO:get_assets_by_filter_async", kw_names, &pyfilter, &py_callback, &batch_size, &max_in_flight, &py_return_asset_data))
+	{
+		return nullptr;
+	}
+
+	ue_PyFARFilter *py_filter = py_ue_is_farfilter(pyfilter);
+	if (!py_filter)
+		return PyErr_Format(PyExc_Exception, "Arg is not a FARFilter");
+
+	if (!ue_py_check_load_assets_async_args(py_callback, batch_size, max_in_flight))
+		return nullptr;
+
+	FARFilter& Filter = py_filter->filter;
+
+	py_ue_sync_farfilter((PyObject *)py_filter);
+
+	TArray<FAssetData> assets;
+
+	Py_BEGIN_ALLOW_THREADS;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().SearchAllAssets(true);
+	AssetRegistryModule.Get().GetAssets(Filter, assets);
+	Py_END_ALLOW_THREADS;
+
+	return ue_py_load_assets_async(assets, py_callback, batch_size, max_in_flight, py_return_asset_data);
+}
+
 PyObject *py_unreal_engine_get_selected_assets(PyObject * self, PyObject * args)
 {
 
@@ -24,6 +24,9 @@ PyObject *py_unreal_engine_get_assets_by_package_name(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_selected_assets(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_assets_by_class(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_assets_by_filter(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_assets_async(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_assets_by_class_async(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_assets_by_filter_async(PyObject *, PyObject *, PyObject *);
 PyObject *py_unreal_engine_set_fbx_import_option(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_redraw_all_viewports(PyObject *, PyObject *);
@@ -1,6 +1,7 @@
 // Copyright 20Tab S.r.l.
 
 #include "UEPyEngine.h"
+#include "Wrappers/UEPyFGraphEvent.h"
 
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -777,11 +778,44 @@ PyObject* py_unreal_engine_slate_is_initialized(PyObject*, PyObject*)
 	Py_RETURN_FALSE;
 }
 
-PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject * self, PyObject * args)
+static bool ue_py_get_prerequisites(PyObject *py_prerequisites, FGraphEventArray &prerequisites)
+{
+	if (!py_prerequisites || py_prerequisites == Py_None)
+		return true;
+
+	PyObject *py_iter = PyObject_GetIter(py_prerequisites);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_TypeError, "prerequisites must be an iterable of FGraphEvent");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		ue_PyFGraphEvent *py_event = py_ue_is_fgraph_event(py_item);
+		Py_DECREF(py_item);
+		if (!py_event)
+		{
+			Py_DECREF(py_iter);
+			PyErr_SetString(PyExc_TypeError, "prerequisites must be an iterable of FGraphEvent");
+			return false;
+		}
+		prerequisites.Add(py_event->graph_event->Event);
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
+
+PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject * self, PyObject * args, PyObject *kwargs)
 {
 	PyObject *py_callable;
 	int named_thread = (int)ENamedThreads::GameThread;
-	if (!PyArg_ParseTuple(args, "O|i:create_and_dispatch_when_ready", &py_callable, &named_thread))
+	PyObject *py_prerequisites = nullptr;
+
+	static char *kw_names[] = { (char *)"callable", (char *)"named_thread", (char *)"prerequisites", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|iO:create_and_dispatch_when_ready", kw_names, &py_callable, &named_thread, &py_prerequisites))
 	{
 		return NULL;
 	}
@@ -789,31 +823,53 @@ PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject * self, PyObj
 	if (!PyCallable_Check(py_callable))
 		return PyErr_Format(PyExc_TypeError, "argument is not callable");
 
-	Py_INCREF(py_callable);
+	FGraphEventArray prerequisites;
+	if (!ue_py_get_prerequisites(py_prerequisites, prerequisites))
+		return nullptr;
 
+	return py_ue_new_fgraph_event(py_callable, prerequisites, (ENamedThreads::Type)named_thread);
+}
 
-	FGraphEventRef task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]() {
-		FScopePythonGIL gil;
-		PyObject *ret = PyObject_CallObject(py_callable, nullptr);
-		if (ret)
-		{
-			Py_DECREF(ret);
-		}
-		else
+PyObject *py_unreal_engine_create_and_dispatch_batch(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_callables;
+	int named_thread = (int)ENamedThreads::AnyThread;
+	PyObject *py_prerequisites = nullptr;
+
+	static char *kw_names[] = { (char *)"callables", (char *)"named_thread", (char *)"prerequisites", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|iO:create_and_dispatch_batch", kw_names, &py_callables, &named_thread, &py_prerequisites))
+	{
+		return NULL;
+	}
+
+	FGraphEventArray prerequisites;
+	if (!ue_py_get_prerequisites(py_prerequisites, prerequisites))
+		return nullptr;
+
+	PyObject *py_sequence = PySequence_Fast(py_callables, "argument is not an iterable of callables");
+	if (!py_sequence)
+		return nullptr;
+
+	Py_ssize_t num = PySequence_Fast_GET_SIZE(py_sequence);
+	PyObject **items = PySequence_Fast_ITEMS(py_sequence);
+	for (Py_ssize_t i = 0; i < num; i++)
+	{
+		if (!PyCallable_Check(items[i]))
 		{
-			unreal_engine_py_log_error();
+			Py_DECREF(py_sequence);
+			return PyErr_Format(PyExc_TypeError, "argument is not an iterable of callables");
 		}
-		Py_DECREF(py_callable);
-	}, TStatId(), nullptr, (ENamedThreads::Type)named_thread);
-
+	}
 
-	Py_BEGIN_ALLOW_THREADS;
-	FTaskGraphInterface::Get().WaitUntilTaskCompletes(task);
-	Py_END_ALLOW_THREADS;
-	// TODO Implement signal triggering in addition to WaitUntilTaskCompletes
-	// FTaskGraphInterface::Get().TriggerEventWhenTaskCompletes
+	PyObject *py_events = PyList_New(num);
+	for (Py_ssize_t i = 0; i < num; i++)
+	{
+		PyList_SET_ITEM(py_events, i, py_ue_new_fgraph_event(items[i], prerequisites, (ENamedThreads::Type)named_thread));
+	}
+	Py_DECREF(py_sequence);
 
-	Py_RETURN_NONE;
+	return py_events;
 }
 
 
@@ -67,7 +67,8 @@ PyObject *py_unreal_engine_new_class(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_mutable_default(PyObject *, PyObject *);
 
 
-PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject *, PyObject *);
+PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_create_and_dispatch_batch(PyObject *, PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_convert_relative_path_to_full(PyObject *, PyObject *);
 
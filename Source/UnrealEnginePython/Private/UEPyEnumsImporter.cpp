@@ -1,26 +1,19 @@
 #include "UEPyEnumsImporter.h"
+#include "UEPyTypesIndex.h"
 
 static PyObject *ue_PyEnumsImporter_getattro(ue_PyEnumsImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	if (PyUnicodeOrString_Check(attr_name))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
+		const char *attr = UEPyUnicode_AsUTF8(attr_name);
+		if (attr[0] != '_')
 		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UEnum *u_enum = FindFirstObjectSafe<UEnum>(UTF8_TO_TCHAR(attr));
-				if (u_enum)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_enum);
-				}
-			}
+			PyObject *py_u_enum = FUnrealEnginePythonTypesIndex::Get()->Find(EUEPyTypesIndexKind::Enum, attr_name);
+			if (py_u_enum)
+				return py_u_enum;
 		}
 	}
-	return py_attr;
+	return PyObject_GenericGetAttr((PyObject *)self, attr_name);
 }
 
 static PyTypeObject ue_PyEnumsImporterType = {
@@ -71,6 +71,13 @@
 #include "Wrappers/UEPyFRawAnimSequenceTrack.h"
 
 #include "Wrappers/UEPyFRandomStream.h"
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+#include "Wrappers/UEPyFPropertyArrayView.h"
+#endif
+#include "Wrappers/UEPyFVectorArray.h"
+#include "Wrappers/UEPyFTextureMipLock.h"
+#include "Wrappers/UEPyFRenderTargetReadback.h"
+#include "Wrappers/UEPyFGraphEvent.h"
 
 #include "Wrappers/UEPyFPythonOutputDevice.h"
 #if WITH_EDITOR
@@ -88,6 +95,13 @@
 #include "Wrappers/UEPyFFoliageInstance.h"
 
 #include "UEPyCallable.h"
+#include "UEPyAttributeCache.h"
+#include "UEPyCallPlan.h"
+#include "UEPyTickScheduler.h"
+#include "UEPyTypesIndex.h"
+#include "UEPyCodeCache.h"
+#include "UEPyObjectIterator.h"
+#include "UEPyAsyncio.h"
 #include "UEPyUClassesImporter.h"
 #include "UEPyEnumsImporter.h"
 #include "UEPyUStructsImporter.h"
@@ -101,8 +115,10 @@
 #if WITH_EDITOR
 #include "Wrappers/UEPyFSlowTask.h"
 #include "Wrappers/UEPyFAssetData.h"
+#include "Wrappers/UEPyFAssetLoadRequest.h"
 #include "Wrappers/UEPyFARFilter.h"
 #include "Wrappers/UEPyFRawMesh.h"
+#include "Wrappers/UEPyFMeshDescriptionBuilder.h"
 #include "Wrappers/UEPyFStringAssetReference.h"
 
 #include "UObject/UEPyAnimSequence.h"
@@ -167,6 +183,39 @@ static PyObject* py_unreal_engine_py_gc(PyObject* self, PyObject* args)
 
 }
 
+static PyObject* py_unreal_engine_get_housekeeper_stats(PyObject* self, PyObject* args)
+{
+	FUnrealEnginePythonHouseKeeper* HouseKeeper = FUnrealEnginePythonHouseKeeper::Get();
+
+	PyObject* py_stats = PyDict_New();
+
+	PyObject* py_value = PyLong_FromLong(HouseKeeper->NumPyUObjects());
+	PyDict_SetItemString(py_stats, "entries", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(HouseKeeper->NumRegistryChunks());
+	PyDict_SetItemString(py_stats, "chunks", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(HouseKeeper->Reclaimed);
+	PyDict_SetItemString(py_stats, "reclaimed", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(HouseKeeper->Sweeps);
+	PyDict_SetItemString(py_stats, "sweeps", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(HouseKeeper->LastSweepTime);
+	PyDict_SetItemString(py_stats, "last_sweep_time", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(HouseKeeper->TotalSweepTime);
+	PyDict_SetItemString(py_stats, "total_sweep_time", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
+
 static PyObject* py_unreal_engine_exec(PyObject* self, PyObject* args)
 {
 	char* filename = nullptr;
@@ -399,6 +448,9 @@ static PyMethodDef unreal_engine_methods[] = {
 #pragma warning(disable: 4191)
 #endif
 	{ "get_assets_by_filter", (PyCFunction)py_unreal_engine_get_assets_by_filter, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "get_assets_async", (PyCFunction)py_unreal_engine_get_assets_async, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "get_assets_by_class_async", (PyCFunction)py_unreal_engine_get_assets_by_class_async, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "get_assets_by_filter_async", (PyCFunction)py_unreal_engine_get_assets_by_filter_async, METH_VARARGS | METH_KEYWORDS, "" },
 	{ "create_blueprint", py_unreal_engine_create_blueprint, METH_VARARGS, "" },
 	{ "create_blueprint_from_actor", py_unreal_engine_create_blueprint_from_actor, METH_VARARGS, "" },
 	{ "replace_blueprint", py_unreal_engine_replace_blueprint, METH_VARARGS, "" },
@@ -467,13 +519,31 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "all_classes", (PyCFunction)py_unreal_engine_all_classes, METH_VARARGS, "" },
 	{ "all_worlds", (PyCFunction)py_unreal_engine_all_worlds, METH_VARARGS, "" },
 	{ "tobject_iterator", (PyCFunction)py_unreal_engine_tobject_iterator, METH_VARARGS, "" },
+	{ "iter_objects", (PyCFunction)py_unreal_engine_iter_objects, METH_VARARGS | METH_KEYWORDS, "" },
 
 	{ "new_class", py_unreal_engine_new_class, METH_VARARGS, "" },
 
 
 	{ "can_ever_render", py_unreal_engine_can_ever_render, METH_VARARGS, "" },
 	{ "slate_is_initialized", py_unreal_engine_slate_is_initialized, METH_VARARGS, "" },
-	{ "create_and_dispatch_when_ready", py_unreal_engine_create_and_dispatch_when_ready, METH_VARARGS, "" },
+	{ "create_and_dispatch_when_ready", (PyCFunction)py_unreal_engine_create_and_dispatch_when_ready, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "create_and_dispatch_batch", (PyCFunction)py_unreal_engine_create_and_dispatch_batch, METH_VARARGS | METH_KEYWORDS, "" },
+#if PY_MAJOR_VERSION >= 3
+	{ "get_event_loop", py_unreal_engine_get_event_loop, METH_VARARGS, "" },
+	{ "new_event_loop", (PyCFunction)py_unreal_engine_new_event_loop, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "next_frame", py_unreal_engine_next_frame, METH_VARARGS, "" },
+	{ "world_timer", py_unreal_engine_world_timer, METH_VARARGS, "" },
+	{ "latent_action", py_unreal_engine_latent_action, METH_VARARGS, "" },
+#endif
+	{ "process_http_requests", (PyCFunction)py_unreal_engine_process_http_requests, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "tcp_listen", py_unreal_engine_tcp_listen, METH_VARARGS, "" },
+	{ "tcp_connect", py_unreal_engine_tcp_connect, METH_VARARGS, "" },
+	{ "get_actor_transforms", (PyCFunction)py_unreal_engine_get_actor_transforms, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "set_actor_transforms", (PyCFunction)py_unreal_engine_set_actor_transforms, METH_VARARGS | METH_KEYWORDS, "" },
+#if WITH_EDITOR
+	{ "get_soft_skin_vertex_dtype", py_unreal_engine_get_soft_skin_vertex_dtype, METH_VARARGS, "" },
+	{ "get_morph_target_delta_dtype", py_unreal_engine_get_morph_target_delta_dtype, METH_VARARGS, "" },
+#endif
 #if PLATFORM_MAC
 	{ "main_thread_call", py_unreal_engine_main_thread_call, METH_VARARGS, "" },
 #endif
@@ -482,6 +552,23 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "remove_ticker", py_unreal_engine_remove_ticker, METH_VARARGS, "" },
 
 	{ "py_gc", py_unreal_engine_py_gc, METH_VARARGS, "" },
+	{ "get_housekeeper_stats", py_unreal_engine_get_housekeeper_stats, METH_VARARGS, "" },
+
+	{ "get_attribute_cache_stats", py_unreal_engine_get_attribute_cache_stats, METH_VARARGS, "" },
+	{ "reset_attribute_cache_stats", py_unreal_engine_reset_attribute_cache_stats, METH_VARARGS, "" },
+	{ "flush_attribute_cache", py_unreal_engine_flush_attribute_cache, METH_VARARGS, "" },
+
+	{ "set_ufunction_call_plans", py_unreal_engine_set_ufunction_call_plans, METH_VARARGS, "" },
+	{ "get_ufunction_call_plan_stats", py_unreal_engine_get_ufunction_call_plan_stats, METH_VARARGS, "" },
+	{ "flush_ufunction_call_plans", py_unreal_engine_flush_ufunction_call_plans, METH_VARARGS, "" },
+	{ "get_uscriptstruct_freelist_stats", py_unreal_engine_get_uscriptstruct_freelist_stats, METH_VARARGS, "" },
+	{ "flush_uscriptstruct_freelists", py_unreal_engine_flush_uscriptstruct_freelists, METH_VARARGS, "" },
+	{ "get_types_index_stats", py_unreal_engine_get_types_index_stats, METH_VARARGS, "" },
+	{ "get_code_cache_stats", py_unreal_engine_get_code_cache_stats, METH_VARARGS, "" },
+	{ "flush_code_cache", py_unreal_engine_flush_code_cache, METH_VARARGS, "" },
+	{ "get_python_function_stats", py_unreal_engine_get_python_function_stats, METH_VARARGS, "" },
+	{ "set_python_tick_budget", py_unreal_engine_set_python_tick_budget, METH_VARARGS, "" },
+	{ "get_python_tick_scheduler_stats", py_unreal_engine_get_python_tick_scheduler_stats, METH_VARARGS, "" },
 	// exec is a reserved keyword in python2
 #if PY_MAJOR_VERSION >= 3
 	{ "exec", py_unreal_engine_exec, METH_VARARGS, "" },
@@ -616,6 +703,7 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "get_uproperty", (PyCFunction)py_ue_get_uproperty, METH_VARARGS, "" },
 #endif
 	{ "get_property_struct", (PyCFunction)py_ue_get_property_struct, METH_VARARGS, "" },
+	{ "get_property_array_view", (PyCFunction)py_ue_get_property_array_view, METH_VARARGS, "" },
 	{ "get_property_array_dim", (PyCFunction)py_ue_get_property_array_dim, METH_VARARGS, "" },
 	{ "get_inner", (PyCFunction)py_ue_get_inner, METH_VARARGS, "" },
 	{ "get_key_prop", (PyCFunction)py_ue_get_key_prop, METH_VARARGS, "" },
@@ -769,11 +857,17 @@ static PyMethodDef ue_PyUObject_methods[] = {
 #ifdef _MSC_VER
 #pragma warning(disable: 4191)
 #endif
+#if PY_VERSION_HEX >= 0x03080000
+	{ "call_function", (PyCFunction)py_ue_call_function, METH_FASTCALL | METH_KEYWORDS, "" },
+#else
 	{ "call_function", (PyCFunction)py_ue_call_function, METH_VARARGS | METH_KEYWORDS, "" },
+#endif
 
 
 	{ "all_objects", (PyCFunction)py_ue_all_objects, METH_VARARGS, "" },
 	{ "all_actors", (PyCFunction)py_ue_all_actors, METH_VARARGS, "" },
+	{ "iter_objects", (PyCFunction)py_ue_iter_objects, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "iter_actors", (PyCFunction)py_ue_iter_actors, METH_VARARGS | METH_KEYWORDS, "" },
 
 
 	// Package
@@ -1111,6 +1205,7 @@ static PyMethodDef ue_PyUObject_methods[] = {
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 12)
 	{ "skeletal_mesh_set_soft_vertices", (PyCFunction)py_ue_skeletal_mesh_set_soft_vertices, METH_VARARGS, "" },
 	{ "skeletal_mesh_get_soft_vertices", (PyCFunction)py_ue_skeletal_mesh_get_soft_vertices, METH_VARARGS, "" },
+	{ "skeletal_mesh_get_soft_vertices_buffer", (PyCFunction)py_ue_skeletal_mesh_get_soft_vertices_buffer, METH_VARARGS, "" },
 	{ "skeletal_mesh_get_max_bone_influences", (PyCFunction)py_ue_skeletal_mesh_get_max_bone_influences, METH_VARARGS, "" },
 #endif
 	{ "skeletal_mesh_get_lod", (PyCFunction)py_ue_skeletal_mesh_get_lod, METH_VARARGS, "" },
@@ -1138,12 +1233,14 @@ static PyMethodDef ue_PyUObject_methods[] = {
 #endif
 #if WITH_EDITOR
 	{ "skeletal_mesh_register_morph_target", (PyCFunction)py_ue_skeletal_mesh_register_morph_target, METH_VARARGS, "" },
+	{ "skeletal_mesh_import_morph_targets", (PyCFunction)py_ue_skeletal_mesh_import_morph_targets, METH_VARARGS, "" },
 
 
 	{ "skeletal_mesh_to_import_vertex_map", (PyCFunction)py_ue_skeletal_mesh_to_import_vertex_map, METH_VARARGS, "" },
 
 	{ "morph_target_populate_deltas", (PyCFunction)py_ue_morph_target_populate_deltas, METH_VARARGS, "" },
 	{ "morph_target_get_deltas", (PyCFunction)py_ue_morph_target_get_deltas, METH_VARARGS, "" },
+	{ "morph_target_get_deltas_buffer", (PyCFunction)py_ue_morph_target_get_deltas_buffer, METH_VARARGS, "" },
 #endif
 	// Timer
 	{ "set_timer", (PyCFunction)py_ue_set_timer, METH_VARARGS, "" },
@@ -1157,6 +1254,10 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "texture_has_alpha_channel", (PyCFunction)py_ue_texture_has_alpha_channel, METH_VARARGS, "" },
 	{ "render_target_get_data", (PyCFunction)py_ue_render_target_get_data, METH_VARARGS, "" },
 	{ "render_target_get_data_to_buffer", (PyCFunction)py_ue_render_target_get_data_to_buffer, METH_VARARGS, "" },
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+	{ "render_target_read_async", (PyCFunction)py_ue_render_target_read_async, METH_VARARGS, "" },
+#endif
+	{ "texture_lock_mip", (PyCFunction)py_ue_texture_lock_mip, METH_VARARGS, "" },
 	{ "texture_update_resource", (PyCFunction)py_ue_texture_update_resource, METH_VARARGS, "" },
 	{ "texture_get_num_mips", (PyCFunction)py_ue_texture_get_num_mips, METH_VARARGS, "" },
 	{ "texture_get_platform_size", (PyCFunction)py_ue_texture_get_platform_size, METH_VARARGS, "" },
@@ -1293,13 +1394,44 @@ static void ue_pyobject_dealloc(ue_PyUObject* self)
 	Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
+static PyObject* ue_py_resolve_cached_attribute(ue_PyUObject* self, const FUEPyCachedAttribute* attribute)
+{
+	switch (attribute->Kind)
+	{
+	case EUEPyCachedAttributeKind::Property:
+		return ue_py_convert_property(attribute->Property, (uint8*)self->ue_object, 0);
+	case EUEPyCachedAttributeKind::Function:
+		return py_ue_new_callable(attribute->Function, self->ue_object);
+	case EUEPyCachedAttributeKind::EnumValue:
+		return PyLong_FromLongLong(attribute->EnumValue);
+	}
+	return PyErr_Format(PyExc_Exception, "invalid cached attribute");
+}
+
 static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 {
 	ue_py_check(self);
 
+	FUnrealEnginePythonAttributeCache* attribute_cache = FUnrealEnginePythonAttributeCache::Get();
+	const FUEPyCachedAttribute* cached_attribute = attribute_cache->Find(self->ue_object, attr_name);
+	// cached names are never type attributes and cannot be stored in the __dict__ by setattro,
+	// so the generic lookup can be skipped (python subclasses could shadow them, they keep the standard order)
+	if (cached_attribute && !PyType_HasFeature(Py_TYPE(self), Py_TPFLAGS_HEAPTYPE) && (!self->py_dict || !PyDict_GetItem(self->py_dict, attr_name)))
+	{
+		return ue_py_resolve_cached_attribute(self, cached_attribute);
+	}
+
 	PyObject* ret = PyObject_GenericGetAttr((PyObject*)self, attr_name);
 	if (!ret)
 	{
+		if (cached_attribute)
+		{
+			// swallow previous exception
+			PyErr_Clear();
+			return ue_py_resolve_cached_attribute(self, cached_attribute);
+		}
+
+		FUEPyCachedAttribute new_attribute = {};
 		if (PyUnicodeOrString_Check(attr_name))
 		{
 			const char* attr = UEPyUnicode_AsUTF8(attr_name);
@@ -1320,6 +1452,9 @@ static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 			{
 				// swallow previous exception
 				PyErr_Clear();
+				new_attribute.Kind = EUEPyCachedAttributeKind::Property;
+				new_attribute.Property = f_property;
+				attribute_cache->Add(self->ue_object, attr_name, new_attribute);
 				return ue_py_convert_property(f_property, (uint8*)self->ue_object, 0);
 			}
 #else
@@ -1328,6 +1463,9 @@ static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 			{
 				// swallow previous exception
 				PyErr_Clear();
+				new_attribute.Kind = EUEPyCachedAttributeKind::Property;
+				new_attribute.Property = u_property;
+				attribute_cache->Add(self->ue_object, attr_name, new_attribute);
 				return ue_py_convert_property(u_property, (uint8*)self->ue_object, 0);
 			}
 #endif
@@ -1389,15 +1527,15 @@ static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 					PyErr_Clear();
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 15)
 					int32 value = u_enum->GetIndexByName(FName(UTF8_TO_TCHAR(attr)));
-					if (value == INDEX_NONE)
-						return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", attr);
-					return PyLong_FromLong(value);
 #else
 					int32 value = u_enum->FindEnumIndex(FName(UTF8_TO_TCHAR(attr)));
+#endif
 					if (value == INDEX_NONE)
 						return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", attr);
+					new_attribute.Kind = EUEPyCachedAttributeKind::EnumValue;
+					new_attribute.EnumValue = value;
+					attribute_cache->Add(self->ue_object, attr_name, new_attribute);
 					return PyLong_FromLong(value);
-#endif
 				}
 			}
 
@@ -1405,6 +1543,9 @@ static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 			{
 				// swallow previous exception
 				PyErr_Clear();
+				new_attribute.Kind = EUEPyCachedAttributeKind::Function;
+				new_attribute.Function = function;
+				attribute_cache->Add(self->ue_object, attr_name, new_attribute);
 				return py_ue_new_callable(function, self->ue_object);
 			}
 		}
@@ -1421,6 +1562,10 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 	{
 		const char* attr = UEPyUnicode_AsUTF8(attr_name);
 		EXTRA_UE_LOG(LogPython, Warning, TEXT("Setting attr  %s"), UTF8_TO_TCHAR(attr));
+		FUnrealEnginePythonAttributeCache* attribute_cache = FUnrealEnginePythonAttributeCache::Get();
+		const FUEPyCachedAttribute* cached_attribute = attribute_cache->Find(self->ue_object, attr_name);
+		FUEPyCachedAttribute new_attribute = {};
+		new_attribute.Kind = EUEPyCachedAttributeKind::Property;
 		// first check for property
 		UStruct* u_struct = nullptr;
 		if (self->ue_object->IsA<UStruct>())
@@ -1432,7 +1577,21 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 			u_struct = (UStruct*)self->ue_object->GetClass();
 		}
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
-		FProperty* f_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
+		FProperty* f_property = nullptr;
+		if (cached_attribute && cached_attribute->Kind == EUEPyCachedAttributeKind::Property)
+		{
+			f_property = cached_attribute->Property;
+		}
+		else
+		{
+			f_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
+			// like getattro, only names that are not type attributes (wrapper methods...) can be cached
+			if (f_property && !_PyType_Lookup(Py_TYPE(self), attr_name))
+			{
+				new_attribute.Property = f_property;
+				attribute_cache->Add(self->ue_object, attr_name, new_attribute);
+			}
+		}
 		if (f_property)
 		{
 #ifdef EXTRA_DEBUG_CODE
@@ -1451,6 +1610,12 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 				}
 			}
 #endif
+			// the array memory is exposed to python, it cannot be reallocated
+			if (ue_py_fpropertyarrayview_is_exported(self->ue_object, f_property))
+			{
+				PyErr_Format(PyExc_BufferError, "property %s is exported by an array view", attr);
+				return -1;
+			}
 #if WITH_EDITOR
 			self->ue_object->PreEditChange(f_property);
 #endif
@@ -1502,7 +1667,21 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 			return -1;
 		}
 #else
-		UProperty* u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
+		UProperty* u_property = nullptr;
+		if (cached_attribute && cached_attribute->Kind == EUEPyCachedAttributeKind::Property)
+		{
+			u_property = cached_attribute->Property;
+		}
+		else
+		{
+			u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
+			// like getattro, only names that are not type attributes (wrapper methods...) can be cached
+			if (u_property && !_PyType_Lookup(Py_TYPE(self), attr_name))
+			{
+				new_attribute.Property = u_property;
+				attribute_cache->Add(self->ue_object, attr_name, new_attribute);
+			}
+		}
 		if (u_property)
 		{
 #if WITH_EDITOR
@@ -1633,11 +1812,9 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 	{
 		UScriptStruct* u_script_struct = (UScriptStruct*)self->ue_object;
 		EXTRA_UE_LOG(LogPython, Warning, TEXT("Creating new UScriptStruct %s"), *u_script_struct->GetName());
-		uint8* data = (uint8*)FMemory::Malloc(u_script_struct->GetStructureSize());
-		u_script_struct->InitializeStruct(data);
-#if WITH_EDITOR
-		u_script_struct->InitializeDefaultValue(data);
-#endif
+		// small structs are stored in the wrapper itself (no heap allocation)
+		ue_PyUScriptStruct* py_struct = py_ue_new_default_uscriptstruct(u_script_struct);
+		uint8* data = py_struct->u_struct_ptr;
 		if (kw)
 		{
 			PyObject* struct_keys = PyObject_GetIter(kw);
@@ -1648,7 +1825,7 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (PyErr_Occurred())
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "unable to build struct from dictionary");
 					}
 					break;
@@ -1662,7 +1839,7 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (PyErr_Occurred())
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "unable to build struct from dictionary");
 					}
 					break;
@@ -1674,13 +1851,13 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (!ue_py_convert_pyobject(value, f_property, data, 0))
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "invalid value for FProperty");
 					}
 				}
 				else
 				{
-					FMemory::Free(data);
+					Py_DECREF(py_struct);
 					return PyErr_Format(PyExc_Exception, "FProperty %s not found", struct_key);
 				}
 #else
@@ -1689,19 +1866,19 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (!ue_py_convert_pyobject(value, u_property, data, 0))
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "invalid value for UProperty");
 					}
 				}
 				else
 				{
-					FMemory::Free(data);
+					Py_DECREF(py_struct);
 					return PyErr_Format(PyExc_Exception, "UProperty %s not found", struct_key);
 				}
 #endif
 			}
 		}
-		return py_ue_new_owned_uscriptstruct_zero_copy(u_script_struct, data);
+		return (PyObject*)py_struct;
 	}
 
 	return PyErr_Format(PyExc_Exception, "the specified uobject has no __call__ support");
@@ -2081,6 +2258,9 @@ UClass* unreal_engine_new_uclass(char* name, UClass* outer_parent)
 	}
 #endif
 
+	// properties and functions of the (re)generated class are new objects
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 	return new_object;
 }
 
@@ -2154,6 +2334,7 @@ void unreal_engine_init_py_module()
 	ue_python_init_fcolor(new_unreal_engine_module);
 	ue_python_init_flinearcolor(new_unreal_engine_module);
 	ue_python_init_fquat(new_unreal_engine_module);
+	ue_python_init_fvector_array(new_unreal_engine_module);
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
 	ue_python_init_fframe_number(new_unreal_engine_module);
@@ -2161,6 +2342,15 @@ void unreal_engine_init_py_module()
 
 	ue_python_init_frandomstream(new_unreal_engine_module);
 
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	ue_python_init_fpropertyarrayview(new_unreal_engine_module);
+#endif
+
+	ue_python_init_ftexture_mip_lock(new_unreal_engine_module);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+	ue_python_init_frender_target_readback(new_unreal_engine_module);
+#endif
+
 	ue_python_init_fraw_anim_sequence_track(new_unreal_engine_module);
 
 #if WITH_EDITOR
@@ -2182,6 +2372,11 @@ void unreal_engine_init_py_module()
 	ue_python_init_ftimerhandle(new_unreal_engine_module);
 
 	ue_python_init_fdelegatehandle(new_unreal_engine_module);
+	ue_python_init_tobject_iterator(new_unreal_engine_module);
+	ue_python_init_fgraph_event(new_unreal_engine_module);
+#if PY_MAJOR_VERSION >= 3
+	ue_python_init_asyncio(new_unreal_engine_module);
+#endif
 
 	ue_python_init_fsocket(new_unreal_engine_module);
 
@@ -2200,6 +2395,7 @@ void unreal_engine_init_py_module()
 	ue_python_init_swidget(new_unreal_engine_module);
 	ue_python_init_farfilter(new_unreal_engine_module);
 	ue_python_init_fassetdata(new_unreal_engine_module);
+	ue_python_init_fasset_load_request(new_unreal_engine_module);
 	ue_python_init_edgraphpin(new_unreal_engine_module);
 	ue_python_init_fstring_asset_reference(new_unreal_engine_module);
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 12)
@@ -2207,6 +2403,9 @@ void unreal_engine_init_py_module()
 #endif
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 13)
 	ue_python_init_fraw_mesh(new_unreal_engine_module);
+#endif
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	ue_python_init_fmesh_description_builder(new_unreal_engine_module);
 #endif
 	ue_python_init_iplugin(new_unreal_engine_module);
 #endif
@@ -2605,12 +2804,87 @@ AActor* ue_get_actor(ue_PyUObject* py_obj)
 }
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+// map a property to the converter used by ue_py_convert_property/ue_py_convert_pyobject
+// the order of the checks follows the FField hierarchy (e.g. FSoftClassProperty is a FSoftObjectProperty)
+static EUEPyPropertyKind ue_py_resolve_property_kind(FProperty* prop)
+{
+	if (prop->IsA<FBoolProperty>())
+		return EUEPyPropertyKind::Bool;
+	if (prop->IsA<FIntProperty>())
+		return EUEPyPropertyKind::Int;
+	if (prop->IsA<FUInt32Property>())
+		return EUEPyPropertyKind::UInt32;
+	if (prop->IsA<FInt64Property>())
+		return EUEPyPropertyKind::Int64;
+	if (prop->IsA<FUInt64Property>())
+		return EUEPyPropertyKind::UInt64;
+	if (prop->IsA<FFloatProperty>())
+		return EUEPyPropertyKind::Float;
+	if (prop->IsA<FDoubleProperty>())
+		return EUEPyPropertyKind::Double;
+	if (prop->IsA<FByteProperty>())
+		return EUEPyPropertyKind::Byte;
+	if (prop->IsA<FEnumProperty>())
+		return EUEPyPropertyKind::Enum;
+	if (prop->IsA<FStrProperty>())
+		return EUEPyPropertyKind::Str;
+	if (prop->IsA<FTextProperty>())
+		return EUEPyPropertyKind::Text;
+	if (prop->IsA<FNameProperty>())
+		return EUEPyPropertyKind::Name;
+	if (prop->IsA<FClassProperty>())
+		return EUEPyPropertyKind::Class;
+	if (prop->IsA<FSoftClassProperty>())
+		return EUEPyPropertyKind::SoftClass;
+	if (prop->IsA<FSoftObjectProperty>())
+		return EUEPyPropertyKind::SoftObject;
+	if (prop->IsA<FWeakObjectProperty>())
+		return EUEPyPropertyKind::WeakObject;
+	if (prop->IsA<FObjectPropertyBase>())
+		return EUEPyPropertyKind::Object;
+	if (prop->IsA<FInterfaceProperty>())
+		return EUEPyPropertyKind::Interface;
+	if (prop->IsA<FStructProperty>())
+		return EUEPyPropertyKind::Struct;
+	if (prop->IsA<FMulticastDelegateProperty>())
+		return EUEPyPropertyKind::MulticastDelegate;
+	if (prop->IsA<FDelegateProperty>())
+		return EUEPyPropertyKind::Delegate;
+	if (prop->IsA<FArrayProperty>())
+		return EUEPyPropertyKind::Array;
+	if (prop->IsA<FMapProperty>())
+		return EUEPyPropertyKind::Map;
+	if (prop->IsA<FSetProperty>())
+		return EUEPyPropertyKind::Set;
+	return EUEPyPropertyKind::Unsupported;
+}
+
+EUEPyPropertyKind ue_py_get_property_kind(FProperty* prop)
+{
+	// engine field classes are identified by their own CASTCLASS_ bit,
+	// so the kind is resolved only once per field class
+	static EUEPyPropertyKind kinds_by_class_id[64];
+
+	uint64 class_id = prop->GetClass()->GetId();
+	if (class_id == 0 || !FMath::IsPowerOfTwo(class_id))
+		return ue_py_resolve_property_kind(prop);
+
+	EUEPyPropertyKind& kind = kinds_by_class_id[FMath::CountTrailingZeros64(class_id)];
+	if (kind == EUEPyPropertyKind::Unresolved)
+	{
+		kind = ue_py_resolve_property_kind(prop);
+	}
+	return kind;
+}
+
 // convert a property to a python object
 PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 {
-	if (auto casted_prop = CastField<FBoolProperty>(prop))
+	switch (ue_py_get_property_kind(prop))
 	{
-		bool value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+	case EUEPyPropertyKind::Bool:
+	{
+		bool value = ((FBoolProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		if (value)
 		{
 			Py_RETURN_TRUE;
@@ -2618,77 +2892,82 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 		Py_RETURN_FALSE;
 	}
 
-	if (auto casted_prop = CastField<FIntProperty>(prop))
+	case EUEPyPropertyKind::Int:
 	{
-		int value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		int value = ((FIntProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyLong_FromLong(value);
 	}
 
-	if (auto casted_prop = CastField<FUInt32Property>(prop))
+	case EUEPyPropertyKind::UInt32:
 	{
-		uint32 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		uint32 value = ((FUInt32Property*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyLong_FromUnsignedLong(value);
 	}
 
-	if (auto casted_prop = CastField<FInt64Property>(prop))
+	case EUEPyPropertyKind::Int64:
 	{
-		long long value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		long long value = ((FInt64Property*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyLong_FromLongLong(value);
 	}
 
-	// this is likely a bug - it was a FInt64Property before
-	if (auto casted_prop = CastField<FUInt64Property>(prop))
+	case EUEPyPropertyKind::UInt64:
 	{
-		uint64 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		uint64 value = ((FUInt64Property*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyLong_FromUnsignedLongLong(value);
 	}
 
-	if (auto casted_prop = CastField<FFloatProperty>(prop))
+	case EUEPyPropertyKind::Float:
 	{
-		float value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		float value = ((FFloatProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyFloat_FromDouble(value);
 	}
 
-	if (auto casted_prop = CastField<FDoubleProperty>(prop))
+	case EUEPyPropertyKind::Double:
 	{
-		double value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		double value = ((FDoubleProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyFloat_FromDouble(value);
 	}
 
-	if (auto casted_prop = CastField<FByteProperty>(prop))
+	case EUEPyPropertyKind::Byte:
 	{
-		uint8 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		uint8 value = ((FByteProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyLong_FromUnsignedLong(value);
 	}
 
-	if (auto casted_prop = CastField<FEnumProperty>(prop))
+	case EUEPyPropertyKind::Enum:
 	{
+		FEnumProperty* casted_prop = (FEnumProperty*)prop;
 		void* prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
 		uint64 enum_index = casted_prop->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(prop_addr);
 		return PyLong_FromUnsignedLong(enum_index);
 	}
 
-	if (auto casted_prop = CastField<FStrProperty>(prop))
+	case EUEPyPropertyKind::Str:
 	{
-		FString value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		const FString& value = *((FStrProperty*)prop)->GetPropertyValuePtr_InContainer(buffer, index);
 		return PyUnicode_FromString(TCHAR_TO_UTF8(*value));
 	}
 
-	if (auto casted_prop = CastField<FTextProperty>(prop))
+	case EUEPyPropertyKind::Text:
 	{
-		FText value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		FText value = ((FTextProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
 	}
 
-	if (auto casted_prop = CastField<FNameProperty>(prop))
+	case EUEPyPropertyKind::Name:
 	{
-		FName value = casted_prop->GetPropertyValue_InContainer(buffer, index);
+		FName value = ((FNameProperty*)prop)->GetPropertyValue_InContainer(buffer, index);
 		return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
 	}
 
-	if (auto casted_prop = CastField<FObjectPropertyBase>(prop))
+	// class, soft and weak properties are all FObjectPropertyBase
+	case EUEPyPropertyKind::Class:
+	case EUEPyPropertyKind::SoftClass:
+	case EUEPyPropertyKind::SoftObject:
+	case EUEPyPropertyKind::WeakObject:
+	case EUEPyPropertyKind::Object:
 	{
-		auto value = casted_prop->GetObjectPropertyValue_InContainer(buffer, index);
+		auto value = ((FObjectPropertyBase*)prop)->GetObjectPropertyValue_InContainer(buffer, index);
 		if (value)
 		{
 			Py_RETURN_UOBJECT(value);
@@ -2696,19 +2975,10 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 		Py_RETURN_NONE;
 	}
 
-	if (auto casted_prop = CastField<FClassProperty>(prop))
-	{
-		auto value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		if (value)
-		{
-			Py_RETURN_UOBJECT(value);
-		}
-		return PyErr_Format(PyExc_Exception, "invalid UClass type for %s", TCHAR_TO_UTF8(*casted_prop->GetName()));
-	}
-
 	// try to manage known struct first
-	if (auto casted_prop = CastField<FStructProperty>(prop))
+	case EUEPyPropertyKind::Struct:
 	{
+		FStructProperty* casted_prop = (FStructProperty*)prop;
 		if (auto casted_struct = Cast<UScriptStruct>(casted_prop->Struct))
 		{
 			if (casted_struct == TBaseStructure<FVector>::Get())
@@ -2751,42 +3021,31 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 		return PyErr_Format(PyExc_TypeError, "unsupported UStruct type");
 	}
 
-	if (auto casted_prop = CastField<FWeakObjectProperty>(prop))
-	{
-		auto value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		UObject* strong_obj = value.Get();
-		if (strong_obj)
-		{
-			Py_RETURN_UOBJECT(strong_obj);
-		}
-		// nullptr
-		Py_RETURN_NONE;
-	}
-
-	if (auto casted_prop = CastField<FMulticastDelegateProperty>(prop))
+	case EUEPyPropertyKind::MulticastDelegate:
 	{
-		Py_RETURN_FPROPERTY(casted_prop);
+		Py_RETURN_FPROPERTY((FMulticastDelegateProperty*)prop);
 	}
 
-	if (auto casted_prop = CastField<FDelegateProperty>(prop))
+	case EUEPyPropertyKind::Delegate:
 	{
-		Py_RETURN_FPROPERTY(casted_prop);
+		Py_RETURN_FPROPERTY((FDelegateProperty*)prop);
 	}
 
-	if (auto casted_prop = CastField<FArrayProperty>(prop))
+	case EUEPyPropertyKind::Array:
 	{
+		FArrayProperty* casted_prop = (FArrayProperty*)prop;
 		FScriptArrayHelper_InContainer array_helper(casted_prop, buffer, index);
 
 		FProperty* array_prop = casted_prop->Inner;
 
 		// check for TArray<uint8>, so we can use bytearray optimization
-		if (auto uint8_tarray = CastField<FByteProperty>(array_prop))
+		if (ue_py_get_property_kind(array_prop) == EUEPyPropertyKind::Byte)
 		{
 			uint8* buf = array_helper.GetRawPtr();
 			return PyByteArray_FromStringAndSize((char*)buf, array_helper.Num());
 		}
 
-		PyObject* py_list = PyList_New(0);
+		PyObject* py_list = PyList_New(array_helper.Num());
 
 		for (int i = 0; i < array_helper.Num(); i++)
 		{
@@ -2796,16 +3055,15 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 				Py_DECREF(py_list);
 				return NULL;
 			}
-			PyList_Append(py_list, item);
-			Py_DECREF(item);
+			PyList_SET_ITEM(py_list, i, item);
 		}
 
 		return py_list;
 	}
 
-	if (auto casted_prop = CastField<FMapProperty>(prop))
+	case EUEPyPropertyKind::Map:
 	{
-		FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
+		FScriptMapHelper_InContainer map_helper((FMapProperty*)prop, buffer, index);
 
 		PyObject* py_dict = PyDict_New();
 
@@ -2839,8 +3097,9 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 		return py_dict;
 	}
 
-	if (auto casted_prop = CastField<FSetProperty>(prop))
+	case EUEPyPropertyKind::Set:
 	{
+		FSetProperty* casted_prop = (FSetProperty*)prop;
 		FScriptSetHelper_InContainer set_helper(casted_prop, buffer, index);
 
 		FProperty* set_prop = casted_prop->ElementProp;
@@ -2865,18 +3124,41 @@ PyObject* ue_py_convert_property(FProperty* prop, uint8* buffer, int32 index)
 		return py_set;
 	}
 
+	default:
+		break;
+	}
+
 	return PyErr_Format(PyExc_Exception, "unsupported value type %s for property %s", TCHAR_TO_UTF8(*prop->GetClass()->GetName()), TCHAR_TO_UTF8(*prop->GetName()));
 }
 
+// resize a TArray<uint8> property and fill it with raw bytes
+static void ue_py_copy_bytes_to_array(FArrayProperty* prop, uint8* buffer, int32 index, uint8* buf, Py_ssize_t pybytes_len)
+{
+	FScriptArrayHelper_InContainer helper(prop, buffer, index);
+
+	// fix array helper size
+	if (helper.Num() < pybytes_len)
+	{
+		helper.AddValues(pybytes_len - helper.Num());
+	}
+	else if (helper.Num() > pybytes_len)
+	{
+		helper.RemoveValues(pybytes_len, helper.Num() - pybytes_len);
+	}
+
+	FMemory::Memcpy(helper.GetRawPtr(), buf, pybytes_len);
+}
+
 // convert a python object to a property
 bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, int32 index)
 {
+	EUEPyPropertyKind kind = ue_py_get_property_kind(prop);
 
 	if (PyBool_Check(py_obj))
 	{
-		auto casted_prop = CastField<FBoolProperty>(prop);
-		if (!casted_prop)
+		if (kind != EUEPyPropertyKind::Bool)
 			return false;
+		FBoolProperty* casted_prop = (FBoolProperty*)prop;
 		if (PyObject_IsTrue(py_obj))
 		{
 			casted_prop->SetPropertyValue_InContainer(buffer, true, index);
@@ -2890,112 +3172,97 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PyNumber_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FIntProperty>(prop))
+		switch (kind)
+		{
+		case EUEPyPropertyKind::Int:
 		{
 			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsLong(py_long), index);
+			((FIntProperty*)prop)->SetPropertyValue_InContainer(buffer, PyLong_AsLong(py_long), index);
 			Py_DECREF(py_long);
 			return true;
 		}
-		if (auto casted_prop = CastField<FUInt32Property>(prop))
+		case EUEPyPropertyKind::UInt32:
 		{
 			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
+			((FUInt32Property*)prop)->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
 			Py_DECREF(py_long);
 			return true;
 		}
-		if (auto casted_prop = CastField<FInt64Property>(prop))
+		case EUEPyPropertyKind::Int64:
 		{
 			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsLongLong(py_long), index);
+			((FInt64Property*)prop)->SetPropertyValue_InContainer(buffer, PyLong_AsLongLong(py_long), index);
 			Py_DECREF(py_long);
 			return true;
 		}
-		if (auto casted_prop = CastField<FInt64Property>(prop))
+		case EUEPyPropertyKind::UInt64:
 		{
 			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLongLong(py_long), index);
+			((FUInt64Property*)prop)->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLongLong(py_long), index);
 			Py_DECREF(py_long);
 			return true;
 		}
-		if (auto casted_prop = CastField<FFloatProperty>(prop))
+		case EUEPyPropertyKind::Float:
 		{
 			PyObject* py_float = PyNumber_Float(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
+			((FFloatProperty*)prop)->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
 			Py_DECREF(py_float);
 			return true;
 		}
-		if (auto casted_prop = CastField<FDoubleProperty>(prop))
+		case EUEPyPropertyKind::Double:
 		{
 			PyObject* py_float = PyNumber_Float(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
+			((FDoubleProperty*)prop)->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
 			Py_DECREF(py_float);
 			return true;
 		}
-		if (auto casted_prop = CastField<FByteProperty>(prop))
+		case EUEPyPropertyKind::Byte:
 		{
 			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
+			((FByteProperty*)prop)->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
 			Py_DECREF(py_long);
 			return true;
 		}
-		if (auto casted_prop = CastField<FEnumProperty>(prop))
+		case EUEPyPropertyKind::Enum:
 		{
+			FEnumProperty* casted_prop = (FEnumProperty*)prop;
 			PyObject* py_long = PyNumber_Long(py_obj);
 			void* prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
 			casted_prop->GetUnderlyingProperty()->SetIntPropertyValue(prop_addr, (uint64)PyLong_AsUnsignedLong(py_long));
 			Py_DECREF(py_long);
 			return true;
 		}
-
-		return false;
+		default:
+			return false;
+		}
 	}
 
 	if (PyUnicodeOrString_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FStrProperty>(prop))
+		switch (kind)
 		{
-			casted_prop->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
+		case EUEPyPropertyKind::Str:
+			((FStrProperty*)prop)->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
 			return true;
-		}
-		if (auto casted_prop = CastField<FNameProperty>(prop))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
+		case EUEPyPropertyKind::Name:
+			((FNameProperty*)prop)->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
 			return true;
-		}
-		if (auto casted_prop = CastField<FTextProperty>(prop))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, FText::FromString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj))), index);
+		case EUEPyPropertyKind::Text:
+			((FTextProperty*)prop)->SetPropertyValue_InContainer(buffer, FText::FromString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj))), index);
 			return true;
+		default:
+			return false;
 		}
-		return false;
 	}
 
 	if (PyBytes_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FArrayProperty>(prop))
+		if (kind == EUEPyPropertyKind::Array)
 		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			if (auto item_casted_prop = CastField<FByteProperty>(casted_prop->Inner))
+			FArrayProperty* casted_prop = (FArrayProperty*)prop;
+			if (ue_py_get_property_kind(casted_prop->Inner) == EUEPyPropertyKind::Byte)
 			{
-
-				Py_ssize_t pybytes_len = PyBytes_Size(py_obj);
-				uint8* buf = (uint8*)PyBytes_AsString(py_obj);
-
-
-				// fix array helper size
-				if (helper.Num() < pybytes_len)
-				{
-					helper.AddValues(pybytes_len - helper.Num());
-				}
-				else if (helper.Num() > pybytes_len)
-				{
-					helper.RemoveValues(pybytes_len, helper.Num() - pybytes_len);
-				}
-
-
-				FMemory::Memcpy(helper.GetRawPtr(), buf, pybytes_len);
+				ue_py_copy_bytes_to_array(casted_prop, buffer, index, (uint8*)PyBytes_AsString(py_obj), PyBytes_Size(py_obj));
 				return true;
 			}
 		}
@@ -3005,30 +3272,12 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PyByteArray_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FArrayProperty>(prop))
+		if (kind == EUEPyPropertyKind::Array)
 		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			if (auto item_casted_prop = CastField<FByteProperty>(casted_prop->Inner))
+			FArrayProperty* casted_prop = (FArrayProperty*)prop;
+			if (ue_py_get_property_kind(casted_prop->Inner) == EUEPyPropertyKind::Byte)
 			{
-
-				Py_ssize_t pybytes_len = PyByteArray_Size(py_obj);
-				uint8* buf = (uint8*)PyByteArray_AsString(py_obj);
-
-
-				// fix array helper size
-				if (helper.Num() < pybytes_len)
-				{
-					helper.AddValues(pybytes_len - helper.Num());
-				}
-				else if (helper.Num() > pybytes_len)
-				{
-					helper.RemoveValues(pybytes_len, helper.Num() - pybytes_len);
-				}
-
-
-				FMemory::Memcpy(helper.GetRawPtr(), buf, pybytes_len);
-
+				ue_py_copy_bytes_to_array(casted_prop, buffer, index, (uint8*)PyByteArray_AsString(py_obj), PyByteArray_Size(py_obj));
 				return true;
 			}
 		}
@@ -3038,8 +3287,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PyList_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FArrayProperty>(prop))
+		if (kind == EUEPyPropertyKind::Array)
 		{
+			FArrayProperty* casted_prop = (FArrayProperty*)prop;
 			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
 
 			FProperty* array_prop = casted_prop->Inner;
@@ -3071,8 +3321,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PyTuple_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FArrayProperty>(prop))
+		if (kind == EUEPyPropertyKind::Array)
 		{
+			FArrayProperty* casted_prop = (FArrayProperty*)prop;
 			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
 
 			FProperty* array_prop = casted_prop->Inner;
@@ -3104,8 +3355,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PyDict_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FMapProperty>(prop))
+		if (kind == EUEPyPropertyKind::Map)
 		{
+			FMapProperty* casted_prop = (FMapProperty*)prop;
 			FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
 
 			PyObject* py_key = nullptr;
@@ -3139,8 +3391,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (PySet_Check(py_obj))
 	{
-		if (auto casted_prop = CastField<FSetProperty>(prop))
+		if (kind == EUEPyPropertyKind::Set)
 		{
+			FSetProperty* casted_prop = (FSetProperty*)prop;
 			FScriptSetHelper_InContainer set_helper(casted_prop, buffer, index);
 
 			set_helper.EmptyElements();
@@ -3186,8 +3439,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFVector * py_vec = py_ue_is_fvector(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FVector>::Get())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FVector>(buffer, index) = py_vec->vec;
@@ -3199,8 +3453,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFVector2D * py_vec = py_ue_is_fvector2d(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FVector2D>::Get())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FVector2D>(buffer, index) = py_vec->vec;
@@ -3212,8 +3467,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFRotator * py_rot = py_ue_is_frotator(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FRotator>::Get())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FRotator>(buffer, index) = py_rot->rot;
@@ -3225,8 +3481,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFTransform * py_transform = py_ue_is_ftransform(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FTransform>::Get())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FTransform>(buffer, index) = py_transform->transform;
@@ -3238,8 +3495,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFColor * py_color = py_ue_is_fcolor(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FColor>::Get())
 			{
 
@@ -3252,8 +3510,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFLinearColor * py_color = py_ue_is_flinearcolor(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == TBaseStructure<FLinearColor>::Get())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FLinearColor>(buffer, index) = py_color->color;
@@ -3265,8 +3524,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 	if (ue_PyFHitResult * py_hit = py_ue_is_fhitresult(py_obj))
 	{
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == FHitResult::StaticStruct())
 			{
 				*casted_prop->ContainerPtrToValuePtr<FHitResult>(buffer, index) = py_hit->hit;
@@ -3280,8 +3540,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 	if (py_ue_is_uscriptstruct(py_obj))
 	{
 		ue_PyUScriptStruct* py_u_struct = (ue_PyUScriptStruct*)py_obj;
-		if (auto casted_prop = CastField<FStructProperty>(prop))
+		if (kind == EUEPyPropertyKind::Struct)
 		{
+			FStructProperty* casted_prop = (FStructProperty*)prop;
 			if (casted_prop->Struct == py_u_struct->u_struct)
 			{
 				uint8* dest = casted_prop->ContainerPtrToValuePtr<uint8>(buffer, index);
@@ -3302,9 +3563,11 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 		if (ue_obj->ue_object->IsA<UClass>())
 		{
 			EXTRA_UE_LOG(LogPython, Warning, TEXT("Convert Prop 3 is class %s"), *ue_obj->ue_object->GetName());
-			if (auto casted_prop = CastField<FClassProperty>(prop))
+			switch (kind)
 			{
-				casted_prop->SetPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
+			case EUEPyPropertyKind::Class:
+			{
+				((FClassProperty*)prop)->SetPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
 #ifdef EXTRA_DEBUG_CODE
 				EXTRA_UE_LOG(LogPython, Warning, TEXT("Convert Prop 3a is uclass %s"), *ue_obj->ue_object->GetName());
 				UK2Node_DynamicCast* node = (UK2Node_DynamicCast*)buffer;
@@ -3312,27 +3575,18 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 #endif
 				return true;
 			}
-			else if (auto casted_prop_soft_class = CastField<FSoftClassProperty>(prop))
-			{
-				casted_prop_soft_class->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
+			case EUEPyPropertyKind::SoftClass:
+				((FSoftClassProperty*)prop)->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
 				return true;
-			}
-			else if (auto casted_prop_soft_object = CastField<FSoftObjectProperty>(prop))
-			{
-
-				casted_prop_soft_object->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
-
+			case EUEPyPropertyKind::SoftObject:
+				((FSoftObjectProperty*)prop)->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
 				return true;
-			}
-			else if (auto casted_prop_weak_object = CastField<FWeakObjectProperty>(prop))
-			{
-
-				casted_prop_weak_object->SetPropertyValue_InContainer(buffer, FWeakObjectPtr(ue_obj->ue_object), index);
-
+			case EUEPyPropertyKind::WeakObject:
+				((FWeakObjectProperty*)prop)->SetPropertyValue_InContainer(buffer, FWeakObjectPtr(ue_obj->ue_object), index);
 				return true;
-			}
-			else if (auto casted_prop_base = CastField<FObjectPropertyBase>(prop))
+			case EUEPyPropertyKind::Object:
 			{
+				FObjectPropertyBase* casted_prop_base = (FObjectPropertyBase*)prop;
 				// ensure the object type is correct, otherwise crash could happen (soon or later)
 				if (!ue_obj->ue_object->IsA(casted_prop_base->PropertyClass))
 					return false;
@@ -3344,16 +3598,24 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 				return true;
 			}
-
-			return false;
+			default:
+				return false;
+			}
 		}
 
 
 		if (ue_obj->ue_object->IsA<UObject>())
 		{
 			EXTRA_UE_LOG(LogPython, Warning, TEXT("Convert Prop 4 is uobject %s"), *ue_obj->ue_object->GetName());
-			if (auto casted_prop = CastField<FObjectPropertyBase>(prop))
+			switch (kind)
 			{
+			case EUEPyPropertyKind::Class:
+			case EUEPyPropertyKind::SoftClass:
+			case EUEPyPropertyKind::SoftObject:
+			case EUEPyPropertyKind::WeakObject:
+			case EUEPyPropertyKind::Object:
+			{
+				FObjectPropertyBase* casted_prop = (FObjectPropertyBase*)prop;
 				// if the property specifies an interface, the object must be of a class that implements it
 				if (casted_prop->PropertyClass->HasAnyClassFlags(CLASS_Interface))
 				{
@@ -3371,17 +3633,9 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 				return true;
 			}
-			else if (auto casted_prop_soft_object = CastField<FSoftObjectProperty>(prop))
-			{
-				if (!ue_obj->ue_object->IsA(casted_prop_soft_object->PropertyClass))
-					return false;
-
-				casted_prop_soft_object->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
-
-				return true;
-			}
-			else if (auto casted_prop_interface = CastField<FInterfaceProperty>(prop))
+			case EUEPyPropertyKind::Interface:
 			{
+				FInterfaceProperty* casted_prop_interface = (FInterfaceProperty*)prop;
 				// ensure the object type is correct, otherwise crash could happen (soon or later)
 				if (!ue_obj->ue_object->GetClass()->ImplementsInterface(casted_prop_interface->InterfaceClass))
 					return false;
@@ -3394,29 +3648,29 @@ bool ue_py_convert_pyobject(PyObject* py_obj, FProperty* prop, uint8* buffer, in
 
 				return true;
 			}
+			default:
+				return false;
+			}
 		}
 		return false;
 	}
 
 	if (py_obj == Py_None)
 	{
-		auto casted_prop_class = CastField<FClassProperty>(prop);
-		if (casted_prop_class)
+		switch (kind)
 		{
-
-			casted_prop_class->SetPropertyValue_InContainer(buffer, nullptr, index);
-
+		case EUEPyPropertyKind::Class:
+			((FClassProperty*)prop)->SetPropertyValue_InContainer(buffer, nullptr, index);
 			return true;
-		}
-		auto casted_prop = CastField<FObjectPropertyBase>(prop);
-		if (casted_prop)
-		{
-
-			casted_prop->SetObjectPropertyValue_InContainer(buffer, nullptr, index);
-
+		case EUEPyPropertyKind::SoftClass:
+		case EUEPyPropertyKind::SoftObject:
+		case EUEPyPropertyKind::WeakObject:
+		case EUEPyPropertyKind::Object:
+			((FObjectPropertyBase*)prop)->SetObjectPropertyValue_InContainer(buffer, nullptr, index);
 			return true;
+		default:
+			return false;
 		}
-		return false;
 	}
 
 	return false;
@@ -4327,23 +4581,9 @@ static void py_ue_destroy_params(UFunction* u_function, uint8* buffer)
 #endif
 }
 
-PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject* args, int argn, PyObject* kwargs)
+// reflection based path, used when call plans are disabled or the function cannot be planned
+static PyObject* py_ue_ufunction_call_unplanned(UFunction* u_function, UObject* u_obj, PyObject* args, int argn, PyObject* kwargs)
 {
-
-	// check for __super call
-	if (kwargs)
-	{
-		PyObject* is_super_call = PyDict_GetItemString(kwargs, (char*)"__super");
-		if (is_super_call)
-		{
-			if (!u_function->GetSuperFunction())
-			{
-				return PyErr_Format(PyExc_Exception, "UFunction has no SuperFunction");
-			}
-			u_function = u_function->GetSuperFunction();
-		}
-	}
-
 	//NOTE: u_function->PropertiesSize maps to local variable uproperties + ufunction paramaters uproperties
 	uint8* buffer = (uint8*)FMemory_Alloca(u_function->ParmsSize);
 	FMemory::Memzero(buffer, u_function->ParmsSize);
@@ -4528,6 +4768,187 @@ PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject*
 	Py_RETURN_NONE;
 }
 
+#if PY_VERSION_HEX >= 0x03080000
+// vectorcall keyword values follow the positional ones in the stack
+static PyObject* ue_py_find_vectorcall_kwarg(PyObject* const* stack, Py_ssize_t nargs, PyObject* kwnames, PyObject* name)
+{
+	Py_ssize_t nkwargs = PyTuple_GET_SIZE(kwnames);
+	// keyword names are interned by the compiler, so try identity first
+	for (Py_ssize_t i = 0; i < nkwargs; i++)
+	{
+		if (PyTuple_GET_ITEM(kwnames, i) == name)
+			return stack[nargs + i];
+	}
+	for (Py_ssize_t i = 0; i < nkwargs; i++)
+	{
+		if (PyUnicode_Compare(PyTuple_GET_ITEM(kwnames, i), name) == 0)
+			return stack[nargs + i];
+	}
+	return nullptr;
+}
+#endif
+
+// positional arguments are read directly from the stack (the items of the args tuple or the vectorcall array),
+// keyword arguments from the kwargs dict or (vectorcall) from kwnames
+static PyObject* py_ue_ufunction_call_planned(FUEPyFunctionCallPlan* plan, UFunction* u_function, UObject* u_obj, PyObject* const* stack, Py_ssize_t nargs, PyObject* kwargs, PyObject* kwnames)
+{
+	uint8* buffer = (uint8*)FMemory_Alloca(plan->ParmsSize);
+	plan->PrepareBuffer(buffer);
+
+	Py_ssize_t argn = 0;
+
+	for (const FUEPyCallPlanParam& param : plan->Params)
+	{
+		PyObject* py_arg = nullptr;
+		if (argn < nargs)
+		{
+			py_arg = stack[argn];
+		}
+		else if (kwargs)
+		{
+			py_arg = PyDict_GetItem(kwargs, param.PyName);
+		}
+#if PY_VERSION_HEX >= 0x03080000
+		else if (kwnames)
+		{
+			py_arg = ue_py_find_vectorcall_kwarg(stack, nargs, kwnames, param.PyName);
+		}
+#endif
+		argn++;
+
+		if (py_arg && !ue_py_convert_pyobject(py_arg, param.Property, buffer, 0))
+		{
+			plan->DestroyBuffer(buffer);
+			return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", TCHAR_TO_UTF8(*param.Property->GetName()), TCHAR_TO_UTF8(*param.Property->GetClass()->GetName()));
+		}
+	}
+
+	FScopeCycleCounterUObject ObjectScope(u_obj);
+	FScopeCycleCounterUObject FunctionScope(u_function);
+
+	Py_BEGIN_ALLOW_THREADS;
+	u_obj->ProcessEvent(u_function, buffer);
+	Py_END_ALLOW_THREADS;
+
+	PyObject* ret = nullptr;
+	if (plan->ReturnProperty)
+	{
+		ret = ue_py_convert_property(plan->ReturnProperty, buffer, 0);
+		if (!ret)
+		{
+			plan->DestroyBuffer(buffer);
+			return NULL;
+		}
+	}
+
+	if (plan->OutParams.Num() > 0)
+	{
+		int has_ret_param = ret ? 1 : 0;
+		PyObject* multi_ret = PyTuple_New(plan->OutParams.Num() + has_ret_param);
+		if (ret)
+		{
+			PyTuple_SET_ITEM(multi_ret, 0, ret);
+		}
+		for (int32 i = 0; i < plan->OutParams.Num(); i++)
+		{
+			PyObject* py_out = ue_py_convert_property(plan->OutParams[i], buffer, 0);
+			if (!py_out)
+			{
+				Py_DECREF(multi_ret);
+				plan->DestroyBuffer(buffer);
+				return NULL;
+			}
+			PyTuple_SET_ITEM(multi_ret, has_ret_param + i, py_out);
+		}
+		plan->DestroyBuffer(buffer);
+		return multi_ret;
+	}
+
+	plan->DestroyBuffer(buffer);
+
+	if (ret)
+		return ret;
+
+	Py_RETURN_NONE;
+}
+
+PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject* args, int argn, PyObject* kwargs)
+{
+
+	// check for __super call
+	if (kwargs)
+	{
+		PyObject* is_super_call = PyDict_GetItemString(kwargs, (char*)"__super");
+		if (is_super_call)
+		{
+			if (!u_function->GetSuperFunction())
+			{
+				return PyErr_Format(PyExc_Exception, "UFunction has no SuperFunction");
+			}
+			u_function = u_function->GetSuperFunction();
+		}
+	}
+
+	// keep a reference, python code running in ProcessEvent could flush the plans
+	TSharedPtr<FUEPyFunctionCallPlan> plan = FUnrealEnginePythonCallPlans::Get()->FindOrBuild(u_function);
+	if (plan.IsValid())
+	{
+		Py_ssize_t nargs = FMath::Max<Py_ssize_t>(PyTuple_Size(args) - argn, 0);
+		return py_ue_ufunction_call_planned(plan.Get(), u_function, u_obj, nargs > 0 ? &PyTuple_GET_ITEM(args, argn) : nullptr, nargs, kwargs, nullptr);
+	}
+
+	return py_ue_ufunction_call_unplanned(u_function, u_obj, args, argn, kwargs);
+}
+
+#if PY_VERSION_HEX >= 0x03080000
+PyObject* py_ue_ufunction_vectorcall(UFunction* u_function, UObject* u_obj, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
+{
+	// check for __super call
+	if (kwnames)
+	{
+		static PyObject* py_super_name = PyUnicode_InternFromString("__super");
+		if (ue_py_find_vectorcall_kwarg(args, nargs, kwnames, py_super_name))
+		{
+			if (!u_function->GetSuperFunction())
+			{
+				return PyErr_Format(PyExc_Exception, "UFunction has no SuperFunction");
+			}
+			u_function = u_function->GetSuperFunction();
+		}
+	}
+
+	// keep a reference, python code running in ProcessEvent could flush the plans
+	TSharedPtr<FUEPyFunctionCallPlan> plan = FUnrealEnginePythonCallPlans::Get()->FindOrBuild(u_function);
+	if (plan.IsValid())
+	{
+		return py_ue_ufunction_call_planned(plan.Get(), u_function, u_obj, args, nargs, nullptr, kwnames);
+	}
+
+	// the reflection based path (plans disabled) still requires a tuple and a dict
+	PyObject* py_args = PyTuple_New(nargs);
+	for (Py_ssize_t i = 0; i < nargs; i++)
+	{
+		Py_INCREF(args[i]);
+		PyTuple_SET_ITEM(py_args, i, args[i]);
+	}
+
+	PyObject* py_kwargs = nullptr;
+	if (kwnames)
+	{
+		py_kwargs = PyDict_New();
+		for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); i++)
+		{
+			PyDict_SetItem(py_kwargs, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]);
+		}
+	}
+
+	PyObject* ret = py_ue_ufunction_call_unplanned(u_function, u_obj, py_args, 0, py_kwargs);
+	Py_DECREF(py_args);
+	Py_XDECREF(py_kwargs);
+	return ret;
+}
+#endif
+
 PyObject* ue_unbind_pyevent(ue_PyUObject* u_obj, FString event_name, PyObject* py_callable, bool fail_on_wrong_property)
 {
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
@@ -5471,6 +5892,8 @@ UFunction* unreal_engine_add_function(UClass* u_class, char* name, PyObject* py_
 	}
 #endif
 
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 	return function;
 }
 
@@ -27,6 +27,38 @@
 UWorld *ue_get_uworld(ue_PyUObject *);
 AActor *ue_get_actor(ue_PyUObject *);
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+// converter used for a property, resolved once per field class
+enum class EUEPyPropertyKind : uint8
+{
+	Unresolved,
+	Bool,
+	Int,
+	UInt32,
+	Int64,
+	UInt64,
+	Float,
+	Double,
+	Byte,
+	Enum,
+	Str,
+	Text,
+	Name,
+	Class,
+	SoftClass,
+	SoftObject,
+	WeakObject,
+	Object,
+	Interface,
+	Struct,
+	MulticastDelegate,
+	Delegate,
+	Array,
+	Map,
+	Set,
+	Unsupported,
+};
+
+EUEPyPropertyKind ue_py_get_property_kind(FProperty *);
 PyObject *ue_py_convert_property(FProperty *, uint8 *, int32);
 bool ue_py_convert_pyobject(PyObject *, FProperty *, uint8 *, int32);
 #else
@@ -46,6 +78,9 @@ PyObject *ue_bind_pyevent(ue_PyUObject *, FString, PyObject *, bool);
 PyObject *ue_unbind_pyevent(ue_PyUObject *, FString, PyObject *, bool);
 
 PyObject *py_ue_ufunction_call(UFunction *, UObject *, PyObject *, int, PyObject *);
+#if PY_VERSION_HEX >= 0x03080000
+PyObject *py_ue_ufunction_vectorcall(UFunction *, UObject *, PyObject *const *, Py_ssize_t, PyObject *);
+#endif
 
 UClass *unreal_engine_new_uclass(char *, UClass *);
 UFunction *unreal_engine_add_function(UClass *, char *, PyObject *, uint32);
@@ -0,0 +1,226 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyObjectIterator.h"
+
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+
+static bool ue_py_tobject_iterator_match(ue_PyTObjectIterator *self, UObject *u_obj, UWorld *world)
+{
+	if (!IsValid(u_obj) || u_obj->IsUnreachable())
+		return false;
+
+	// FObjectIterator checked the class when it moved to this slot, but a GC between two next()
+	// calls could have freed it (or reused it for an object of a different class)
+	if (!u_obj->IsA(self->u_class.Get()))
+		return false;
+
+	if (self->has_world && u_obj->GetWorld() != world)
+		return false;
+
+	if (!self->tag.IsNone())
+	{
+		if (AActor *actor = Cast<AActor>(u_obj))
+			return actor->Tags.Contains(self->tag);
+		if (UActorComponent *component = Cast<UActorComponent>(u_obj))
+			return component->ComponentTags.Contains(self->tag);
+		return false;
+	}
+
+	return true;
+}
+
+// advance the native iterator to the next matching object, nullptr when exhausted
+static UObject *ue_py_tobject_iterator_advance(ue_PyTObjectIterator *self)
+{
+	if (!self->iterator)
+		return nullptr;
+
+	// the iterator can be resumed frames later, the world and the class could be gone
+	UWorld *world = self->u_world.Get();
+	if (!self->u_class.IsValid() || (self->has_world && !world))
+	{
+		delete self->iterator;
+		self->iterator = nullptr;
+		return nullptr;
+	}
+
+	while (*self->iterator)
+	{
+		UObject *u_obj = **self->iterator;
+		++(*self->iterator);
+		if (ue_py_tobject_iterator_match(self, u_obj, world))
+			return u_obj;
+	}
+
+	delete self->iterator;
+	self->iterator = nullptr;
+	return nullptr;
+}
+
+static UObject *ue_py_tobject_iterator_next_object(ue_PyTObjectIterator *self)
+{
+	if (self->chunk_size <= 0)
+		return ue_py_tobject_iterator_advance(self);
+
+	for (;;)
+	{
+		while (self->chunk_index < self->chunk.Num())
+		{
+			// collected objects could have been destroyed in the meantime
+			UObject *u_obj = self->chunk[self->chunk_index++].Get();
+			if (IsValid(u_obj))
+				return u_obj;
+		}
+
+		self->chunk.Reset();
+		self->chunk_index = 0;
+		while (self->chunk.Num() < self->chunk_size)
+		{
+			UObject *u_obj = ue_py_tobject_iterator_advance(self);
+			if (!u_obj)
+				break;
+			self->chunk.Add(u_obj);
+		}
+
+		if (self->chunk.Num() == 0)
+			return nullptr;
+	}
+}
+
+static PyObject *ue_PyTObjectIterator_iternext(ue_PyTObjectIterator *self)
+{
+	UObject *u_obj = ue_py_tobject_iterator_next_object(self);
+	// StopIteration
+	if (!u_obj)
+		return nullptr;
+
+	if (self->path_names)
+		return PyUnicode_FromString(TCHAR_TO_UTF8(*u_obj->GetPathName()));
+
+	Py_RETURN_UOBJECT(u_obj);
+}
+
+static void ue_PyTObjectIterator_dealloc(ue_PyTObjectIterator *self)
+{
+	delete self->iterator;
+	self->u_class.~TWeakObjectPtr<UClass>();
+	self->u_world.~TWeakObjectPtr<UWorld>();
+	self->tag.~FName();
+	self->chunk.~TArray<TWeakObjectPtr<UObject>>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyTObjectIteratorType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.TObjectIterator", /* tp_name */
+	sizeof(ue_PyTObjectIterator), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyTObjectIterator_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine Lazy Object Iterator",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	0,                         /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_tobject_iterator(PyObject *ue_module)
+{
+	ue_PyTObjectIteratorType.tp_iter = PyObject_SelfIter;
+	ue_PyTObjectIteratorType.tp_iternext = (iternextfunc)ue_PyTObjectIterator_iternext;
+
+	if (PyType_Ready(&ue_PyTObjectIteratorType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyTObjectIteratorType);
+	PyModule_AddObject(ue_module, "TObjectIterator", (PyObject *)&ue_PyTObjectIteratorType);
+}
+
+PyObject *py_ue_new_tobject_iterator(PyObject *args, PyObject *kwargs, const char *format, UClass *base_class, UWorld *world)
+{
+	PyObject *py_class = nullptr;
+	char *tag = nullptr;
+	int chunk_size = 0;
+	PyObject *py_path_names = nullptr;
+
+	static char *kw_names[] = { (char *)"cls", (char *)"tag", (char *)"chunk_size", (char *)"path_names", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, format, kw_names, &py_class, &tag, &chunk_size, &py_path_names))
+	{
+		return nullptr;
+	}
+
+	UClass *u_class = base_class;
+	if (py_class && py_class != Py_None)
+	{
+		u_class = ue_py_check_type<UClass>(py_class);
+		if (!u_class)
+			return PyErr_Format(PyExc_TypeError, "argument is not a UClass");
+		if (!u_class->IsChildOf(base_class))
+			return PyErr_Format(PyExc_TypeError, "argument is not a child of %s", TCHAR_TO_UTF8(*base_class->GetName()));
+	}
+
+	ue_PyTObjectIterator *ret = (ue_PyTObjectIterator *)PyObject_New(ue_PyTObjectIterator, &ue_PyTObjectIteratorType);
+	ret->iterator = new FObjectIterator(u_class);
+	new(&ret->u_class) TWeakObjectPtr<UClass>(u_class);
+	new(&ret->u_world) TWeakObjectPtr<UWorld>(world);
+	ret->has_world = world != nullptr;
+	new(&ret->tag) FName(tag ? FName(UTF8_TO_TCHAR(tag)) : NAME_None);
+	ret->path_names = py_path_names && PyObject_IsTrue(py_path_names);
+	ret->chunk_size = chunk_size;
+	new(&ret->chunk) TArray<TWeakObjectPtr<UObject>>();
+	ret->chunk_index = 0;
+	if (chunk_size > 0)
+	{
+		ret->chunk.Reserve(chunk_size);
+	}
+
+	return (PyObject *)ret;
+}
+
+PyObject *py_unreal_engine_iter_objects(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	return py_ue_new_tobject_iterator(args, kwargs, "|OziO:iter_objects", UObject::StaticClass(), nullptr);
+}
+
+PyObject *py_ue_iter_objects(ue_PyUObject *self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	return py_ue_new_tobject_iterator(args, kwargs, "|OziO:iter_objects", UObject::StaticClass(), world);
+}
+
+PyObject *py_ue_iter_actors(ue_PyUObject *self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	return py_ue_new_tobject_iterator(args, kwargs, "|OziO:iter_actors", AActor::StaticClass(), world);
+}
@@ -0,0 +1,34 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+#include "UObject/UObjectIterator.h"
+
+// lazy iterator over the UObject array, objects are filtered (class, world, tag)
+// before any python wrapper is allocated
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FObjectIterator *iterator;
+	TWeakObjectPtr<UClass> u_class;
+	TWeakObjectPtr<UWorld> u_world;
+	bool has_world;
+	FName tag;
+	// yield path names instead of python wrappers
+	bool path_names;
+	// number of matching objects collected at once (0 means one at a time)
+	int32 chunk_size;
+	TArray<TWeakObjectPtr<UObject>> chunk;
+	int32 chunk_index;
+} ue_PyTObjectIterator;
+
+void ue_python_init_tobject_iterator(PyObject *);
+
+// parses (cls=None, tag=None, chunk_size=0, path_names=False), cls must be a child of base_class
+PyObject *py_ue_new_tobject_iterator(PyObject *args, PyObject *kwargs, const char *format, UClass *base_class, UWorld *world);
+
+PyObject *py_unreal_engine_iter_objects(PyObject *, PyObject *, PyObject *);
+PyObject *py_ue_iter_objects(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_iter_actors(ue_PyUObject *, PyObject *, PyObject *);
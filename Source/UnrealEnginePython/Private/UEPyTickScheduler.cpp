@@ -0,0 +1,364 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyTickScheduler.h"
+
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+
+void FUEPyTickGroupFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	FUnrealEnginePythonTickScheduler::Get()->RunGroup(this, DeltaTime);
+}
+
+FString FUEPyTickGroupFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UnrealEnginePython batched tick (group %d, %d entries)"), (int32)TickGroup, Entries.Num());
+}
+
+FUnrealEnginePythonTickScheduler *FUnrealEnginePythonTickScheduler::Get()
+{
+	static FUnrealEnginePythonTickScheduler *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonTickScheduler();
+		Singleton->BudgetMs = 2;
+		Singleton->BudgetFrame = 0;
+		Singleton->BudgetUsed = 0;
+		Singleton->FrameTime = 0;
+		Singleton->ResetStats();
+		// tick functions are destroyed only when their world goes away, never in the middle of a frame
+		FWorldDelegates::OnWorldCleanup.AddRaw(Singleton, &FUnrealEnginePythonTickScheduler::OnWorldCleanup);
+	}
+	return Singleton;
+}
+
+void FUnrealEnginePythonTickScheduler::ResetStats()
+{
+	Ticks = 0;
+	Batches = 0;
+	Deferred = 0;
+	LastFrameTime = 0;
+}
+
+int32 FUnrealEnginePythonTickScheduler::NumEntries() const
+{
+	int32 Num = 0;
+	for (FUEPyTickGroupFunction *Group : Groups)
+	{
+		for (const FUEPyTickEntry &Entry : Group->Entries)
+		{
+			if (Entry.PyTick)
+				Num++;
+		}
+	}
+	return Num;
+}
+
+bool FUnrealEnginePythonTickScheduler::Register(UObject *Owner, FTickFunction *OwnerTickFunction, PyObject *PyInstance, ETickingGroup TickGroup, float Interval, bool bLowPriority)
+{
+	UWorld *World = Owner->GetWorld();
+	if (!World || !World->PersistentLevel)
+		return false;
+
+	// the bound method is cached, no more lookups by name on every tick
+	PyObject *py_tick = PyObject_GetAttrString(PyInstance, (char *)"tick");
+	if (!py_tick)
+	{
+		unreal_engine_py_log_error();
+		return false;
+	}
+
+	Unregister(Owner);
+
+	FUEPyTickGroupFunction *Group = nullptr;
+	for (FUEPyTickGroupFunction *Candidate : Groups)
+	{
+		if (Candidate->World.Get() == World && Candidate->TickGroup == TickGroup)
+		{
+			Group = Candidate;
+			break;
+		}
+	}
+
+	if (!Group)
+	{
+		Group = new FUEPyTickGroupFunction();
+		Group->World = World;
+		Group->LowPriorityCursor = 0;
+		Group->bRunning = false;
+		Group->TickGroup = TickGroup;
+		Group->bCanEverTick = true;
+		Group->bStartWithTickEnabled = true;
+		Group->RegisterTickFunction(World->PersistentLevel);
+		Groups.Add(Group);
+	}
+	else if (!Group->IsTickFunctionEnabled())
+	{
+		Group->SetTickFunctionEnable(true);
+	}
+
+	FUEPyTickEntry Entry;
+	Entry.Owner = Owner;
+	Entry.OwnerTickFunction = OwnerTickFunction;
+	Entry.PyTick = py_tick;
+	Entry.Interval = FMath::Max(Interval, 0.f);
+	Entry.Elapsed = 0;
+	Entry.bLowPriority = bLowPriority;
+	Entry.bReady = false;
+	Group->Entries.Add(Entry);
+
+	return true;
+}
+
+void FUnrealEnginePythonTickScheduler::Unregister(UObject *Owner)
+{
+	for (int32 i = Groups.Num() - 1; i >= 0; i--)
+	{
+		FUEPyTickGroupFunction *Group = Groups[i];
+		for (FUEPyTickEntry &Entry : Group->Entries)
+		{
+			if (Entry.Owner.Get() == Owner && Entry.PyTick)
+			{
+				Py_CLEAR(Entry.PyTick);
+			}
+		}
+
+		// a running group is compacted at the end of its batch
+		if (Group->bRunning)
+			continue;
+
+		CompactGroup(Group);
+	}
+}
+
+void FUnrealEnginePythonTickScheduler::CompactGroup(FUEPyTickGroupFunction *Group)
+{
+	Group->Entries.RemoveAll([](const FUEPyTickEntry &Entry) { return Entry.PyTick == nullptr; });
+	if (Group->LowPriorityCursor >= Group->Entries.Num())
+		Group->LowPriorityCursor = 0;
+
+	// the engine could have already queued the tick task of this frame, so empty groups
+	// are only disabled (RunGroup() is a no-op for them) and deleted on world cleanup
+	if (Group->Entries.Num() == 0 && Group->IsTickFunctionRegistered() && Group->IsTickFunctionEnabled())
+	{
+		Group->SetTickFunctionEnable(false);
+	}
+}
+
+void FUnrealEnginePythonTickScheduler::OnWorldCleanup(UWorld *World, bool bSessionEnded, bool bCleanupResources)
+{
+	for (int32 i = Groups.Num() - 1; i >= 0; i--)
+	{
+		FUEPyTickGroupFunction *Group = Groups[i];
+		if (Group->World.IsValid() && Group->World.Get() != World)
+			continue;
+
+		if (Group->Entries.Num() > 0)
+		{
+			FScopePythonGIL gil;
+			for (FUEPyTickEntry &Entry : Group->Entries)
+			{
+				Py_XDECREF(Entry.PyTick);
+			}
+		}
+		if (Group->IsTickFunctionRegistered())
+		{
+			Group->UnRegisterTickFunction();
+		}
+		Groups.RemoveAt(i);
+		delete Group;
+	}
+}
+
+void FUnrealEnginePythonTickScheduler::RunGroup(FUEPyTickGroupFunction *Group, float DeltaTime)
+{
+	if (Group->Entries.Num() == 0)
+		return;
+
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		LastFrameTime = FrameTime;
+		FrameTime = 0;
+		BudgetUsed = 0;
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+
+	FScopePythonGIL gil;
+
+	Group->bRunning = true;
+	Batches++;
+
+	PyObject *py_delta = PyFloat_FromDouble(DeltaTime);
+
+	// entries registered by a python tick will run from the next frame
+	int32 Num = Group->Entries.Num();
+
+	for (int32 i = 0; i < Num; i++)
+	{
+		FUEPyTickEntry &Entry = Group->Entries[i];
+		if (!Entry.PyTick)
+			continue;
+		if (!Entry.Owner.IsValid())
+		{
+			Py_CLEAR(Entry.PyTick);
+			continue;
+		}
+		// honour the tick state of the owner like its own tick function would do
+		if (Entry.OwnerTickFunction && !Entry.OwnerTickFunction->IsTickFunctionEnabled())
+		{
+			Entry.bReady = false;
+			continue;
+		}
+		Entry.Elapsed += DeltaTime * GetTimeDilation(Entry.Owner.Get());
+		Entry.bReady = Entry.Elapsed >= GetInterval(Entry);
+		if (Entry.bLowPriority || !Entry.bReady)
+			continue;
+		RunEntry(Group, i, py_delta, DeltaTime);
+	}
+
+	// low priority ticks share the frame budget, starting from where the previous frame stopped
+	bool bBudgetExhausted = false;
+	for (int32 n = 0; n < Num; n++)
+	{
+		int32 i = (Group->LowPriorityCursor + n) % Num;
+		FUEPyTickEntry &Entry = Group->Entries[i];
+		if (!Entry.PyTick || !Entry.bLowPriority || !Entry.bReady)
+			continue;
+
+		if (!bBudgetExhausted && BudgetUsed * 1000 >= BudgetMs)
+		{
+			bBudgetExhausted = true;
+			Group->LowPriorityCursor = i;
+		}
+
+		if (bBudgetExhausted)
+		{
+			// it will get the accumulated time on the next run
+			Deferred++;
+			continue;
+		}
+
+		double EntryStartTime = FPlatformTime::Seconds();
+		RunEntry(Group, i, py_delta, DeltaTime);
+		BudgetUsed += FPlatformTime::Seconds() - EntryStartTime;
+	}
+
+	Py_DECREF(py_delta);
+
+	Group->bRunning = false;
+	CompactGroup(Group);
+
+	FrameTime += FPlatformTime::Seconds() - StartTime;
+}
+
+float FUnrealEnginePythonTickScheduler::GetTimeDilation(UObject *Owner)
+{
+	AActor *Actor = Cast<AActor>(Owner);
+	if (!Actor)
+	{
+		UActorComponent *Component = Cast<UActorComponent>(Owner);
+		if (Component)
+			Actor = Component->GetOwner();
+	}
+	return Actor ? Actor->CustomTimeDilation : 1.f;
+}
+
+float FUnrealEnginePythonTickScheduler::GetInterval(const FUEPyTickEntry &Entry)
+{
+	if (!Entry.OwnerTickFunction)
+		return Entry.Interval;
+	return FMath::Max(Entry.Interval, Entry.OwnerTickFunction->TickInterval);
+}
+
+void FUnrealEnginePythonTickScheduler::RunEntry(FUEPyTickGroupFunction *Group, int32 Index, PyObject *py_delta, float DeltaTime)
+{
+	FUEPyTickEntry &Entry = Group->Entries[Index];
+	if (!Entry.Owner.IsValid())
+	{
+		Py_CLEAR(Entry.PyTick);
+		return;
+	}
+
+	// entries ticking every frame (without dilation) share the same float
+	PyObject *py_elapsed = py_delta;
+	if (Entry.Elapsed == DeltaTime)
+		Py_INCREF(py_elapsed);
+	else
+		py_elapsed = PyFloat_FromDouble(Entry.Elapsed);
+	Entry.Elapsed = 0;
+
+	// the tick could unregister itself (and the array could be reallocated by new registrations)
+	PyObject *py_tick = Entry.PyTick;
+	Py_INCREF(py_tick);
+
+#if PY_VERSION_HEX >= 0x03090000
+	PyObject *ret = PyObject_Vectorcall(py_tick, &py_elapsed, 1, nullptr);
+#else
+	PyObject *ret = PyObject_CallFunctionObjArgs(py_tick, py_elapsed, nullptr);
+#endif
+
+	Py_DECREF(py_tick);
+	Py_DECREF(py_elapsed);
+
+	Ticks++;
+
+	if (!ret)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	Py_DECREF(ret);
+}
+
+PyObject *py_unreal_engine_set_python_tick_budget(PyObject * self, PyObject * args)
+{
+	float budget;
+	if (!PyArg_ParseTuple(args, "f:set_python_tick_budget", &budget))
+	{
+		return nullptr;
+	}
+
+	FUnrealEnginePythonTickScheduler::Get()->BudgetMs = FMath::Max(budget, 0.f);
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_get_python_tick_scheduler_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonTickScheduler *Scheduler = FUnrealEnginePythonTickScheduler::Get();
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyFloat_FromDouble(Scheduler->BudgetMs);
+	PyDict_SetItemString(py_stats, "budget_ms", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(Scheduler->NumEntries());
+	PyDict_SetItemString(py_stats, "entries", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(Scheduler->NumGroups());
+	PyDict_SetItemString(py_stats, "groups", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Scheduler->Ticks);
+	PyDict_SetItemString(py_stats, "ticks", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Scheduler->Batches);
+	PyDict_SetItemString(py_stats, "batches", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Scheduler->Deferred);
+	PyDict_SetItemString(py_stats, "deferred", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(Scheduler->LastFrameTime * 1000);
+	PyDict_SetItemString(py_stats, "last_frame_ms", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
@@ -0,0 +1,83 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+#include "Engine/EngineBaseTypes.h"
+
+// batched python ticks for UPythonComponent, APyActor, APyPawn and APyCharacter
+// every (world, tick group) pair has a single tick function calling all of the
+// registered python tick methods under a single GIL acquisition
+
+struct FUEPyTickEntry
+{
+	TWeakObjectPtr<UObject> Owner;
+	// tick function of the owner (PrimaryActorTick, PrimaryComponentTick), for its enabled state and interval
+	FTickFunction *OwnerTickFunction;
+	// bound tick method of the python instance
+	PyObject *PyTick;
+	// seconds between ticks, 0 means every frame
+	float Interval;
+	// time accumulated since the last tick
+	float Elapsed;
+	// low priority ticks are subject to the frame budget
+	bool bLowPriority;
+	// the interval elapsed in the current batch
+	bool bReady;
+};
+
+struct FUEPyTickGroupFunction : public FTickFunction
+{
+	TWeakObjectPtr<UWorld> World;
+	TArray<FUEPyTickEntry> Entries;
+	// first low priority entry to run on the next frame (round robin)
+	int32 LowPriorityCursor;
+	// the batch is running, entries cannot be removed
+	bool bRunning;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+class FUnrealEnginePythonTickScheduler
+{
+public:
+	static FUnrealEnginePythonTickScheduler *Get();
+
+	// returns false (with the python error logged) if the instance has no usable tick method, requires the GIL
+	bool Register(UObject *Owner, FTickFunction *OwnerTickFunction, PyObject *PyInstance, ETickingGroup TickGroup, float Interval, bool bLowPriority);
+	void Unregister(UObject *Owner);
+
+	void RunGroup(FUEPyTickGroupFunction *Group, float DeltaTime);
+	void ResetStats();
+
+	// milliseconds per frame available to the low priority ticks
+	float BudgetMs;
+
+	uint64 Ticks;
+	uint64 Batches;
+	// low priority ticks moved to a following frame because of the budget
+	uint64 Deferred;
+	// seconds spent in python ticks during the last frame
+	double LastFrameTime;
+	int32 NumEntries() const;
+	int32 NumGroups() const { return Groups.Num(); }
+
+private:
+	void RunEntry(FUEPyTickGroupFunction *Group, int32 Index, PyObject *py_delta, float DeltaTime);
+	// drops the unregistered entries, empty groups are disabled
+	void CompactGroup(FUEPyTickGroupFunction *Group);
+	void OnWorldCleanup(UWorld *World, bool bSessionEnded, bool bCleanupResources);
+	static float GetTimeDilation(UObject *Owner);
+	static float GetInterval(const FUEPyTickEntry &Entry);
+
+	TArray<FUEPyTickGroupFunction *> Groups;
+	uint64 BudgetFrame;
+	// seconds spent by the low priority ticks in the current frame
+	double BudgetUsed;
+	// seconds spent by all of the batches in the current frame
+	double FrameTime;
+};
+
+PyObject *py_unreal_engine_set_python_tick_budget(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_python_tick_scheduler_stats(PyObject *, PyObject *);
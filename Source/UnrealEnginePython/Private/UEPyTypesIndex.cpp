@@ -0,0 +1,391 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyTypesIndex.h"
+
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectIterator.h"
+#include "Runtime/Core/Public/Misc/CoreDelegates.h"
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+FUnrealEnginePythonTypesIndex::FUnrealEnginePythonTypesIndex() : Hits(0), Misses(0), Rebuilds(0), Ambiguities(0), bBuilt(false), bListening(false)
+{
+}
+
+FUnrealEnginePythonTypesIndex *FUnrealEnginePythonTypesIndex::Get()
+{
+	static FUnrealEnginePythonTypesIndex *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonTypesIndex();
+		GUObjectArray.AddUObjectCreateListener(Singleton);
+		GUObjectArray.AddUObjectDeleteListener(Singleton);
+		Singleton->bListening = true;
+#if ENGINE_MAJOR_VERSION == 5
+		// hot reload and live coding can replace classes without deleting the old ones
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason Reason)
+		{
+			FUnrealEnginePythonTypesIndex::Get()->Invalidate();
+		});
+#endif
+#if WITH_EDITOR
+		if (GEditor)
+		{
+			Singleton->RegisterEditorDelegates();
+		}
+		else
+		{
+			FCoreDelegates::OnPostEngineInit.AddRaw(Singleton, &FUnrealEnginePythonTypesIndex::RegisterEditorDelegates);
+		}
+#endif
+	}
+	return Singleton;
+}
+
+void FUnrealEnginePythonTypesIndex::RegisterEditorDelegates()
+{
+#if WITH_EDITOR
+	if (!GEditor)
+		return;
+	// the compiler renames the previous class (REINST_/TRASHCLASS_), renames are not notified by the listeners
+	GEditor->OnBlueprintCompiled().AddLambda([]()
+	{
+		FUnrealEnginePythonTypesIndex::Get()->Invalidate();
+	});
+#endif
+}
+
+bool FUnrealEnginePythonTypesIndex::GetObjectKind(const UObjectBase *Object, EUEPyTypesIndexKind &Kind)
+{
+	UClass *Class = Object->GetClass();
+	if (!Class)
+		return false;
+	if (Class->IsChildOf(UClass::StaticClass()))
+	{
+		Kind = EUEPyTypesIndexKind::Class;
+		return true;
+	}
+	if (Class->IsChildOf(UScriptStruct::StaticClass()))
+	{
+		Kind = EUEPyTypesIndexKind::Struct;
+		return true;
+	}
+	if (Class->IsChildOf(UEnum::StaticClass()))
+	{
+		Kind = EUEPyTypesIndexKind::Enum;
+		return true;
+	}
+	return false;
+}
+
+void FUnrealEnginePythonTypesIndex::AddObject(UObject *Object, EUEPyTypesIndexKind Kind)
+{
+	FName Name = Object->GetFName();
+	int32 Index = GUObjectArray.ObjectToIndex(Object);
+
+	// already indexed with a different (pre-rename) name
+	TPair<FName, EUEPyTypesIndexKind> *Indexed = IndexedObjects.Find(Index);
+	if (Indexed && Indexed->Key != Name)
+	{
+		FIndexEntry *OldEntry = Kinds[(int32)Indexed->Value].Entries.Find(Indexed->Key);
+		if (OldEntry)
+		{
+			OldEntry->Candidates.Remove(Object);
+		}
+	}
+
+	FKindIndex &KindIndex = Kinds[(int32)Kind];
+	KindIndex.Entries.FindOrAdd(Name).Candidates.AddUnique(Object);
+	IndexedObjects.Add(Index, TPair<FName, EUEPyTypesIndexKind>(Name, Kind));
+	KindIndex.Serial.Increment();
+}
+
+void FUnrealEnginePythonTypesIndex::NotifyUObjectCreated(const UObjectBase *Object, int32 Index)
+{
+	// objects can be created by the async loading threads, no python api here
+	EUEPyTypesIndexKind Kind;
+	if (!GetObjectKind(Object, Kind))
+		return;
+
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+		return;
+	AddObject((UObject *)Object, Kind);
+}
+
+void FUnrealEnginePythonTypesIndex::NotifyUObjectDeleted(const UObjectBase *Object, int32 Index)
+{
+	FScopeLock Lock(&IndexLock);
+	TPair<FName, EUEPyTypesIndexKind> Indexed;
+	if (!IndexedObjects.RemoveAndCopyValue(Index, Indexed))
+		return;
+
+	FKindIndex &KindIndex = Kinds[(int32)Indexed.Value];
+	FIndexEntry *Entry = KindIndex.Entries.Find(Indexed.Key);
+	if (Entry)
+	{
+		Entry->Candidates.Remove((UObject *)Object);
+		if (Entry->Candidates.Num() == 0)
+		{
+			KindIndex.Entries.Remove(Indexed.Key);
+		}
+	}
+	KindIndex.Serial.Increment();
+}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 23)
+void FUnrealEnginePythonTypesIndex::OnUObjectArrayShutdown()
+{
+	if (bListening)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+		GUObjectArray.RemoveUObjectDeleteListener(this);
+		bListening = false;
+	}
+}
+#endif
+
+void FUnrealEnginePythonTypesIndex::Invalidate()
+{
+	FScopeLock Lock(&IndexLock);
+	bBuilt = false;
+	for (FKindIndex &KindIndex : Kinds)
+	{
+		KindIndex.Serial.Increment();
+	}
+}
+
+// requires the IndexLock
+void FUnrealEnginePythonTypesIndex::Rebuild()
+{
+	for (FKindIndex &KindIndex : Kinds)
+	{
+		KindIndex.Entries.Empty();
+		KindIndex.Serial.Increment();
+	}
+	IndexedObjects.Empty();
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		AddObject(*It, EUEPyTypesIndexKind::Class);
+	}
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		AddObject(*It, EUEPyTypesIndexKind::Struct);
+	}
+	for (TObjectIterator<UEnum> It; It; ++It)
+	{
+		AddObject(*It, EUEPyTypesIndexKind::Enum);
+	}
+
+	bBuilt = true;
+	Rebuilds++;
+}
+
+// lower is better: up to date objects, then non transient, then native (/Script/) ones
+static int32 ue_py_types_index_rank(UObject *Object)
+{
+	int32 Rank = 0;
+	if (Object->HasAnyFlags(RF_NewerVersionExists))
+		Rank += 4;
+	UPackage *Package = Object->GetOutermost();
+	if (Package == GetTransientPackage())
+		Rank += 2;
+	if (!Package->GetName().StartsWith(TEXT("/Script/")))
+		Rank += 1;
+	return Rank;
+}
+
+// requires the IndexLock
+UObject *FUnrealEnginePythonTypesIndex::Resolve(EUEPyTypesIndexKind Kind, FName Name)
+{
+	FIndexEntry *Entry = Kinds[(int32)Kind].Entries.Find(Name);
+	if (!Entry)
+		return nullptr;
+
+	UObject *Best = nullptr;
+	int32 BestRank = 0;
+	FString BestPath;
+	bool bAmbiguous = false;
+	for (UObject *Candidate : Entry->Candidates)
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		if (!Candidate->IsValidLowLevel() || Candidate->IsUnreachable() || Candidate->GetFName() != Name)
+#else
+		if (!Candidate->IsValidLowLevel() || Candidate->IsPendingKillOrUnreachable() || Candidate->GetFName() != Name)
+#endif
+			continue;
+
+		int32 Rank = ue_py_types_index_rank(Candidate);
+		if (Best && Rank > BestRank)
+			continue;
+
+		// same rank, the path name makes the choice independent from the creation order
+		FString Path = Candidate->GetPathName();
+		if (Best && Rank == BestRank)
+		{
+			bAmbiguous = true;
+			if (Path >= BestPath)
+				continue;
+		}
+		else
+		{
+			bAmbiguous = false;
+		}
+
+		Best = Candidate;
+		BestRank = Rank;
+		BestPath = Path;
+	}
+
+	if (bAmbiguous)
+	{
+		Ambiguities++;
+		UE_LOG(LogPython, Warning, TEXT("ambiguous name %s (%d candidates), using %s"), *Name.ToString(), Entry->Candidates.Num(), *BestPath);
+	}
+
+	return Best;
+}
+
+void FUnrealEnginePythonTypesIndex::ReleaseResolved()
+{
+	for (FKindIndex &KindIndex : Kinds)
+	{
+		for (TPair<PyObject *, FResolvedEntry> &Pair : KindIndex.Resolved)
+		{
+			Py_DECREF(Pair.Key);
+			Py_DECREF(Pair.Value.PyWrapper);
+		}
+		KindIndex.Resolved.Empty();
+	}
+}
+
+PyObject *FUnrealEnginePythonTypesIndex::Find(EUEPyTypesIndexKind Kind, PyObject *PyName)
+{
+	FKindIndex &KindIndex = Kinds[(int32)Kind];
+	bool bCacheable = PyUnicode_CheckExact(PyName) && PyUnicode_CHECK_INTERNED(PyName);
+
+	if (bCacheable)
+	{
+		FResolvedEntry *Resolved = KindIndex.Resolved.Find(PyName);
+		if (Resolved && Resolved->Serial == KindIndex.Serial.GetValue() && ((ue_PyUObject *)Resolved->PyWrapper)->ue_object == Resolved->Object)
+		{
+			Hits++;
+			Py_INCREF(Resolved->PyWrapper);
+			return Resolved->PyWrapper;
+		}
+	}
+
+	Misses++;
+
+	FName Name = FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(PyName)));
+	UObject *Object = nullptr;
+	int32 Serial = 0;
+	bool bRebuilt = false;
+	{
+		FScopeLock Lock(&IndexLock);
+		if (!bBuilt)
+		{
+			Rebuild();
+			bRebuilt = true;
+		}
+		Serial = KindIndex.Serial.GetValue();
+		Object = Resolve(Kind, Name);
+	}
+
+	// wrappers of the old index, released out of the lock
+	if (bRebuilt)
+	{
+		ReleaseResolved();
+	}
+
+	if (!Object)
+	{
+		// renamed objects are not tracked, give the global search a chance
+		switch (Kind)
+		{
+		case EUEPyTypesIndexKind::Class:
+			Object = FindFirstObjectSafe<UClass>(*Name.ToString());
+			break;
+		case EUEPyTypesIndexKind::Struct:
+			Object = FindFirstObjectSafe<UScriptStruct>(*Name.ToString());
+			break;
+		case EUEPyTypesIndexKind::Enum:
+			Object = FindFirstObjectSafe<UEnum>(*Name.ToString());
+			break;
+		default:
+			break;
+		}
+		if (!Object)
+			return nullptr;
+		FScopeLock Lock(&IndexLock);
+		AddObject(Object, Kind);
+		Serial = KindIndex.Serial.GetValue();
+	}
+
+	ue_PyUObject *PyWrapper = ue_get_python_uobject_inc(Object);
+	if (!PyWrapper)
+		return nullptr;
+
+	if (bCacheable)
+	{
+		FResolvedEntry *Resolved = KindIndex.Resolved.Find(PyName);
+		if (Resolved)
+		{
+			Py_DECREF(Resolved->PyWrapper);
+		}
+		else
+		{
+			// keep the interned string alive, its address is the key
+			Py_INCREF(PyName);
+			Resolved = &KindIndex.Resolved.Add(PyName);
+		}
+		Resolved->Object = Object;
+		Resolved->Serial = Serial;
+		Resolved->PyWrapper = (PyObject *)PyWrapper;
+		Py_INCREF(PyWrapper);
+	}
+
+	return (PyObject *)PyWrapper;
+}
+
+int32 FUnrealEnginePythonTypesIndex::NumEntries()
+{
+	FScopeLock Lock(&IndexLock);
+	int32 Num = 0;
+	for (FKindIndex &KindIndex : Kinds)
+	{
+		Num += KindIndex.Entries.Num();
+	}
+	return Num;
+}
+
+PyObject *py_unreal_engine_get_types_index_stats(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonTypesIndex *Index = FUnrealEnginePythonTypesIndex::Get();
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromUnsignedLongLong(Index->Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Index->Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Index->Rebuilds);
+	PyDict_SetItemString(py_stats, "rebuilds", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(Index->Ambiguities);
+	PyDict_SetItemString(py_stats, "ambiguities", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(Index->NumEntries());
+	PyDict_SetItemString(py_stats, "names", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
@@ -0,0 +1,88 @@
+// Copyright 20Tab S.r.l.
+
+#pragma once
+
+#include "UEPyModule.h"
+#include "UObject/UObjectArray.h"
+
+// name -> UClass/UScriptStruct/UEnum index used by unreal_engine.classes, structs and enums
+// the index is built on first use and kept up to date by the UObject create/delete listeners,
+// resolved python wrappers are cached by (interned) attribute name
+
+enum class EUEPyTypesIndexKind : uint8
+{
+	Class,
+	Struct,
+	Enum,
+	Num,
+};
+
+class FUnrealEnginePythonTypesIndex : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+	struct FIndexEntry
+	{
+		// every object with the same short name
+		TArray<UObject *> Candidates;
+	};
+
+	struct FResolvedEntry
+	{
+		UObject *Object;
+		// strong reference to the python wrapper of Object
+		PyObject *PyWrapper;
+		// value of the kind serial at resolution time
+		int32 Serial;
+	};
+
+	struct FKindIndex
+	{
+		TMap<FName, FIndexEntry> Entries;
+		// incremented whenever a candidate is added or removed
+		FThreadSafeCounter Serial;
+		// keyed by interned python strings, requires the GIL
+		TMap<PyObject *, FResolvedEntry> Resolved;
+	};
+
+public:
+	static FUnrealEnginePythonTypesIndex *Get();
+
+	// returns a new reference or nullptr (without python error) when the name is unknown, requires the GIL
+	PyObject *Find(EUEPyTypesIndexKind Kind, PyObject *PyName);
+
+	// rebuild everything on the next lookup (hot reload, blueprint compilation, renames)
+	void Invalidate();
+
+	// FUObjectCreateListener interface
+	virtual void NotifyUObjectCreated(const UObjectBase *Object, int32 Index) override;
+	// FUObjectDeleteListener interface
+	virtual void NotifyUObjectDeleted(const UObjectBase *Object, int32 Index) override;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 23)
+	virtual void OnUObjectArrayShutdown() override;
+#endif
+
+	uint64 Hits;
+	uint64 Misses;
+	uint64 Rebuilds;
+	uint64 Ambiguities;
+	int32 NumEntries();
+
+private:
+	FUnrealEnginePythonTypesIndex();
+
+	static bool GetObjectKind(const UObjectBase *Object, EUEPyTypesIndexKind &Kind);
+	// requires the IndexLock
+	void AddObject(UObject *Object, EUEPyTypesIndexKind Kind);
+	void Rebuild();
+	UObject *Resolve(EUEPyTypesIndexKind Kind, FName Name);
+	void ReleaseResolved();
+	void RegisterEditorDelegates();
+
+	FKindIndex Kinds[(int32)EUEPyTypesIndexKind::Num];
+	// internal index -> indexed object, for the delete listener (the object could be half destroyed)
+	TMap<int32, TPair<FName, EUEPyTypesIndexKind>> IndexedObjects;
+	FCriticalSection IndexLock;
+	bool bBuilt;
+	bool bListening;
+};
+
+PyObject *py_unreal_engine_get_types_index_stats(PyObject *, PyObject *);
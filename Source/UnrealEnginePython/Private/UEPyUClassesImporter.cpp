@@ -1,26 +1,21 @@
 #include "UEPyUClassesImporter.h"
+#include "UEPyTypesIndex.h"
 
 static PyObject *ue_PyUClassesImporter_getattro(ue_PyUClassesImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	// the importer has no attributes of its own (apart from the python internals),
+	// so the indexed lookup goes first and no AttributeError is built for every access
+	if (PyUnicodeOrString_Check(attr_name))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
+		const char *attr = UEPyUnicode_AsUTF8(attr_name);
+		if (attr[0] != '_')
 		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UClass *u_class = FindFirstObjectSafe<UClass>(UTF8_TO_TCHAR(attr));
-				if (u_class)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_class);
-				}
-			}
+			PyObject *py_u_class = FUnrealEnginePythonTypesIndex::Get()->Find(EUEPyTypesIndexKind::Class, attr_name);
+			if (py_u_class)
+				return py_u_class;
 		}
 	}
-	return py_attr;
+	return PyObject_GenericGetAttr((PyObject *)self, attr_name);
 }
 
 static PyTypeObject ue_PyUClassesImporterType = {
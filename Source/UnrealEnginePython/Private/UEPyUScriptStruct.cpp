@@ -2,6 +2,10 @@
 
 #include "UEPyUScriptStruct.h"
 
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
 
 static PyObject *py_ue_uscriptstruct_get_field(ue_PyUScriptStruct *self, PyObject * args)
 {
@@ -305,15 +309,133 @@ static int ue_PyUScriptStruct_setattro(ue_PyUScriptStruct *self, PyObject *attr_
 
 
 
+struct FUEPyUScriptStructFreelist
+{
+	// released wrappers are linked by their u_struct_ptr
+	ue_PyUScriptStruct *Head;
+	int32 Num;
+};
+
+// released wrappers (with their heap memory, if any) ready to be reused for the same struct
+static TMap<UScriptStruct *, FUEPyUScriptStructFreelist> ue_py_uscriptstruct_freelists;
+
+// the keys of the freelists are raw pointers: the delete listener (any thread, no GIL) reports the
+// destroyed structs having a freelist, their entries are removed before the next freelist access
+static FCriticalSection ue_py_uscriptstruct_dead_lock;
+static TSet<const UObjectBase *> ue_py_uscriptstruct_pooled_structs;
+static TArray<const UObjectBase *> ue_py_uscriptstruct_dead_structs;
+static std::atomic<bool> ue_py_uscriptstruct_has_dead_structs(false);
+
+static void ue_py_uscriptstruct_free_chain(ue_PyUScriptStruct *item)
+{
+	while (item)
+	{
+		ue_PyUScriptStruct *next = (ue_PyUScriptStruct *)item->u_struct_ptr;
+		if (item->u_struct_heap)
+		{
+			FMemory::Free(item->u_struct_heap);
+		}
+		Py_TYPE(item)->tp_free((PyObject *)item);
+		item = next;
+	}
+}
+
+void ue_py_uscriptstruct_freelists_notify_deleted(const UObjectBase *object)
+{
+	FScopeLock Lock(&ue_py_uscriptstruct_dead_lock);
+	if (ue_py_uscriptstruct_pooled_structs.Remove(object) > 0)
+	{
+		ue_py_uscriptstruct_dead_structs.Add(object);
+		ue_py_uscriptstruct_has_dead_structs = true;
+	}
+}
+
+void ue_py_uscriptstruct_freelists_sweep()
+{
+	if (!ue_py_uscriptstruct_has_dead_structs.load(std::memory_order_relaxed))
+		return;
+
+	TArray<const UObjectBase *> dead_structs;
+	{
+		FScopeLock Lock(&ue_py_uscriptstruct_dead_lock);
+		dead_structs = MoveTemp(ue_py_uscriptstruct_dead_structs);
+		ue_py_uscriptstruct_dead_structs.Reset();
+		ue_py_uscriptstruct_has_dead_structs = false;
+	}
+
+	for (const UObjectBase *object : dead_structs)
+	{
+		UScriptStruct *u_struct = (UScriptStruct *)object;
+		FUEPyUScriptStructFreelist freelist;
+		if (ue_py_uscriptstruct_freelists.RemoveAndCopyValue(u_struct, freelist))
+		{
+			ue_py_uscriptstruct_free_chain(freelist.Head);
+		}
+	}
+}
+
+void ue_py_uscriptstruct_freelists_flush()
+{
+	{
+		FScopeLock Lock(&ue_py_uscriptstruct_dead_lock);
+		ue_py_uscriptstruct_pooled_structs.Empty();
+		ue_py_uscriptstruct_dead_structs.Empty();
+		ue_py_uscriptstruct_has_dead_structs = false;
+	}
+
+	for (TPair<UScriptStruct *, FUEPyUScriptStructFreelist> &pair : ue_py_uscriptstruct_freelists)
+	{
+		ue_py_uscriptstruct_free_chain(pair.Value.Head);
+	}
+	ue_py_uscriptstruct_freelists.Empty();
+}
+
+static struct FUEPyUScriptStructFreelistStats
+{
+	uint64 Hits;
+	uint64 Misses;
+	uint64 InlineStorage;
+	uint64 HeapAllocations;
+	uint64 HeapReuses;
+} ue_py_uscriptstruct_freelist_stats;
+
 // destructor
 static void ue_PyUScriptStruct_dealloc(ue_PyUScriptStruct *self)
 {
 #if defined(UEPY_MEMORY_DEBUG)
 	UE_LOG(LogPython, Warning, TEXT("Destroying ue_PyUScriptStruct %p with size %d"), self, self->u_struct->GetStructureSize());
 #endif
-	if (self->u_struct_owned)
+	// owned structs live in u_struct_inline or u_struct_heap, both of them are reused by the freelist,
+	// the members (strings, arrays...) have to be destroyed before the memory is initialized again
+	if (self->u_struct_owned && self->u_struct && self->u_struct_ptr)
 	{
-		FMemory::Free(self->u_struct_ptr);
+		self->u_struct->DestroyStruct(self->u_struct_ptr);
+		self->u_struct_owned = 0;
+	}
+
+	if (self->u_struct)
+	{
+		ue_py_uscriptstruct_freelists_sweep();
+		FUEPyUScriptStructFreelist *found = ue_py_uscriptstruct_freelists.Find(self->u_struct);
+		if (!found)
+		{
+			FScopeLock Lock(&ue_py_uscriptstruct_dead_lock);
+			ue_py_uscriptstruct_pooled_structs.Add(self->u_struct);
+			found = &ue_py_uscriptstruct_freelists.Add(self->u_struct, FUEPyUScriptStructFreelist());
+		}
+		FUEPyUScriptStructFreelist &freelist = *found;
+		if (freelist.Num < UEPY_USCRIPTSTRUCT_FREELIST_SIZE)
+		{
+			self->u_struct_ptr = (uint8 *)freelist.Head;
+			freelist.Head = self;
+			freelist.Num++;
+			return;
+		}
+	}
+
+	if (self->u_struct_heap)
+	{
+		FMemory::Free(self->u_struct_heap);
 	}
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
@@ -351,6 +473,61 @@ static PyTypeObject ue_PyUScriptStructType = {
 	0,
 };
 
+static ue_PyUScriptStruct *ue_py_uscriptstruct_alloc(UScriptStruct *u_struct)
+{
+	ue_PyUScriptStruct *ret = nullptr;
+	ue_py_uscriptstruct_freelists_sweep();
+	FUEPyUScriptStructFreelist *freelist = ue_py_uscriptstruct_freelists.Find(u_struct);
+	if (freelist && freelist->Head)
+	{
+		ret = freelist->Head;
+		freelist->Head = (ue_PyUScriptStruct *)ret->u_struct_ptr;
+		freelist->Num--;
+		PyObject_Init((PyObject *)ret, &ue_PyUScriptStructType);
+		ue_py_uscriptstruct_freelist_stats.Hits++;
+	}
+	else
+	{
+		ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
+		ret->u_struct_heap = nullptr;
+		ret->u_struct_heap_size = 0;
+		ue_py_uscriptstruct_freelist_stats.Misses++;
+	}
+	ret->u_struct = u_struct;
+	ret->u_struct_ptr = nullptr;
+	ret->u_struct_owned = 0;
+	return ret;
+}
+
+// memory for an owned (still uninitialized) struct, the inline storage whenever possible
+static uint8 *ue_py_uscriptstruct_get_storage(ue_PyUScriptStruct *self)
+{
+	int32 size = self->u_struct->GetStructureSize();
+	int32 alignment = FMath::Max(self->u_struct->GetMinAlignment(), 1);
+
+	uint8 *inline_ptr = Align((uint8 *)self->u_struct_inline, alignment);
+	if (inline_ptr + size <= self->u_struct_inline + UEPY_USCRIPTSTRUCT_INLINE_SIZE)
+	{
+		ue_py_uscriptstruct_freelist_stats.InlineStorage++;
+		return inline_ptr;
+	}
+
+	if (self->u_struct_heap && self->u_struct_heap_size >= size && IsAligned(self->u_struct_heap, alignment))
+	{
+		ue_py_uscriptstruct_freelist_stats.HeapReuses++;
+		return self->u_struct_heap;
+	}
+
+	if (self->u_struct_heap)
+	{
+		FMemory::Free(self->u_struct_heap);
+	}
+	self->u_struct_heap = (uint8 *)FMemory::Malloc(size, alignment);
+	self->u_struct_heap_size = size;
+	ue_py_uscriptstruct_freelist_stats.HeapAllocations++;
+	return self->u_struct_heap;
+}
+
 static int ue_py_uscriptstruct_init(ue_PyUScriptStruct *self, PyObject *args, PyObject *kwargs)
 {
 	PyObject *py_struct;
@@ -371,7 +548,7 @@ static int ue_py_uscriptstruct_init(ue_PyUScriptStruct *self, PyObject *args, Py
 	}
 
 	self->u_struct = (UScriptStruct *)py_u_obj->ue_object;
-	self->u_struct_ptr = (uint8*)FMemory::Malloc(self->u_struct->GetStructureSize());
+	self->u_struct_ptr = ue_py_uscriptstruct_get_storage(self);
 	self->u_struct->InitializeStruct(self->u_struct_ptr);
 #if WITH_EDITOR
 	self->u_struct->InitializeDefaultValue(self->u_struct_ptr);
@@ -434,18 +611,15 @@ void ue_python_init_uscriptstruct(PyObject *ue_module)
 
 PyObject *py_ue_new_uscriptstruct(UScriptStruct *u_struct, uint8 *data)
 {
-	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = u_struct;
+	ue_PyUScriptStruct *ret = ue_py_uscriptstruct_alloc(u_struct);
 	ret->u_struct_ptr = data;
-	ret->u_struct_owned = 0;
 	return (PyObject *)ret;
 }
 
 PyObject *py_ue_new_owned_uscriptstruct(UScriptStruct *u_struct, uint8 *data)
 {
-	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = u_struct;
-	uint8 *struct_data = (uint8*)FMemory::Malloc(u_struct->GetStructureSize());
+	ue_PyUScriptStruct *ret = ue_py_uscriptstruct_alloc(u_struct);
+	uint8 *struct_data = ue_py_uscriptstruct_get_storage(ret);
 	ret->u_struct->InitializeStruct(struct_data);
 	ret->u_struct->CopyScriptStruct(struct_data, data);
 	ret->u_struct_ptr = struct_data;
@@ -453,25 +627,37 @@ PyObject *py_ue_new_owned_uscriptstruct(UScriptStruct *u_struct, uint8 *data)
 	return (PyObject *)ret;
 }
 
+// data must be allocated with FMemory::Malloc, the wrapper takes ownership of it
 PyObject *py_ue_new_owned_uscriptstruct_zero_copy(UScriptStruct *u_struct, uint8 *data)
 {
-	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = u_struct;
+	ue_PyUScriptStruct *ret = ue_py_uscriptstruct_alloc(u_struct);
+	if (ret->u_struct_heap)
+	{
+		FMemory::Free(ret->u_struct_heap);
+	}
+	ret->u_struct_heap = data;
+	ret->u_struct_heap_size = u_struct->GetStructureSize();
 	ret->u_struct_ptr = data;
 	ret->u_struct_owned = 1;
 	return (PyObject *)ret;
 }
 
-static PyObject *py_ue_uscriptstruct_clone(ue_PyUScriptStruct *self, PyObject * args)
+ue_PyUScriptStruct *py_ue_new_default_uscriptstruct(UScriptStruct *u_struct)
 {
-	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = self->u_struct;
-	uint8 *struct_data = (uint8*)FMemory::Malloc(self->u_struct->GetStructureSize());
-	ret->u_struct->InitializeStruct(struct_data);
-	ret->u_struct->CopyScriptStruct(struct_data, self->u_struct_ptr);
+	ue_PyUScriptStruct *ret = ue_py_uscriptstruct_alloc(u_struct);
+	uint8 *struct_data = ue_py_uscriptstruct_get_storage(ret);
+	u_struct->InitializeStruct(struct_data);
+#if WITH_EDITOR
+	u_struct->InitializeDefaultValue(struct_data);
+#endif
 	ret->u_struct_ptr = struct_data;
 	ret->u_struct_owned = 1;
-	return (PyObject *)ret;
+	return ret;
+}
+
+static PyObject *py_ue_uscriptstruct_clone(ue_PyUScriptStruct *self, PyObject * args)
+{
+	return py_ue_new_owned_uscriptstruct(self->u_struct, self->u_struct_ptr);
 }
 
 ue_PyUScriptStruct *py_ue_is_uscriptstruct(PyObject *obj)
@@ -480,3 +666,59 @@ ue_PyUScriptStruct *py_ue_is_uscriptstruct(PyObject *obj)
 		return nullptr;
 	return (ue_PyUScriptStruct *)obj;
 }
+
+PyObject *py_unreal_engine_get_uscriptstruct_freelist_stats(PyObject * self, PyObject * args)
+{
+	FUEPyUScriptStructFreelistStats &stats = ue_py_uscriptstruct_freelist_stats;
+	uint64 allocations = stats.Hits + stats.Misses;
+
+	int32 pooled = 0;
+	for (TPair<UScriptStruct *, FUEPyUScriptStructFreelist> &pair : ue_py_uscriptstruct_freelists)
+	{
+		pooled += pair.Value.Num;
+	}
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromUnsignedLongLong(stats.Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(stats.Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyFloat_FromDouble(allocations > 0 ? (double)stats.Hits / (double)allocations : 0);
+	PyDict_SetItemString(py_stats, "hit_rate", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(stats.InlineStorage);
+	PyDict_SetItemString(py_stats, "inline", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(stats.HeapAllocations);
+	PyDict_SetItemString(py_stats, "heap_allocations", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(stats.HeapReuses);
+	PyDict_SetItemString(py_stats, "heap_reuses", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(pooled);
+	PyDict_SetItemString(py_stats, "pooled", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(ue_py_uscriptstruct_freelists.Num());
+	PyDict_SetItemString(py_stats, "freelists", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_flush_uscriptstruct_freelists(PyObject * self, PyObject * args)
+{
+	ue_py_uscriptstruct_freelists_flush();
+	FMemory::Memzero(ue_py_uscriptstruct_freelist_stats);
+
+	Py_RETURN_NONE;
+}
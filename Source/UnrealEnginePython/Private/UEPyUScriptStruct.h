@@ -2,6 +2,16 @@
 
 #include "UEPyModule.h"
 
+// owned structs up to this size (alignment included) are stored in the python object itself
+#ifndef UEPY_USCRIPTSTRUCT_INLINE_SIZE
+#define UEPY_USCRIPTSTRUCT_INLINE_SIZE 256
+#endif
+
+// max number of released wrappers kept for each UScriptStruct
+#ifndef UEPY_USCRIPTSTRUCT_FREELIST_SIZE
+#define UEPY_USCRIPTSTRUCT_FREELIST_SIZE 64
+#endif
+
 typedef struct
 {
 	PyObject_HEAD
@@ -10,13 +20,29 @@ typedef struct
 	uint8 *u_struct_ptr;
 	// if set, the struct is responsible for freeing memory
 	int u_struct_owned;
+	// memory for owned structs not fitting in u_struct_inline, kept when the wrapper goes back to the freelist
+	uint8 *u_struct_heap;
+	int32 u_struct_heap_size;
+	uint8 u_struct_inline[UEPY_USCRIPTSTRUCT_INLINE_SIZE];
 } ue_PyUScriptStruct;
 
 PyObject *py_ue_new_uscriptstruct(UScriptStruct *, uint8 *);
 PyObject *py_ue_new_owned_uscriptstruct(UScriptStruct *, uint8 *);
 PyObject *py_ue_new_owned_uscriptstruct_zero_copy(UScriptStruct *, uint8 *);
+// owned struct initialized with its default values
+ue_PyUScriptStruct *py_ue_new_default_uscriptstruct(UScriptStruct *);
 ue_PyUScriptStruct *py_ue_is_uscriptstruct(PyObject *);
 
+PyObject *py_unreal_engine_get_uscriptstruct_freelist_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_uscriptstruct_freelists(PyObject *, PyObject *);
+
+// called by the housekeeper delete listener, from any thread
+void ue_py_uscriptstruct_freelists_notify_deleted(const UObjectBase *);
+// release the freelists of the destroyed structs (GIL required)
+void ue_py_uscriptstruct_freelists_sweep();
+// release all of the freelists (GIL required)
+void ue_py_uscriptstruct_freelists_flush();
+
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
 FProperty *ue_struct_get_field_from_name(UScriptStruct *, char *);
 #else
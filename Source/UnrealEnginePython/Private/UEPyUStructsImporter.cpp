@@ -1,26 +1,19 @@
 #include "UEPyUStructsImporter.h"
+#include "UEPyTypesIndex.h"
 
 static PyObject *ue_PyUStructsImporter_getattro(ue_PyUStructsImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	if (PyUnicodeOrString_Check(attr_name))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
+		const char *attr = UEPyUnicode_AsUTF8(attr_name);
+		if (attr[0] != '_')
 		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UScriptStruct *u_struct = FindFirstObjectSafe<UScriptStruct>(UTF8_TO_TCHAR(attr));
-				if (u_struct)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_struct);
-				}
-			}
+			PyObject *py_u_struct = FUnrealEnginePythonTypesIndex::Get()->Find(EUEPyTypesIndexKind::Struct, attr_name);
+			if (py_u_struct)
+				return py_u_struct;
 		}
 	}
-	return py_attr;
+	return PyObject_GenericGetAttr((PyObject *)self, attr_name);
 }
 
 static PyTypeObject ue_PyUStructsImporterType = {
@@ -1,7 +1,9 @@
 #include "UEPyObject.h"
+#include "UEPyAttributeCache.h"
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
 #include "UEPyProperty.h"
+#include "Wrappers/UEPyFPropertyArrayView.h"
 #endif
 
 #include "PythonDelegate.h"
@@ -213,6 +215,33 @@ PyObject *py_ue_get_property_struct(ue_PyUObject * self, PyObject * args)
 	return py_ue_new_uscriptstruct(prop->Struct, prop->ContainerPtrToValuePtr<uint8>(self->ue_object));
 }
 
+PyObject *py_ue_get_property_array_view(ue_PyUObject * self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	char *property_name;
+	PyObject *py_writable = nullptr;
+	if (!PyArg_ParseTuple(args, "s|O:get_property_array_view", &property_name, &py_writable))
+	{
+		return NULL;
+	}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FProperty *f_property = self->ue_object->GetClass()->FindPropertyByName(FName(UTF8_TO_TCHAR(property_name)));
+	if (!f_property)
+		return PyErr_Format(PyExc_Exception, "unable to find property %s", property_name);
+
+	FArrayProperty *prop = CastField<FArrayProperty>(f_property);
+	if (!prop)
+		return PyErr_Format(PyExc_Exception, "object is not an ArrayProperty");
+
+	return py_ue_new_fpropertyarrayview(self->ue_object, prop, py_writable && PyObject_IsTrue(py_writable));
+#else
+	return PyErr_Format(PyExc_Exception, "array views require FProperty support (Unreal Engine 4.25+)");
+#endif
+}
+
 PyObject *py_ue_get_super_class(ue_PyUObject * self, PyObject * args)
 {
 
@@ -655,6 +684,34 @@ PyObject *py_ue_has_metadata(ue_PyUObject * self, PyObject * args)
 }
 #endif
 
+#if PY_VERSION_HEX >= 0x03080000
+// METH_FASTCALL, the arguments are moved from the stack to the params buffer without an intermediate tuple
+PyObject *py_ue_call_function(ue_PyUObject * self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+
+	ue_py_check(self);
+
+	UFunction *function = nullptr;
+
+	if (nargs < 1)
+	{
+		return PyErr_Format(PyExc_TypeError, "this function requires at least an argument");
+	}
+
+	PyObject *func_id = args[0];
+
+	if (PyUnicodeOrString_Check(func_id))
+	{
+		function = self->ue_object->FindFunction(FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(func_id))));
+	}
+
+	if (!function)
+		return PyErr_Format(PyExc_Exception, "unable to find function");
+
+	return py_ue_ufunction_vectorcall(function, self->ue_object, args + 1, nargs - 1, kwnames);
+
+}
+#else
 PyObject *py_ue_call_function(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
 {
 
@@ -680,6 +737,7 @@ PyObject *py_ue_call_function(ue_PyUObject * self, PyObject * args, PyObject *kw
 	return py_ue_ufunction_call(function, self->ue_object, args, 1, kwargs);
 
 }
+#endif
 
 PyObject *py_ue_find_function(ue_PyUObject * self, PyObject * args)
 {
@@ -864,6 +922,9 @@ PyObject *py_ue_set_property(ue_PyUObject *self, PyObject * args)
 		return PyErr_Format(PyExc_Exception, "unable to find property %s", property_name);
 
 
+	if (ue_py_fpropertyarrayview_is_exported(self->ue_object, f_property))
+		return PyErr_Format(PyExc_BufferError, "property %s is exported by an array view", property_name);
+
 	if (!ue_py_convert_pyobject(property_value, f_property, (uint8 *)self->ue_object, index))
 	{
 		return PyErr_Format(PyExc_Exception, "unable to set property %s", property_name);
@@ -1729,7 +1790,7 @@ PyObject *py_ue_disown(ue_PyUObject *self, PyObject * args)
 	Py_INCREF(self);
 
 	self->owned = 0;
-	FUnrealEnginePythonHouseKeeper::Get()->UntrackUObject(self->ue_object);
+	FUnrealEnginePythonHouseKeeper::Get()->DisownUObject(self->ue_object);
 
 	Py_RETURN_NONE;
 }
@@ -2308,6 +2369,9 @@ PyObject *py_ue_add_property(ue_PyUObject * self, PyObject * args)
 	u_struct->AddCppProperty(f_property);
 	u_struct->StaticLink(true);
 
+	// a new property shadows functions with the same name
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 
 	if (u_struct->IsA<UClass>())
 	{
@@ -2655,6 +2719,9 @@ PyObject *py_ue_add_property(ue_PyUObject * self, PyObject * args)
 	u_struct->AddCppProperty(u_property);
 	u_struct->StaticLink(true);
 
+	// a new property shadows functions with the same name
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 
 	if (u_struct->IsA<UClass>())
 	{
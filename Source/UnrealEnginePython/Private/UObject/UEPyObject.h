@@ -9,7 +9,11 @@ PyObject *py_ue_is_a(ue_PyUObject *, PyObject *);
 PyObject *py_ue_is_valid(ue_PyUObject *, PyObject *);
 PyObject *py_ue_is_child_of(ue_PyUObject *, PyObject *);
 PyObject *py_ue_is_native(ue_PyUObject * self, PyObject * args);
+#if PY_VERSION_HEX >= 0x03080000
+PyObject *py_ue_call_function(ue_PyUObject *, PyObject *const *, Py_ssize_t, PyObject *);
+#else
 PyObject *py_ue_call_function(ue_PyUObject *, PyObject *, PyObject *);
+#endif
 PyObject *py_ue_find_function(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_name(ue_PyUObject *, PyObject * args);
 PyObject *py_ue_get_display_name(ue_PyUObject *, PyObject * args);
@@ -21,6 +25,7 @@ PyObject *py_ue_set_property_flags(ue_PyUObject *, PyObject *);
 PyObject *py_ue_add_property_flags(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_property_flags(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_property_struct(ue_PyUObject *, PyObject *);
+PyObject *py_ue_get_property_array_view(ue_PyUObject *, PyObject *);
 PyObject *py_ue_properties(ue_PyUObject *, PyObject *);
 PyObject *py_ue_call(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_property(ue_PyUObject *, PyObject *);
@@ -14,10 +14,218 @@
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 1
 #include "Engine/SkinnedAssetCommon.h"
 #endif
+#include "Animation/MorphTarget.h"
+#include "Async/ParallelFor.h"
 #endif
 
 #include "Animation/AnimInstance.h"
 
+#if WITH_EDITOR
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+typedef uint16 ue_py_influence_bone;
+#else
+typedef uint8 ue_py_influence_bone;
+#endif
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+typedef uint16 ue_py_influence_weight;
+#else
+typedef uint8 ue_py_influence_weight;
+#endif
+
+// packed records exchanged with numpy structured arrays (see get_soft_skin_vertex_dtype()
+// and get_morph_target_delta_dtype()), bones and weights keep the engine native types
+#pragma pack(push, 1)
+struct FUEPySoftSkinVertexRecord
+{
+	float Position[3];
+	float TangentX[3];
+	float TangentY[3];
+	// w is the binormal sign
+	float TangentZ[4];
+	float UVs[MAX_TEXCOORDS][2];
+	// r, g, b, a
+	uint8 Color[4];
+	ue_py_influence_bone InfluenceBones[MAX_TOTAL_INFLUENCES];
+	ue_py_influence_weight InfluenceWeights[MAX_TOTAL_INFLUENCES];
+};
+
+struct FUEPyMorphTargetDeltaRecord
+{
+	float PositionDelta[3];
+	float TangentZDelta[3];
+	uint32 SourceIdx;
+};
+#pragma pack(pop)
+
+// raw bytes or a structured array (struct format "T{...}") of records with the right itemsize
+static bool ue_py_skeletal_get_records(PyObject *py_obj, Py_buffer *py_buf, Py_ssize_t record_size, int32 &num)
+{
+	if (PyObject_GetBuffer(py_obj, py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return false;
+
+	const char *format = py_buf->format ? py_buf->format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+
+	bool raw = !strcmp(format, "B") || !strcmp(format, "b") || !strcmp(format, "c");
+	if (!raw && (strncmp(format, "T{", 2) || py_buf->itemsize != record_size))
+	{
+		PyErr_Format(PyExc_ValueError, "buffer must contain raw bytes or records of %d bytes", (int)record_size);
+		PyBuffer_Release(py_buf);
+		return false;
+	}
+
+	if (py_buf->len % record_size)
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of the record size (%d)", (int)py_buf->len, (int)record_size);
+		PyBuffer_Release(py_buf);
+		return false;
+	}
+
+	num = py_buf->len / record_size;
+	return true;
+}
+
+static void ue_py_soft_skin_vertex_to_record(const FSoftSkinVertex &vertex, FUEPySoftSkinVertexRecord &record)
+{
+	record.Position[0] = vertex.Position.X; record.Position[1] = vertex.Position.Y; record.Position[2] = vertex.Position.Z;
+	record.TangentX[0] = vertex.TangentX.X; record.TangentX[1] = vertex.TangentX.Y; record.TangentX[2] = vertex.TangentX.Z;
+	record.TangentY[0] = vertex.TangentY.X; record.TangentY[1] = vertex.TangentY.Y; record.TangentY[2] = vertex.TangentY.Z;
+	record.TangentZ[0] = vertex.TangentZ.X; record.TangentZ[1] = vertex.TangentZ.Y; record.TangentZ[2] = vertex.TangentZ.Z; record.TangentZ[3] = vertex.TangentZ.W;
+	for (int32 i = 0; i < MAX_TEXCOORDS; i++)
+	{
+		record.UVs[i][0] = vertex.UVs[i].X;
+		record.UVs[i][1] = vertex.UVs[i].Y;
+	}
+	record.Color[0] = vertex.Color.R; record.Color[1] = vertex.Color.G; record.Color[2] = vertex.Color.B; record.Color[3] = vertex.Color.A;
+	for (int32 i = 0; i < MAX_TOTAL_INFLUENCES; i++)
+	{
+		record.InfluenceBones[i] = vertex.InfluenceBones[i];
+		record.InfluenceWeights[i] = vertex.InfluenceWeights[i];
+	}
+}
+
+static void ue_py_soft_skin_vertex_from_record(const FUEPySoftSkinVertexRecord &record, FSoftSkinVertex &vertex)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	vertex.Position = FVector3f(record.Position[0], record.Position[1], record.Position[2]);
+	vertex.TangentX = FVector3f(record.TangentX[0], record.TangentX[1], record.TangentX[2]);
+	vertex.TangentY = FVector3f(record.TangentY[0], record.TangentY[1], record.TangentY[2]);
+	vertex.TangentZ = FVector4f(record.TangentZ[0], record.TangentZ[1], record.TangentZ[2], record.TangentZ[3]);
+	for (int32 i = 0; i < MAX_TEXCOORDS; i++)
+	{
+		vertex.UVs[i] = FVector2f(record.UVs[i][0], record.UVs[i][1]);
+	}
+#else
+	vertex.Position = FVector(record.Position[0], record.Position[1], record.Position[2]);
+	vertex.TangentX = FVector(record.TangentX[0], record.TangentX[1], record.TangentX[2]);
+	vertex.TangentY = FVector(record.TangentY[0], record.TangentY[1], record.TangentY[2]);
+	vertex.TangentZ = FVector4(record.TangentZ[0], record.TangentZ[1], record.TangentZ[2], record.TangentZ[3]);
+	for (int32 i = 0; i < MAX_TEXCOORDS; i++)
+	{
+		vertex.UVs[i] = FVector2D(record.UVs[i][0], record.UVs[i][1]);
+	}
+#endif
+	vertex.Color = FColor(record.Color[0], record.Color[1], record.Color[2], record.Color[3]);
+	for (int32 i = 0; i < MAX_TOTAL_INFLUENCES; i++)
+	{
+		vertex.InfluenceBones[i] = record.InfluenceBones[i];
+		vertex.InfluenceWeights[i] = record.InfluenceWeights[i];
+	}
+}
+
+// a buffer of FUEPyMorphTargetDeltaRecord or an iterable of FMorphTargetDelta
+static bool ue_py_morph_target_deltas_from_arg(PyObject *py_deltas, TArray<FMorphTargetDelta> &deltas)
+{
+	if (PyObject_CheckBuffer(py_deltas))
+	{
+		Py_buffer py_buf;
+		int32 num = 0;
+		if (!ue_py_skeletal_get_records(py_deltas, &py_buf, sizeof(FUEPyMorphTargetDeltaRecord), num))
+			return false;
+
+		const FUEPyMorphTargetDeltaRecord *records = (const FUEPyMorphTargetDeltaRecord *)py_buf.buf;
+		deltas.SetNumUninitialized(num);
+		for (int32 i = 0; i < num; i++)
+		{
+			const FUEPyMorphTargetDeltaRecord &record = records[i];
+#if ENGINE_MAJOR_VERSION == 5
+			deltas[i].PositionDelta = FVector3f(record.PositionDelta[0], record.PositionDelta[1], record.PositionDelta[2]);
+			deltas[i].TangentZDelta = FVector3f(record.TangentZDelta[0], record.TangentZDelta[1], record.TangentZDelta[2]);
+#else
+			deltas[i].PositionDelta = FVector(record.PositionDelta[0], record.PositionDelta[1], record.PositionDelta[2]);
+			deltas[i].TangentZDelta = FVector(record.TangentZDelta[0], record.TangentZDelta[1], record.TangentZDelta[2]);
+#endif
+			deltas[i].SourceIdx = record.SourceIdx;
+		}
+
+		PyBuffer_Release(&py_buf);
+		return true;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_deltas);
+	if (!py_iter)
+	{
+		PyErr_Format(PyExc_Exception, "argument is not a buffer or an iterable of FMorphTargetDelta");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		ue_PyFMorphTargetDelta *py_delta = py_ue_is_fmorph_target_delta(py_item);
+		Py_DECREF(py_item);
+		if (!py_delta)
+		{
+			Py_DECREF(py_iter);
+			PyErr_Format(PyExc_Exception, "argument is not a buffer or an iterable of FMorphTargetDelta");
+			return false;
+		}
+		deltas.Add(py_delta->morph_target_delta);
+	}
+
+	Py_DECREF(py_iter);
+	return true;
+}
+
+static PyObject *ue_py_skeletal_dtype_field(const char *name, const char *format, int dim0, int dim1)
+{
+	if (dim1 > 0)
+		return Py_BuildValue((char *)"(ss(ii))", name, format, dim0, dim1);
+	if (dim0 > 0)
+		return Py_BuildValue((char *)"(ss(i))", name, format, dim0);
+	return Py_BuildValue((char *)"(ss)", name, format);
+}
+
+PyObject *py_unreal_engine_get_soft_skin_vertex_dtype(PyObject * self, PyObject * args)
+{
+	const char *bone_format = sizeof(ue_py_influence_bone) == 2 ? "<u2" : "u1";
+	const char *weight_format = sizeof(ue_py_influence_weight) == 2 ? "<u2" : "u1";
+
+	PyObject *py_list = PyList_New(8);
+	PyList_SetItem(py_list, 0, ue_py_skeletal_dtype_field("position", "<f4", 3, 0));
+	PyList_SetItem(py_list, 1, ue_py_skeletal_dtype_field("tangent_x", "<f4", 3, 0));
+	PyList_SetItem(py_list, 2, ue_py_skeletal_dtype_field("tangent_y", "<f4", 3, 0));
+	PyList_SetItem(py_list, 3, ue_py_skeletal_dtype_field("tangent_z", "<f4", 4, 0));
+	PyList_SetItem(py_list, 4, ue_py_skeletal_dtype_field("uvs", "<f4", MAX_TEXCOORDS, 2));
+	PyList_SetItem(py_list, 5, ue_py_skeletal_dtype_field("color", "u1", 4, 0));
+	PyList_SetItem(py_list, 6, ue_py_skeletal_dtype_field("influence_bones", bone_format, MAX_TOTAL_INFLUENCES, 0));
+	PyList_SetItem(py_list, 7, ue_py_skeletal_dtype_field("influence_weights", weight_format, MAX_TOTAL_INFLUENCES, 0));
+	return py_list;
+}
+
+PyObject *py_unreal_engine_get_morph_target_delta_dtype(PyObject * self, PyObject * args)
+{
+	PyObject *py_list = PyList_New(3);
+	PyList_SetItem(py_list, 0, ue_py_skeletal_dtype_field("position_delta", "<f4", 3, 0));
+	PyList_SetItem(py_list, 1, ue_py_skeletal_dtype_field("tangent_z_delta", "<f4", 3, 0));
+	PyList_SetItem(py_list, 2, ue_py_skeletal_dtype_field("source_idx", "<u4", 0, 0));
+	return py_list;
+}
+
+#endif
+
 
 PyObject *py_ue_get_anim_instance(ue_PyUObject *self, PyObject * args)
 {
@@ -242,25 +450,44 @@ PyObject *py_ue_skeletal_mesh_set_soft_vertices(ue_PyUObject *self, PyObject * a
 	if (section_index < 0 || section_index >= model.Sections.Num())
 		return PyErr_Format(PyExc_Exception, "invalid Section index, must be between 0 and %d", model.Sections.Num() - 1);
 
-	PyObject *py_iter = PyObject_GetIter(py_ss_vertex);
-	if (!py_iter)
-	{
-		return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
-	}
-
 	TArray<FSoftSkinVertex> soft_vertices;
 
-	while (PyObject *py_item = PyIter_Next(py_iter))
+	// structured buffer of FUEPySoftSkinVertexRecord
+	if (PyObject_CheckBuffer(py_ss_vertex))
 	{
-		ue_PyFSoftSkinVertex *ss_vertex = py_ue_is_fsoft_skin_vertex(py_item);
-		if (!ss_vertex)
+		Py_buffer py_buf;
+		int32 num = 0;
+		if (!ue_py_skeletal_get_records(py_ss_vertex, &py_buf, sizeof(FUEPySoftSkinVertexRecord), num))
+			return nullptr;
+
+		const FUEPySoftSkinVertexRecord *records = (const FUEPySoftSkinVertexRecord *)py_buf.buf;
+		soft_vertices.AddZeroed(num);
+		for (int32 i = 0; i < num; i++)
 		{
-			Py_DECREF(py_iter);
-			return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
+			ue_py_soft_skin_vertex_from_record(records[i], soft_vertices[i]);
 		}
-		soft_vertices.Add(ss_vertex->ss_vertex);
+		PyBuffer_Release(&py_buf);
+	}
+	else
+	{
+		PyObject *py_iter = PyObject_GetIter(py_ss_vertex);
+		if (!py_iter)
+		{
+			return PyErr_Format(PyExc_Exception, "argument is not a buffer or an iterable of FSoftSkinVertex");
+		}
+
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			ue_PyFSoftSkinVertex *ss_vertex = py_ue_is_fsoft_skin_vertex(py_item);
+			if (!ss_vertex)
+			{
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "argument is not a buffer or an iterable of FSoftSkinVertex");
+			}
+			soft_vertices.Add(ss_vertex->ss_vertex);
+		}
+		Py_DECREF(py_iter);
 	}
-	Py_DECREF(py_iter);
 
 	// temporarily disable all USkinnedMeshComponent's
 	TComponentReregisterContext<USkinnedMeshComponent> ReregisterContext;
@@ -331,6 +558,53 @@ PyObject *py_ue_skeletal_mesh_get_soft_vertices(ue_PyUObject *self, PyObject * a
 
 	return py_list;
 }
+
+PyObject *py_ue_skeletal_mesh_get_soft_vertices_buffer(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	int lod_index = 0;
+	int section_index = 0;
+	if (!PyArg_ParseTuple(args, "|ii:skeletal_mesh_get_soft_vertices_buffer", &lod_index, &section_index))
+		return nullptr;
+
+	USkeletalMesh *mesh = ue_py_check_type<USkeletalMesh>(self);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "uobject is not a USkeletalMesh");
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FSkeletalMeshResource *resource = mesh->GetImportedResource();
+#else
+	FSkeletalMeshModel *resource = mesh->GetImportedModel();
+#endif
+
+	if (lod_index < 0 || lod_index >= resource->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index, must be between 0 and %d", resource->LODModels.Num() - 1);
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FStaticLODModel &model = resource->LODModels[lod_index];
+#else
+	FSkeletalMeshLODModel &model = resource->LODModels[lod_index];
+#endif
+
+	if (section_index < 0 || section_index >= model.Sections.Num())
+		return PyErr_Format(PyExc_Exception, "invalid Section index, must be between 0 and %d", model.Sections.Num() - 1);
+
+	const TArray<FSoftSkinVertex> &soft_vertices = model.Sections[section_index].SoftVertices;
+
+	PyObject *py_bytes = PyBytes_FromStringAndSize(nullptr, soft_vertices.Num() * sizeof(FUEPySoftSkinVertexRecord));
+	if (!py_bytes)
+		return nullptr;
+
+	FUEPySoftSkinVertexRecord *records = (FUEPySoftSkinVertexRecord *)PyBytes_AsString(py_bytes);
+	for (int32 i = 0; i < soft_vertices.Num(); i++)
+	{
+		ue_py_soft_skin_vertex_to_record(soft_vertices[i], records[i]);
+	}
+
+	return py_bytes;
+}
 #endif
 
 PyObject* py_ue_skeletal_mesh_get_max_bone_influences(ue_PyUObject* self, PyObject* args)
@@ -1213,24 +1487,9 @@ PyObject *py_ue_morph_target_populate_deltas(ue_PyUObject *self, PyObject * args
 	if (lod_index < 0)
 		return PyErr_Format(PyExc_Exception, "invalid LOD index");
 
-	PyObject *py_iter = PyObject_GetIter(py_deltas);
-	if (!py_iter)
-		return PyErr_Format(PyExc_Exception, "argument is not an iterable of FMorphTargetDelta");
-
 	TArray<FMorphTargetDelta> deltas;
-
-	while (PyObject *py_item = PyIter_Next(py_iter))
-	{
-		ue_PyFMorphTargetDelta *py_delta = py_ue_is_fmorph_target_delta(py_item);
-		if (!py_delta)
-		{
-			Py_DECREF(py_iter);
-			return PyErr_Format(PyExc_Exception, "argument is not an iterable of FMorphTargetDelta");
-		}
-		deltas.Add(py_delta->morph_target_delta);
-	}
-
-	Py_DECREF(py_iter);
+	if (!ue_py_morph_target_deltas_from_arg(py_deltas, deltas))
+		return nullptr;
 
 #if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
 	morph->PopulateDeltas(deltas, lod_index);
@@ -1287,6 +1546,223 @@ PyObject *py_ue_morph_target_get_deltas(ue_PyUObject *self, PyObject * args)
 	return py_list;
 }
 
+PyObject *py_ue_morph_target_get_deltas_buffer(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	int lod_index = 0;
+
+	if (!PyArg_ParseTuple(args, "|i:morph_target_get_deltas_buffer", &lod_index))
+	{
+		return nullptr;
+	}
+
+	UMorphTarget *morph = ue_py_check_type<UMorphTarget>(self);
+	if (!morph)
+		return PyErr_Format(PyExc_Exception, "uobject is not a MorphTarget");
+
+#if ENGINE_MAJOR_VERSION == 5
+	TArray<FMorphTargetLODModel> &lod_models = morph->GetMorphLODModels();
+#else
+	TArray<FMorphTargetLODModel> &lod_models = morph->MorphLODModels;
+#endif
+
+	if (lod_index < 0 || lod_index >= lod_models.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index");
+
+	const TArray<FMorphTargetDelta> &deltas = lod_models[lod_index].Vertices;
+
+	PyObject *py_bytes = PyBytes_FromStringAndSize(nullptr, deltas.Num() * sizeof(FUEPyMorphTargetDeltaRecord));
+	if (!py_bytes)
+		return nullptr;
+
+	FUEPyMorphTargetDeltaRecord *records = (FUEPyMorphTargetDeltaRecord *)PyBytes_AsString(py_bytes);
+	for (int32 i = 0; i < deltas.Num(); i++)
+	{
+		const FMorphTargetDelta &delta = deltas[i];
+		records[i].PositionDelta[0] = delta.PositionDelta.X;
+		records[i].PositionDelta[1] = delta.PositionDelta.Y;
+		records[i].PositionDelta[2] = delta.PositionDelta.Z;
+		records[i].TangentZDelta[0] = delta.TangentZDelta.X;
+		records[i].TangentZDelta[1] = delta.TangentZDelta.Y;
+		records[i].TangentZDelta[2] = delta.TangentZDelta.Z;
+		records[i].SourceIdx = delta.SourceIdx;
+	}
+
+	return py_bytes;
+}
+
+PyObject *py_ue_skeletal_mesh_import_morph_targets(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	PyObject *py_morphs;
+	int lod_index = 0;
+
+	if (!PyArg_ParseTuple(args, "O|i:skeletal_mesh_import_morph_targets", &py_morphs, &lod_index))
+	{
+		return nullptr;
+	}
+
+	USkeletalMesh *mesh = ue_py_check_type<USkeletalMesh>(self);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "uobject is not a SkeletalMesh");
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FSkeletalMeshResource *resource = mesh->GetImportedResource();
+#else
+	FSkeletalMeshModel *resource = mesh->GetImportedModel();
+#endif
+
+	if (lod_index < 0 || lod_index >= resource->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index, must be between 0 and %d", resource->LODModels.Num() - 1);
+
+	PyObject *py_iter = nullptr;
+	// a dictionary is iterated as (key, value) pairs
+	if (PyDict_Check(py_morphs))
+	{
+		PyObject *py_items = PyDict_Items(py_morphs);
+		py_iter = PyObject_GetIter(py_items);
+		Py_DECREF(py_items);
+	}
+	else
+	{
+		py_iter = PyObject_GetIter(py_morphs);
+	}
+	if (!py_iter)
+		return PyErr_Format(PyExc_Exception, "argument is not a dictionary or an iterable of (name or MorphTarget, deltas) pairs");
+
+	// missing morph targets are created only once every pair has been validated
+	TArray<UMorphTarget *> morphs;
+	TArray<FName> new_morphs_names;
+	TArray<TArray<FMorphTargetDelta>> morphs_deltas;
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		if (!PyTuple_Check(py_item) || PyTuple_Size(py_item) != 2)
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_Exception, "argument is not a dictionary or an iterable of (name or MorphTarget, deltas) pairs");
+		}
+		PyObject *py_key = PyTuple_GetItem(py_item, 0);
+		PyObject *py_deltas = PyTuple_GetItem(py_item, 1);
+
+		UMorphTarget *morph = nullptr;
+		FName new_name = NAME_None;
+		if (PyUnicodeOrString_Check(py_key))
+		{
+			// existing morph targets are updated, the others are created
+			FName name = FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_key)));
+			morph = mesh->FindMorphTarget(name);
+			if (!morph)
+				morph = FindObject<UMorphTarget>(mesh, *name.ToString());
+			if (!morph)
+				new_name = name;
+		}
+		else
+		{
+			morph = ue_py_check_type<UMorphTarget>(py_key);
+			if (!morph || morph->GetOuter() != mesh)
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "keys must be names or MorphTargets of this SkeletalMesh");
+			}
+		}
+
+		if ((morph && morphs.Contains(morph)) || (!morph && new_morphs_names.Contains(new_name)))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_Exception, "MorphTarget %s specified multiple times", TCHAR_TO_UTF8(*(morph ? morph->GetName() : new_name.ToString())));
+		}
+
+		int32 deltas_index = morphs_deltas.AddDefaulted();
+		bool valid = ue_py_morph_target_deltas_from_arg(py_deltas, morphs_deltas[deltas_index]);
+		Py_DECREF(py_item);
+		if (!valid)
+		{
+			Py_DECREF(py_iter);
+			return nullptr;
+		}
+
+		morphs.Add(morph);
+		new_morphs_names.Add(new_name);
+	}
+
+	Py_DECREF(py_iter);
+
+	if (PyErr_Occurred())
+		return nullptr;
+
+	for (int32 i = 0; i < morphs.Num(); i++)
+	{
+		if (!morphs[i])
+			morphs[i] = NewObject<UMorphTarget>(mesh, new_morphs_names[i]);
+	}
+
+	// every morph target owns its LOD models, so they can be populated concurrently
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	ParallelFor(morphs.Num(), [&](int32 i)
+	{
+		morphs[i]->PopulateDeltas(morphs_deltas[i], lod_index);
+	});
+#else
+	const TArray<FSkelMeshSection> &sections = resource->LODModels[lod_index].Sections;
+	ParallelFor(morphs.Num(), [&](int32 i)
+	{
+		morphs[i]->PopulateDeltas(morphs_deltas[i], lod_index, sections);
+	});
+#endif
+
+	// registered morph targets (None when the engine dropped all of the deltas)
+	PyObject *py_list = PyList_New(morphs.Num());
+	TArray<UMorphTarget *> valid_morphs;
+	for (int32 i = 0; i < morphs.Num(); i++)
+	{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 16)
+		if (!morphs[i]->HasValidData())
+		{
+			Py_INCREF(Py_None);
+			PyList_SetItem(py_list, i, Py_None);
+			continue;
+		}
+#endif
+		valid_morphs.Add(morphs[i]);
+		PyObject *py_morph = (PyObject *)ue_get_python_uobject_inc(morphs[i]);
+		PyList_SetItem(py_list, i, py_morph);
+	}
+
+	if (valid_morphs.Num() > 0)
+	{
+		// the render data is rebuilt once for the whole batch instead of once per morph target
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 22)
+		for (UMorphTarget *morph : valid_morphs)
+		{
+			mesh->RegisterMorphTarget(morph, false);
+		}
+		mesh->InitMorphTargetsAndRebuildRenderData();
+#else
+		TComponentReregisterContext<USkinnedMeshComponent> ReregisterContext;
+
+		mesh->ReleaseResources();
+		mesh->ReleaseResourcesFence.Wait();
+
+		for (UMorphTarget *morph : valid_morphs)
+		{
+			mesh->RegisterMorphTarget(morph);
+		}
+
+		mesh->PostEditChange();
+		mesh->InitResources();
+#endif
+		mesh->MarkPackageDirty();
+	}
+
+	return py_list;
+}
+
 PyObject *py_ue_skeletal_mesh_to_import_vertex_map(ue_PyUObject *self, PyObject * args)
 {
 	ue_py_check(self);
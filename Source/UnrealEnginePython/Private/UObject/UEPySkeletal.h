@@ -16,6 +16,7 @@ PyObject *py_ue_skeleton_add_bone(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_skeletal_mesh_set_soft_vertices(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_soft_vertices(ue_PyUObject *, PyObject *);
+PyObject *py_ue_skeletal_mesh_get_soft_vertices_buffer(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_set_skeleton(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_lod(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_raw_indices(ue_PyUObject *, PyObject *);
@@ -34,7 +35,15 @@ PyObject *py_ue_skeletal_mesh_sections_num(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *, PyObject *, PyObject *);
 
 PyObject *py_ue_skeletal_mesh_register_morph_target(ue_PyUObject *, PyObject *);
+PyObject *py_ue_skeletal_mesh_import_morph_targets(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_morph_target_populate_deltas(ue_PyUObject *, PyObject *);
 PyObject *py_ue_morph_target_get_deltas(ue_PyUObject *, PyObject *);
+PyObject *py_ue_morph_target_get_deltas_buffer(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_to_import_vertex_map(ue_PyUObject *, PyObject *);
+
+#if WITH_EDITOR
+// record layouts of the *_buffer functions, as numpy.dtype() descriptions
+PyObject *py_unreal_engine_get_soft_skin_vertex_dtype(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_morph_target_delta_dtype(PyObject *, PyObject *);
+#endif
@@ -4,6 +4,8 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/Texture2D.h"
 #include "Misc/App.h"
+#include "Wrappers/UEPyFTextureMipLock.h"
+#include "Wrappers/UEPyFRenderTargetReadback.h"
 
 PyObject *py_ue_texture_update_resource(ue_PyUObject *self, PyObject * args)
 {
@@ -363,6 +365,43 @@ PyObject *py_ue_render_target_get_data(ue_PyUObject *self, PyObject * args)
 	return PyByteArray_FromStringAndSize((const char *)pixels.GetData(), (Py_ssize_t)(pixels.GetTypeSize() * pixels.Num()));
 }
 
+PyObject *py_ue_texture_lock_mip(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	int mipmap = 0;
+	PyObject *py_writable = nullptr;
+
+	if (!PyArg_ParseTuple(args, "|iO:texture_lock_mip", &mipmap, &py_writable))
+	{
+		return nullptr;
+	}
+
+	UTexture2D *tex = ue_py_check_type<UTexture2D>(self);
+	if (!tex)
+		return PyErr_Format(PyExc_Exception, "object is not a Texture2D");
+
+	if (mipmap < 0 || mipmap >= tex->GetNumMips())
+		return PyErr_Format(PyExc_Exception, "invalid mipmap id");
+
+	return py_ue_new_ftexture_mip_lock(tex, mipmap, py_writable && PyObject_IsTrue(py_writable));
+}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+PyObject *py_ue_render_target_read_async(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	UTextureRenderTarget2D *tex = ue_py_check_type<UTextureRenderTarget2D>(self);
+	if (!tex)
+		return PyErr_Format(PyExc_Exception, "object is not a TextureRenderTarget");
+
+	return py_ue_new_frender_target_readback(tex);
+}
+#endif
+
 PyObject *py_ue_render_target_get_data_to_buffer(ue_PyUObject *self, PyObject * args)
 {
 
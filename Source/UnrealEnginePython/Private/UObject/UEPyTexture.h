@@ -7,6 +7,10 @@
 PyObject *py_ue_texture_get_data(ue_PyUObject *, PyObject *);
 PyObject *py_ue_render_target_get_data(ue_PyUObject *, PyObject *);
 PyObject *py_ue_render_target_get_data_to_buffer(ue_PyUObject *, PyObject *);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+PyObject *py_ue_render_target_read_async(ue_PyUObject *, PyObject *);
+#endif
+PyObject *py_ue_texture_lock_mip(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_texture_set_data(ue_PyUObject *, PyObject *);
 PyObject *py_ue_texture_get_width(ue_PyUObject *, PyObject *);
@@ -706,3 +706,268 @@ PyObject *py_ue_set_relative_scale(ue_PyUObject *self, PyObject * args)
 	}
 	return PyErr_Format(PyExc_Exception, "uobject is not a USceneComponent");
 }
+
+// batched transforms, one float row per actor (or scene component):
+// stride 3 is the world location, stride 4 the world rotation quaternion (x, y, z, w)
+// and stride 10 the whole world transform (location, rotation quaternion, scale)
+static bool ue_py_batch_stride_is_valid(int stride)
+{
+	return stride == 3 || stride == 4 || stride == 10;
+}
+
+// validate everything before touching any transform
+static bool ue_py_batch_resolve_components(PyObject *py_objects, TArray<USceneComponent *> &components)
+{
+	PyObject *py_sequence = PySequence_Fast(py_objects, "argument is not a sequence of actors or components");
+	if (!py_sequence)
+		return false;
+
+	Py_ssize_t len = PySequence_Fast_GET_SIZE(py_sequence);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_sequence);
+	components.Reserve(len);
+	for (Py_ssize_t i = 0; i < len; i++)
+	{
+		USceneComponent *component = nullptr;
+		if (AActor *actor = ue_py_check_type<AActor>(py_items[i]))
+		{
+			component = actor->GetRootComponent();
+			if (!component)
+			{
+				PyErr_Format(PyExc_Exception, "actor at index %d has no root component", (int)i);
+				Py_DECREF(py_sequence);
+				return false;
+			}
+		}
+		else
+		{
+			component = ue_py_check_type<USceneComponent>(py_items[i]);
+			if (!component)
+			{
+				PyErr_Format(PyExc_TypeError, "item at index %d is not an actor or a USceneComponent", (int)i);
+				Py_DECREF(py_sequence);
+				return false;
+			}
+		}
+		components.Add(component);
+	}
+
+	Py_DECREF(py_sequence);
+	return true;
+}
+
+// raw bytes are accepted too, otherwise items must be 32 bit floats
+static bool ue_py_batch_buffer_is_float(Py_buffer *py_buf)
+{
+	const char *format = py_buf->format ? py_buf->format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+	if (!strcmp(format, "B") || !strcmp(format, "b") || !strcmp(format, "c"))
+		return true;
+	return !strcmp(format, "f");
+}
+
+// the buffer is accessed as float *, raw bytes (slices of a bytearray...) could start anywhere
+static bool ue_py_batch_buffer_is_aligned(Py_buffer *py_buf)
+{
+	return ((UPTRINT)py_buf->buf % alignof(float)) == 0;
+}
+
+static void ue_py_batch_read_transform(USceneComponent *component, int stride, float *row)
+{
+	if (stride == 3)
+	{
+		FVector location = component->GetComponentLocation();
+		row[0] = location.X; row[1] = location.Y; row[2] = location.Z;
+		return;
+	}
+
+	if (stride == 4)
+	{
+		FQuat quat = component->GetComponentQuat();
+		row[0] = quat.X; row[1] = quat.Y; row[2] = quat.Z; row[3] = quat.W;
+		return;
+	}
+
+	const FTransform &transform = component->GetComponentTransform();
+	FVector location = transform.GetLocation();
+	FQuat quat = transform.GetRotation();
+	FVector scale = transform.GetScale3D();
+	row[0] = location.X; row[1] = location.Y; row[2] = location.Z;
+	row[3] = quat.X; row[4] = quat.Y; row[5] = quat.Z; row[6] = quat.W;
+	row[7] = scale.X; row[8] = scale.Y; row[9] = scale.Z;
+}
+
+PyObject *py_unreal_engine_get_actor_transforms(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_objects;
+	int stride = 10;
+	PyObject *py_out = nullptr;
+
+	static char *kw_names[] = { (char *)"actors", (char *)"stride", (char *)"out", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|iO:get_actor_transforms", kw_names, &py_objects, &stride, &py_out))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_batch_stride_is_valid(stride))
+		return PyErr_Format(PyExc_ValueError, "stride must be 3 (location), 4 (rotation) or 10 (transform)");
+
+	TArray<USceneComponent *> components;
+	if (!ue_py_batch_resolve_components(py_objects, components))
+		return nullptr;
+
+	Py_ssize_t len = components.Num() * stride * sizeof(float);
+
+	// fill a preallocated buffer (like a numpy array reused every frame)
+	if (py_out && py_out != Py_None)
+	{
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_out, &py_buf, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+			return nullptr;
+
+		if (!ue_py_batch_buffer_is_float(&py_buf) || py_buf.len != len)
+		{
+			PyBuffer_Release(&py_buf);
+			return PyErr_Format(PyExc_ValueError, "out must be a writable float buffer of %d bytes", (int)len);
+		}
+
+		if (!ue_py_batch_buffer_is_aligned(&py_buf))
+		{
+			PyBuffer_Release(&py_buf);
+			return PyErr_Format(PyExc_ValueError, "out must be aligned to %d bytes", (int)alignof(float));
+		}
+
+		float *data = (float *)py_buf.buf;
+		for (int32 i = 0; i < components.Num(); i++)
+		{
+			ue_py_batch_read_transform(components[i], stride, data + (i * stride));
+		}
+
+		PyBuffer_Release(&py_buf);
+		Py_INCREF(py_out);
+		return py_out;
+	}
+
+	PyObject *py_bytes = PyBytes_FromStringAndSize(nullptr, len);
+	if (!py_bytes)
+		return nullptr;
+
+	float *data = (float *)PyBytes_AsString(py_bytes);
+	for (int32 i = 0; i < components.Num(); i++)
+	{
+		ue_py_batch_read_transform(components[i], stride, data + (i * stride));
+	}
+
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_memoryview = PyMemoryView_FromObject(py_bytes);
+	Py_DECREF(py_bytes);
+	if (!py_memoryview)
+		return nullptr;
+	PyObject *py_typed;
+	// memoryview.cast() does not accept zeros in the shape
+	if (components.Num() > 0)
+		py_typed = PyObject_CallMethod(py_memoryview, (char *)"cast", (char *)"s(ii)", "f", components.Num(), stride);
+	else
+		py_typed = PyObject_CallMethod(py_memoryview, (char *)"cast", (char *)"s", "f");
+	Py_DECREF(py_memoryview);
+	return py_typed;
+#else
+	return py_bytes;
+#endif
+}
+
+PyObject *py_unreal_engine_set_actor_transforms(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_objects;
+	PyObject *py_data;
+	PyObject *py_sweep = nullptr;
+	PyObject *py_teleport_physics = nullptr;
+
+	static char *kw_names[] = { (char *)"actors", (char *)"data", (char *)"sweep", (char *)"teleport_physics", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OO:set_actor_transforms", kw_names, &py_objects, &py_data, &py_sweep, &py_teleport_physics))
+	{
+		return nullptr;
+	}
+
+	bool sweep = py_sweep && PyObject_IsTrue(py_sweep);
+	ETeleportType teleport = (py_teleport_physics && PyObject_IsTrue(py_teleport_physics)) ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+	TArray<USceneComponent *> components;
+	if (!ue_py_batch_resolve_components(py_objects, components))
+		return nullptr;
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_data, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return nullptr;
+
+	if (!ue_py_batch_buffer_is_float(&py_buf))
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s'", py_buf.format ? py_buf.format : "B");
+		PyBuffer_Release(&py_buf);
+		return nullptr;
+	}
+
+	if (!ue_py_batch_buffer_is_aligned(&py_buf))
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_ValueError, "buffer must be aligned to %d bytes", (int)alignof(float));
+	}
+
+	// the row size is deduced from the buffer size
+	int stride = 0;
+	if (components.Num() > 0 && py_buf.len % (components.Num() * sizeof(float)) == 0)
+		stride = py_buf.len / (components.Num() * sizeof(float));
+
+	if (components.Num() > 0 && !ue_py_batch_stride_is_valid(stride))
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) does not match %d rows of 3, 4 or 10 floats", (int)py_buf.len, components.Num());
+		PyBuffer_Release(&py_buf);
+		return nullptr;
+	}
+
+	// indices of the components whose sweep has been blocked
+	PyObject *py_blocked = sweep ? PyList_New(0) : nullptr;
+
+	const float *data = (const float *)py_buf.buf;
+	FHitResult hit;
+	for (int32 i = 0; i < components.Num(); i++)
+	{
+		const float *row = data + (i * stride);
+		USceneComponent *component = components[i];
+		FHitResult *out_hit = nullptr;
+		if (sweep)
+		{
+			hit = FHitResult();
+			out_hit = &hit;
+		}
+		if (stride == 3)
+		{
+			component->SetWorldLocation(FVector(row[0], row[1], row[2]), sweep, out_hit, teleport);
+		}
+		else if (stride == 4)
+		{
+			component->SetWorldRotation(FQuat(row[0], row[1], row[2], row[3]), sweep, out_hit, teleport);
+		}
+		else
+		{
+			FTransform transform(FQuat(row[3], row[4], row[5], row[6]), FVector(row[0], row[1], row[2]), FVector(row[7], row[8], row[9]));
+			component->SetWorldTransform(transform, sweep, out_hit, teleport);
+		}
+
+		if (sweep && hit.bBlockingHit)
+		{
+			PyObject *py_index = PyLong_FromLong(i);
+			PyList_Append(py_blocked, py_index);
+			Py_DECREF(py_index);
+		}
+	}
+
+	PyBuffer_Release(&py_buf);
+
+	if (sweep)
+		return py_blocked;
+
+	Py_RETURN_NONE;
+}
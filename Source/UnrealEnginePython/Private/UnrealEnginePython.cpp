@@ -3,6 +3,7 @@
 #include "UnrealEnginePython.h"
 #include "UEPyModule.h"
 #include "PythonBlueprintFunctionLibrary.h"
+#include "Wrappers/UEPyFPythonOutputDevice.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFilemanager.h"
 #if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 13))
@@ -67,7 +68,7 @@ const char *ue4_module_options = "linux_global_symbols";
 #include "Android/AndroidApplication.h"
 #endif
 
-#include "include/marshal.h" // for PyMarshal_ReadLongFromFile
+#include "UEPyCodeCache.h"
 
 const char *UEPyUnicode_AsUTF8(PyObject *py_str)
 {
@@ -197,20 +198,15 @@ void FUnrealEnginePythonModule::UESetupPythonInterpreter(bool verbose)
 
 static void setup_stdout_stderr()
 {
-	// Redirecting stdout
-	char const* code = "import sys\n"
-		"import unreal_engine\n"
-		"class UnrealEngineOutput:\n"
-		"    def __init__(self, logger):\n"
-		"        self.logger = logger\n"
-		"    def write(self, buf):\n"
-		"        self.logger(buf)\n"
-		"    def flush(self):\n"
-		"        return\n"
-		"    def isatty(self):\n"
-		"        return False\n"
-		"sys.stdout = UnrealEngineOutput(unreal_engine.log)\n"
-		"sys.stderr = UnrealEngineOutput(unreal_engine.log_error)\n"
+	// Redirecting stdout and stderr to native line buffered writers
+	PyObject *py_stdout = py_ue_new_unreal_engine_output(false);
+	PySys_SetObject((char *)"stdout", py_stdout);
+	Py_XDECREF(py_stdout);
+	PyObject *py_stderr = py_ue_new_unreal_engine_output(true);
+	PySys_SetObject((char *)"stderr", py_stderr);
+	Py_XDECREF(py_stderr);
+
+	char const* code = "import unreal_engine\n"
 		"\n"
 		"class event:\n"
 		"    def __init__(self, event_signature):\n"
@@ -256,6 +252,14 @@ namespace
 		}
 	}
 
+	static void consoleCodeCacheStats(const TArray<FString>& Args)
+	{
+		FScopePythonGIL gil;
+		FUnrealEnginePythonCodeCache *Cache = FUnrealEnginePythonCodeCache::Get();
+		UE_LOG(LogPython, Display, TEXT("Python code cache: %d entries, %llu hits, %llu misses, %llu disk hits, %llu disk writes, compile time %.3fs, compile time saved %.3fs"),
+			Cache->NumEntries(), Cache->Hits, Cache->Misses, Cache->DiskHits, Cache->DiskWrites, Cache->CompileTime, Cache->CompileTimeSaved);
+	}
+
 }
 FAutoConsoleCommand ExecPythonScriptCommand(
 	TEXT("py.exec"),
@@ -267,6 +271,11 @@ FAutoConsoleCommand ExecPythonStringCommand(
 	*NSLOCTEXT("UnrealEnginePython", "CommandText_Cmd", "Execute python string").ToString(),
 	FConsoleCommandWithArgsDelegate::CreateStatic(consoleExecString));
 
+FAutoConsoleCommand CodeCacheStatsCommand(
+	TEXT("py.codecache"),
+	*NSLOCTEXT("UnrealEnginePython", "CommandText_CodeCache", "Report python code cache stats").ToString(),
+	FConsoleCommandWithArgsDelegate::CreateStatic(consoleCodeCacheStats));
+
 
 void FUnrealEnginePythonModule::StartupModule()
 {
@@ -383,6 +392,12 @@ void FUnrealEnginePythonModule::StartupModule()
 		ZipPath = FPaths::Combine(*PROJECT_CONTENT_DIR, *IniValue);
 	}
 
+	bool bPersistentCodeCache = false;
+	if (GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("PersistentCodeCache"), bPersistentCodeCache, GEngineIni))
+	{
+		FUnrealEnginePythonCodeCache::Get()->SetPersistent(bPersistentCodeCache);
+	}
+
 	if (GConfig->GetString(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("ImportModules"), IniValue, GEngineIni))
 	{
 		const TCHAR* separators[] = { TEXT(" "), TEXT(";"), TEXT(",") };
@@ -610,6 +625,7 @@ void FUnrealEnginePythonModule::ShutdownModule()
 	if (!BrutalFinalize)
 	{
 		PyGILState_Ensure();
+		ue_py_uscriptstruct_freelists_flush();
 		Py_Finalize();
 	}
 }
@@ -618,7 +634,15 @@ void FUnrealEnginePythonModule::RunString(char *str)
 {
 	FScopePythonGIL gil;
 
-	PyObject *eval_ret = PyRun_String(str, Py_file_input, (PyObject *)main_dict, (PyObject *)local_dict);
+	PyObject *code = FUnrealEnginePythonCodeCache::Get()->GetStringCode(str);
+	if (!code)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+
+	PyObject *eval_ret = PyEval_EvalCode(code, (PyObject *)main_dict, (PyObject *)local_dict);
+	Py_DECREF(code);
 	if (!eval_ret)
 	{
 		if (PyErr_ExceptionMatches(PyExc_SystemExit))
@@ -722,56 +746,16 @@ void FUnrealEnginePythonModule::RunFile(char *filename)
 		return;
 	}
 
-	bool is_pyc = full_path.EndsWith(TEXT(".pyc"));
-
-	FILE *fd = nullptr;
-
-	if (is_pyc)
-	{
-		fopen_s(&fd, TCHAR_TO_UTF8(*full_path), "rb");
-	}
-	else
-	{
-		fopen_s(&fd, TCHAR_TO_UTF8(*full_path), "r");
-	}
-
-	if (!fd)
+	// compiled code (or the content of .pyc files) is reused until the file changes
+	PyObject *code = FUnrealEnginePythonCodeCache::Get()->GetFileCode(full_path);
+	if (!code)
 	{
-		UE_LOG(LogPython, Error, TEXT("Unable to open file %s"), *full_path);
+		unreal_engine_py_log_error();
 		return;
-}
-
-	PyObject *eval_ret;
-	if (is_pyc)
-	{
-		long file_magic = PyMarshal_ReadLongFromFile(fd);
-		long magic = PyImport_GetMagicNumber();
-		if (file_magic != magic) {
-			if (!PyErr_Occurred())
-				PyErr_SetString(PyExc_RuntimeError, "Bad magic number in .pyc file"); \
-				goto error;
-		}
-		/* Skip the rest of the header. */
-		(void)PyMarshal_ReadLongFromFile(fd);
-		(void)PyMarshal_ReadLongFromFile(fd);
-		(void)PyMarshal_ReadLongFromFile(fd);
-		if (PyErr_Occurred()) {
-			goto error;
-		}
-		PyObject *v = PyMarshal_ReadLastObjectFromFile(fd);
-		if (v == NULL || !PyCode_Check(v)) {
-			Py_XDECREF(v);
-			PyErr_SetString(PyExc_RuntimeError,
-				"Bad code object in .pyc file");
-			goto error;
-		}
-		eval_ret = PyEval_EvalCode(v, (PyObject *)main_dict, (PyObject *)local_dict);
-	}
-	else
-	{
-		eval_ret = PyRun_File(fd, TCHAR_TO_UTF8(*full_path), Py_file_input, (PyObject *)main_dict, (PyObject *)local_dict);
 	}
-	fclose(fd);
+
+	PyObject *eval_ret = PyEval_EvalCode(code, (PyObject *)main_dict, (PyObject *)local_dict);
+	Py_DECREF(code);
 	if (!eval_ret)
 	{
 		if (PyErr_ExceptionMatches(PyExc_SystemExit))
@@ -779,13 +763,10 @@ void FUnrealEnginePythonModule::RunFile(char *filename)
 			PyErr_Clear();
 			return;
 		}
-		goto error;
+		unreal_engine_py_log_error();
+		return;
 	}
-	Py_XDECREF(eval_ret);
-	return;
-error:
-	fclose(fd);
-	unreal_engine_py_log_error();
+	Py_DECREF(eval_ret);
 }
 
 
@@ -4,6 +4,7 @@
 
 #include "ObjectTools.h"
 #include "Wrappers/UEPyFObjectThumbnail.h"
+#include "Wrappers/UEPyFAssetLoadRequest.h"
 
 static PyObject *py_ue_fassetdata_get_asset(ue_PyFAssetData *self, PyObject * args)
 {
@@ -17,6 +18,22 @@ static PyObject *py_ue_fassetdata_is_asset_loaded(ue_PyFAssetData *self, PyObjec
 	Py_RETURN_FALSE;
 }
 
+static PyObject *py_ue_fassetdata_load_async(ue_PyFAssetData *self, PyObject * args)
+{
+	PyObject *py_callback;
+	if (!PyArg_ParseTuple(args, "O:load_async", &py_callback))
+	{
+		return nullptr;
+	}
+
+	if (!PyCallable_Check(py_callback))
+		return PyErr_Format(PyExc_Exception, "argument is not callable");
+
+	TArray<FAssetData> assets;
+	assets.Add(self->asset_data);
+	return py_ue_new_fasset_load_request(assets, py_callback, 1, 1, false);
+}
+
 static PyObject *py_ue_fassetdata_get_thumbnail(ue_PyFAssetData *self, PyObject * args)
 {
 	TArray<FName> names;
@@ -70,6 +87,7 @@ static PyObject *py_ue_fassetdata_has_cached_thumbnail(ue_PyFAssetData *self, Py
 static PyMethodDef ue_PyFAssetData_methods[] = {
 	{ "get_asset", (PyCFunction)py_ue_fassetdata_get_asset, METH_VARARGS, "" },
 	{ "is_asset_loaded", (PyCFunction)py_ue_fassetdata_is_asset_loaded, METH_VARARGS, "" },
+	{ "load_async", (PyCFunction)py_ue_fassetdata_load_async, METH_VARARGS, "" },
 	{ "get_thumbnail", (PyCFunction)py_ue_fassetdata_get_thumbnail, METH_VARARGS, "" },
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
@@ -0,0 +1,338 @@
+#include "UEPyFAssetLoadRequest.h"
+
+#if WITH_EDITOR
+
+#include "Wrappers/UEPyFAssetData.h"
+#include "UEPyAsyncio.h"
+
+static FStreamableManager &ue_py_get_streamable_manager()
+{
+	static FStreamableManager StreamableManager;
+	return StreamableManager;
+}
+
+FUEPyAssetLoadRequest::~FUEPyAssetLoadRequest()
+{
+	if (PyCallback || Waiters.Num() > 0)
+	{
+		FScopePythonGIL gil;
+		Py_XDECREF(PyCallback);
+		for (PyObject *py_future : Waiters)
+		{
+			Py_DECREF(py_future);
+		}
+	}
+}
+
+void FUEPyAssetLoadRequest::ResolveWaiters()
+{
+	TArray<PyObject *> Futures = MoveTemp(Waiters);
+	Waiters.Empty();
+	for (PyObject *py_future : Futures)
+	{
+#if PY_MAJOR_VERSION >= 3
+		// awaiting a cancelled request raises CancelledError
+		if (bCancelled)
+		{
+			PyObject *ret = PyObject_CallMethod(py_future, (char *)"cancel", nullptr);
+			if (!ret)
+				unreal_engine_py_log_error();
+			else
+				Py_DECREF(ret);
+		}
+		else if (!ue_py_asyncio_resolve_future(py_future, Py_None, Py_None))
+		{
+			unreal_engine_py_log_error();
+		}
+#endif
+		Py_DECREF(py_future);
+	}
+}
+
+void FUEPyAssetLoadRequest::Pump()
+{
+	// a batch of already loaded assets could complete while requesting it
+	if (bPumping)
+		return;
+	bPumping = true;
+
+	while (!bCancelled && NextAsset < Assets.Num() && InFlight < MaxInFlight)
+	{
+		int32 First = NextAsset;
+		int32 Num = FMath::Min3(BatchSize, MaxInFlight - InFlight, Assets.Num() - NextAsset);
+		NextAsset += Num;
+		InFlight += Num;
+
+		TArray<FSoftObjectPath> Paths;
+		Paths.Reserve(Num);
+		for (int32 i = First; i < First + Num; i++)
+		{
+			Paths.Add(Assets[i].ToSoftObjectPath());
+		}
+
+		// the request stays alive (and keeps streaming) even if python drops it
+		TSharedRef<FUEPyAssetLoadRequest> Self = AsShared();
+		TSharedPtr<FStreamableHandle> Handle = ue_py_get_streamable_manager().RequestAsyncLoad(Paths, FStreamableDelegate::CreateLambda([Self, First, Num]()
+		{
+			Self->OnBatchLoaded(First, Num);
+		}));
+		if (Handle.IsValid() && !bCancelled)
+		{
+			Handles.Add(Handle);
+		}
+	}
+
+	bPumping = false;
+}
+
+void FUEPyAssetLoadRequest::OnBatchLoaded(int32 First, int32 Num)
+{
+	InFlight -= Num;
+	Loaded += Num;
+
+	if (bCancelled || !PyCallback)
+		return;
+
+	{
+		FScopePythonGIL gil;
+
+		PyObject *py_list = PyList_New(0);
+		for (int32 i = First; i < First + Num; i++)
+		{
+			const FAssetData &Asset = Assets[i];
+			// never fall back to a synchronous load for packages that failed to load
+			UObject *u_object = Asset.FastGetAsset(false);
+			if (!u_object)
+				continue;
+			if (bReturnAssetData)
+			{
+				PyObject *py_asset_data = py_ue_new_fassetdata(Asset);
+				PyList_Append(py_list, py_asset_data);
+				Py_DECREF(py_asset_data);
+			}
+			else
+			{
+				ue_PyUObject *py_u_object = ue_get_python_uobject(u_object);
+				if (py_u_object)
+				{
+					PyList_Append(py_list, (PyObject *)py_u_object);
+				}
+			}
+		}
+
+		// the callback could cancel the request
+		PyObject *py_callback = PyCallback;
+		Py_INCREF(py_callback);
+		PyObject *ret = PyObject_CallFunctionObjArgs(py_callback, py_list, nullptr);
+		Py_DECREF(py_callback);
+		Py_DECREF(py_list);
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+		}
+		else
+		{
+			Py_DECREF(ret);
+		}
+	}
+
+	// delivered assets are no more referenced by the request
+	Handles.RemoveAll([](const TSharedPtr<FStreamableHandle> &Handle) { return Handle->HasLoadCompleted(); });
+
+	Pump();
+
+	if (IsDone())
+	{
+		Handles.Empty();
+		if (PyCallback || Waiters.Num() > 0)
+		{
+			// break cycles between the callback and the request
+			FScopePythonGIL gil;
+			Py_CLEAR(PyCallback);
+			ResolveWaiters();
+		}
+	}
+}
+
+void FUEPyAssetLoadRequest::Cancel()
+{
+	bCancelled = true;
+	for (TSharedPtr<FStreamableHandle> &Handle : Handles)
+	{
+		Handle->CancelHandle();
+	}
+	Handles.Empty();
+	Py_CLEAR(PyCallback);
+	ResolveWaiters();
+}
+
+static PyObject *py_ue_fasset_load_request_done(ue_PyFAssetLoadRequest *self, PyObject * args)
+{
+	if (self->request->IsDone())
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fasset_load_request_cancel(ue_PyFAssetLoadRequest *self, PyObject * args)
+{
+	self->request->Cancel();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fasset_load_request_cancelled(ue_PyFAssetLoadRequest *self, PyObject * args)
+{
+	if (self->request->bCancelled)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fasset_load_request_get_progress(ue_PyFAssetLoadRequest *self, PyObject * args)
+{
+	return Py_BuildValue((char *)"(ii)", self->request->Loaded, self->request->Assets.Num());
+}
+
+static PyObject *py_ue_fasset_load_request_get_in_flight(ue_PyFAssetLoadRequest *self, PyObject * args)
+{
+	return PyLong_FromLong(self->request->InFlight);
+}
+
+static PyMethodDef ue_PyFAssetLoadRequest_methods[] = {
+	{ "done", (PyCFunction)py_ue_fasset_load_request_done, METH_VARARGS, "" },
+	{ "cancel", (PyCFunction)py_ue_fasset_load_request_cancel, METH_VARARGS, "" },
+	{ "cancelled", (PyCFunction)py_ue_fasset_load_request_cancelled, METH_VARARGS, "" },
+	{ "get_progress", (PyCFunction)py_ue_fasset_load_request_get_progress, METH_VARARGS, "" },
+	{ "get_in_flight", (PyCFunction)py_ue_fasset_load_request_get_in_flight, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+#if PY_MAJOR_VERSION >= 3
+static PyObject *ue_PyFAssetLoadRequest_await(ue_PyFAssetLoadRequest *self)
+{
+	PyObject *py_future = ue_py_asyncio_new_future();
+	if (!py_future)
+		return nullptr;
+
+	TSharedPtr<FUEPyAssetLoadRequest> request = self->request;
+	if (request->bCancelled)
+	{
+		PyObject *ret = PyObject_CallMethod(py_future, (char *)"cancel", nullptr);
+		if (!ret)
+		{
+			Py_DECREF(py_future);
+			return nullptr;
+		}
+		Py_DECREF(ret);
+	}
+	else if (request->IsDone())
+	{
+		PyObject *ret = ue_py_asyncio_set_future(py_future, Py_None, Py_None);
+		if (!ret)
+		{
+			Py_DECREF(py_future);
+			return nullptr;
+		}
+		Py_DECREF(ret);
+	}
+	else
+	{
+		Py_INCREF(py_future);
+		request->Waiters.Add(py_future);
+	}
+
+	PyObject *py_iter = PyObject_CallMethod(py_future, (char *)"__await__", nullptr);
+	Py_DECREF(py_future);
+	return py_iter;
+}
+
+static PyAsyncMethods ue_PyFAssetLoadRequest_async_methods;
+#endif
+
+static PyObject *ue_PyFAssetLoadRequest_str(ue_PyFAssetLoadRequest *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FAssetLoadRequest loaded: %d/%d in flight: %d cancelled: %d>",
+		self->request->Loaded, self->request->Assets.Num(), self->request->InFlight, self->request->bCancelled ? 1 : 0);
+}
+
+static void ue_PyFAssetLoadRequest_dealloc(ue_PyFAssetLoadRequest *self)
+{
+	// pending batches keep the request alive
+	self->request.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyFAssetLoadRequestType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FAssetLoadRequest", /* tp_name */
+	sizeof(ue_PyFAssetLoadRequest), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFAssetLoadRequest_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFAssetLoadRequest_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine Asset Load Request",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFAssetLoadRequest_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_fasset_load_request(PyObject *ue_module)
+{
+#if PY_MAJOR_VERSION >= 3
+	memset(&ue_PyFAssetLoadRequest_async_methods, 0, sizeof(PyAsyncMethods));
+	ue_PyFAssetLoadRequest_async_methods.am_await = (unaryfunc)ue_PyFAssetLoadRequest_await;
+	ue_PyFAssetLoadRequestType.tp_as_async = &ue_PyFAssetLoadRequest_async_methods;
+#endif
+
+	if (PyType_Ready(&ue_PyFAssetLoadRequestType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFAssetLoadRequestType);
+	PyModule_AddObject(ue_module, "FAssetLoadRequest", (PyObject *)&ue_PyFAssetLoadRequestType);
+}
+
+PyObject *py_ue_new_fasset_load_request(TArray<FAssetData> &Assets, PyObject *py_callback, int32 batch_size, int32 max_in_flight, bool return_asset_data)
+{
+	TSharedPtr<FUEPyAssetLoadRequest> request = MakeShareable(new FUEPyAssetLoadRequest());
+	request->Assets = MoveTemp(Assets);
+	request->NextAsset = 0;
+	request->Loaded = 0;
+	request->InFlight = 0;
+	request->MaxInFlight = max_in_flight;
+	request->BatchSize = batch_size;
+	request->bReturnAssetData = return_asset_data;
+	request->bCancelled = false;
+	request->bPumping = false;
+	request->PyCallback = nullptr;
+	if (request->Assets.Num() > 0)
+	{
+		Py_INCREF(py_callback);
+		request->PyCallback = py_callback;
+	}
+
+	ue_PyFAssetLoadRequest *ret = (ue_PyFAssetLoadRequest *)PyObject_New(ue_PyFAssetLoadRequest, &ue_PyFAssetLoadRequestType);
+	new(&ret->request) TSharedPtr<FUEPyAssetLoadRequest>(request);
+
+	request->Pump();
+
+	return (PyObject *)ret;
+}
+
+#endif
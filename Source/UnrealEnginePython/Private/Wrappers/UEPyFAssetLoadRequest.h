@@ -0,0 +1,55 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if WITH_EDITOR
+
+#include "AssetRegistry/AssetData.h"
+#include "Engine/StreamableManager.h"
+
+struct FUEPyAssetLoadRequest : public TSharedFromThis<FUEPyAssetLoadRequest>
+{
+	TArray<FAssetData> Assets;
+	// index of the first asset not requested yet
+	int32 NextAsset;
+	int32 Loaded;
+	// packages currently requested to the streamable manager
+	int32 InFlight;
+	int32 MaxInFlight;
+	int32 BatchSize;
+	bool bReturnAssetData;
+	bool bCancelled;
+	bool bPumping;
+	// called with a list of loaded assets per batch
+	PyObject *PyCallback;
+	// asyncio futures awaiting the whole request
+	TArray<PyObject *> Waiters;
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+
+	~FUEPyAssetLoadRequest();
+
+	// request new batches until MaxInFlight packages are loading, game thread only
+	void Pump();
+	void Cancel();
+	bool IsDone() const { return bCancelled || Loaded >= Assets.Num(); }
+
+private:
+	void OnBatchLoaded(int32 First, int32 Num);
+	// the GIL must be held
+	void ResolveWaiters();
+};
+
+// future like (and awaitable) object returned by the *_async asset functions
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TSharedPtr<FUEPyAssetLoadRequest> request;
+} ue_PyFAssetLoadRequest;
+
+void ue_python_init_fasset_load_request(PyObject *);
+
+// takes ownership of Assets, the first batches are requested immediately
+PyObject *py_ue_new_fasset_load_request(TArray<FAssetData> &Assets, PyObject *py_callback, int32 batch_size, int32 max_in_flight, bool return_asset_data);
+
+#endif
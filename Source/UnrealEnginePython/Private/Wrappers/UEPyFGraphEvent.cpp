@@ -0,0 +1,289 @@
+#include "UEPyFGraphEvent.h"
+
+#include "Async/Async.h"
+#include "UEPyAsyncio.h"
+
+FUEPyGraphEvent::~FUEPyGraphEvent()
+{
+	FScopePythonGIL gil;
+	Py_XDECREF(Result);
+	Py_XDECREF(ExcType);
+	Py_XDECREF(ExcValue);
+	Py_XDECREF(ExcTraceback);
+	for (TPair<PyObject *, PyObject *> &Pair : Callbacks)
+	{
+		Py_DECREF(Pair.Key);
+		Py_DECREF(Pair.Value);
+	}
+	for (PyObject *py_future : Waiters)
+	{
+		Py_DECREF(py_future);
+	}
+}
+
+// the GIL must be held
+static void ue_py_fgraph_event_fire_callbacks(FUEPyGraphEventPtr state)
+{
+	TArray<TPair<PyObject *, PyObject *>> callbacks = MoveTemp(state->Callbacks);
+	TArray<PyObject *> waiters = MoveTemp(state->Waiters);
+	state->Callbacks.Empty();
+	state->Waiters.Empty();
+
+	PyObject *py_result = state->Result ? state->Result : Py_None;
+	PyObject *py_exception = state->ExcValue ? state->ExcValue : Py_None;
+
+	for (PyObject *py_future : waiters)
+	{
+#if PY_MAJOR_VERSION >= 3
+		if (!ue_py_asyncio_resolve_future(py_future, py_result, py_exception))
+			unreal_engine_py_log_error();
+#endif
+		Py_DECREF(py_future);
+	}
+
+	for (TPair<PyObject *, PyObject *> &Pair : callbacks)
+	{
+		PyObject *ret = PyObject_CallFunctionObjArgs(Pair.Key, Pair.Value, nullptr);
+		if (!ret)
+			unreal_engine_py_log_error();
+		else
+			Py_DECREF(ret);
+		Py_DECREF(Pair.Key);
+		Py_DECREF(Pair.Value);
+	}
+}
+
+// called by the task with the GIL held, steals the reference to py_ret
+static void ue_py_fgraph_event_complete(FUEPyGraphEventPtr state, PyObject *py_ret)
+{
+	if (py_ret)
+	{
+		state->Result = py_ret;
+	}
+	else
+	{
+		PyErr_Fetch(&state->ExcType, &state->ExcValue, &state->ExcTraceback);
+		PyErr_NormalizeException(&state->ExcType, &state->ExcValue, &state->ExcTraceback);
+		// the exception is kept for result() and still logged
+		Py_XINCREF(state->ExcType);
+		Py_XINCREF(state->ExcValue);
+		Py_XINCREF(state->ExcTraceback);
+		PyErr_Restore(state->ExcType, state->ExcValue, state->ExcTraceback);
+		unreal_engine_py_log_error();
+	}
+	state->bDone = true;
+
+	if (state->Callbacks.Num() == 0 && state->Waiters.Num() == 0)
+		return;
+
+	if (IsInGameThread())
+	{
+		ue_py_fgraph_event_fire_callbacks(state);
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [state]()
+	{
+		FScopePythonGIL gil;
+		ue_py_fgraph_event_fire_callbacks(state);
+	});
+}
+
+static PyObject *ue_py_fgraph_event_result(FUEPyGraphEventPtr state)
+{
+	if (state->ExcType)
+	{
+		Py_INCREF(state->ExcType);
+		Py_XINCREF(state->ExcValue);
+		Py_XINCREF(state->ExcTraceback);
+		PyErr_Restore(state->ExcType, state->ExcValue, state->ExcTraceback);
+		return nullptr;
+	}
+	Py_INCREF(state->Result);
+	return state->Result;
+}
+
+static PyObject *py_ue_fgraph_event_done(ue_PyFGraphEvent *self, PyObject * args)
+{
+	if (self->graph_event->bDone)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fgraph_event_result(ue_PyFGraphEvent *self, PyObject * args)
+{
+	if (!self->graph_event->bDone)
+		return PyErr_Format(PyExc_Exception, "task is not completed, poll it with done() or call wait()");
+	return ue_py_fgraph_event_result(self->graph_event);
+}
+
+static PyObject *py_ue_fgraph_event_wait(ue_PyFGraphEvent *self, PyObject * args)
+{
+	FUEPyGraphEventPtr state = self->graph_event;
+
+	Py_BEGIN_ALLOW_THREADS;
+	FTaskGraphInterface::Get().WaitUntilTaskCompletes(state->Event);
+	Py_END_ALLOW_THREADS;
+
+	return ue_py_fgraph_event_result(state);
+}
+
+static PyObject *py_ue_fgraph_event_add_done_callback(ue_PyFGraphEvent *self, PyObject * args)
+{
+	PyObject *py_callable;
+	if (!PyArg_ParseTuple(args, "O:add_done_callback", &py_callable))
+	{
+		return nullptr;
+	}
+
+	if (!PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_TypeError, "argument is not callable");
+
+	if (self->graph_event->bDone)
+	{
+		return PyObject_CallFunctionObjArgs(py_callable, (PyObject *)self, nullptr);
+	}
+
+	Py_INCREF(py_callable);
+	Py_INCREF(self);
+	self->graph_event->Callbacks.Add(TPair<PyObject *, PyObject *>(py_callable, (PyObject *)self));
+
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef ue_PyFGraphEvent_methods[] = {
+	{ "done", (PyCFunction)py_ue_fgraph_event_done, METH_VARARGS, "" },
+	{ "result", (PyCFunction)py_ue_fgraph_event_result, METH_VARARGS, "" },
+	{ "wait", (PyCFunction)py_ue_fgraph_event_wait, METH_VARARGS, "" },
+	{ "add_done_callback", (PyCFunction)py_ue_fgraph_event_add_done_callback, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+#if PY_MAJOR_VERSION >= 3
+static PyObject *ue_PyFGraphEvent_await(ue_PyFGraphEvent *self)
+{
+	PyObject *py_future = ue_py_asyncio_new_future();
+	if (!py_future)
+		return nullptr;
+
+	py_ue_fgraph_event_add_future(self, py_future);
+
+	PyObject *py_iter = PyObject_CallMethod(py_future, (char *)"__await__", nullptr);
+	Py_DECREF(py_future);
+	return py_iter;
+}
+
+static PyAsyncMethods ue_PyFGraphEvent_async_methods;
+#endif
+
+static PyObject *ue_PyFGraphEvent_str(ue_PyFGraphEvent *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FGraphEvent done: %d>", self->graph_event->bDone ? 1 : 0);
+}
+
+static void ue_PyFGraphEvent_dealloc(ue_PyFGraphEvent *self)
+{
+	// a running task keeps the state alive
+	self->graph_event.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyFGraphEventType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FGraphEvent", /* tp_name */
+	sizeof(ue_PyFGraphEvent), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFGraphEvent_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFGraphEvent_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine Task Graph Event",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFGraphEvent_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_fgraph_event(PyObject *ue_module)
+{
+#if PY_MAJOR_VERSION >= 3
+	memset(&ue_PyFGraphEvent_async_methods, 0, sizeof(PyAsyncMethods));
+	ue_PyFGraphEvent_async_methods.am_await = (unaryfunc)ue_PyFGraphEvent_await;
+	ue_PyFGraphEventType.tp_as_async = &ue_PyFGraphEvent_async_methods;
+#endif
+
+	if (PyType_Ready(&ue_PyFGraphEventType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFGraphEventType);
+	PyModule_AddObject(ue_module, "FGraphEvent", (PyObject *)&ue_PyFGraphEventType);
+}
+
+ue_PyFGraphEvent *py_ue_is_fgraph_event(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFGraphEventType))
+		return nullptr;
+	return (ue_PyFGraphEvent *)obj;
+}
+
+#if PY_MAJOR_VERSION >= 3
+void py_ue_fgraph_event_add_future(ue_PyFGraphEvent *self, PyObject *py_future)
+{
+	FUEPyGraphEventPtr state = self->graph_event;
+	if (!state->bDone)
+	{
+		Py_INCREF(py_future);
+		state->Waiters.Add(py_future);
+		return;
+	}
+
+	PyObject *ret = ue_py_asyncio_set_future(py_future, state->Result ? state->Result : Py_None, state->ExcValue ? state->ExcValue : Py_None);
+	if (!ret)
+		unreal_engine_py_log_error();
+	else
+		Py_DECREF(ret);
+}
+#endif
+
+PyObject *py_ue_new_fgraph_event(PyObject *py_callable, const FGraphEventArray &prerequisites, ENamedThreads::Type named_thread)
+{
+	FUEPyGraphEventPtr state = MakeShareable(new FUEPyGraphEvent());
+	state->bDone = false;
+	state->Result = nullptr;
+	state->ExcType = nullptr;
+	state->ExcValue = nullptr;
+	state->ExcTraceback = nullptr;
+
+	ue_PyFGraphEvent *ret = (ue_PyFGraphEvent *)PyObject_New(ue_PyFGraphEvent, &ue_PyFGraphEventType);
+	new(&ret->graph_event) FUEPyGraphEventPtr(state);
+
+	Py_INCREF(py_callable);
+
+	// the task could complete before the event is assigned, the state is only touched with the GIL
+	state->Event = FFunctionGraphTask::CreateAndDispatchWhenReady([state, py_callable]()
+	{
+		FScopePythonGIL gil;
+		PyObject *py_ret = PyObject_CallObject(py_callable, nullptr);
+		Py_DECREF(py_callable);
+		ue_py_fgraph_event_complete(state, py_ret);
+	}, TStatId(), &prerequisites, named_thread);
+
+	return (PyObject *)ret;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#include "Async/TaskGraphInterfaces.h"
+
+// state of a python callable dispatched to the task graph,
+// everything but Event is protected by the GIL
+struct FUEPyGraphEvent
+{
+	FGraphEventRef Event;
+	bool bDone;
+	PyObject *Result;
+	PyObject *ExcType;
+	PyObject *ExcValue;
+	PyObject *ExcTraceback;
+	// (callable, FGraphEvent wrapper) pairs, called on the game thread
+	TArray<TPair<PyObject *, PyObject *>> Callbacks;
+	// asyncio futures, completed through their loop
+	TArray<PyObject *> Waiters;
+
+	~FUEPyGraphEvent();
+};
+
+typedef TSharedPtr<FUEPyGraphEvent, ESPMode::ThreadSafe> FUEPyGraphEventPtr;
+
+// future like (and awaitable) object for the tasks dispatched by create_and_dispatch_when_ready
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FUEPyGraphEventPtr graph_event;
+} ue_PyFGraphEvent;
+
+void ue_python_init_fgraph_event(PyObject *);
+
+ue_PyFGraphEvent *py_ue_is_fgraph_event(PyObject *);
+
+#if PY_MAJOR_VERSION >= 3
+// py_future is completed with the result (or the exception) of the task
+void py_ue_fgraph_event_add_future(ue_PyFGraphEvent *, PyObject *py_future);
+#endif
+
+// py_callable is called (without arguments) on named_thread once all of the prerequisites are completed
+PyObject *py_ue_new_fgraph_event(PyObject *py_callable, const FGraphEventArray &prerequisites, ENamedThreads::Type named_thread);
@@ -0,0 +1,719 @@
+#include "UEPyFMeshDescriptionBuilder.h"
+
+#if WITH_EDITOR
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Async/ParallelFor.h"
+
+static const char *ue_py_mesh_builder_buffer_format(Py_buffer *py_buf)
+{
+	const char *format = py_buf->format ? py_buf->format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+	return format;
+}
+
+static bool ue_py_mesh_builder_format_is_raw(const char *format)
+{
+	return !strcmp(format, "B") || !strcmp(format, "b") || !strcmp(format, "c");
+}
+
+// rows of float32 components (float64 ones are converted, raw bytes are float32)
+template<typename T>
+static bool ue_py_mesh_builder_read_floats(PyObject *py_obj, TArray<T> &stream, int32 components)
+{
+	check(sizeof(T) == components * sizeof(float));
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return false;
+
+	const char *format = ue_py_mesh_builder_buffer_format(&py_buf);
+	bool doubles = !strcmp(format, "d") && py_buf.itemsize == sizeof(double);
+	if (!doubles && !ue_py_mesh_builder_format_is_raw(format) && !(!strcmp(format, "f") && py_buf.itemsize == sizeof(float)))
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s', 'f' or 'd' items are expected", format);
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	Py_ssize_t itemsize = doubles ? sizeof(double) : sizeof(float);
+	if (py_buf.len % (itemsize * components) != 0)
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of %d components", (int)py_buf.len, components);
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	int32 num = py_buf.len / (itemsize * components);
+	stream.SetNumUninitialized(num);
+	if (doubles)
+	{
+		const double *src = (const double *)py_buf.buf;
+		float *dst = (float *)stream.GetData();
+		for (int32 i = 0; i < num * components; i++)
+			dst[i] = (float)src[i];
+	}
+	else
+	{
+		FMemory::Memcpy(stream.GetData(), py_buf.buf, py_buf.len);
+	}
+
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+// any integer format, raw bytes are 32 bit integers
+static bool ue_py_mesh_builder_read_ints(PyObject *py_obj, TArray<int64> &values)
+{
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return false;
+
+	const char *format = ue_py_mesh_builder_buffer_format(&py_buf);
+	Py_ssize_t itemsize = py_buf.itemsize;
+	bool is_signed = true;
+	if (ue_py_mesh_builder_format_is_raw(format))
+	{
+		itemsize = sizeof(int32);
+	}
+	else if (strlen(format) != 1 || !strchr("bBhHiIlLqQ", format[0]) || (itemsize != 1 && itemsize != 2 && itemsize != 4 && itemsize != 8))
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s', integers are expected", format);
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+	else
+	{
+		// lowercase formats are signed
+		is_signed = format[0] >= 'a' && format[0] <= 'z';
+	}
+
+	if (py_buf.len % itemsize != 0)
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of the item size (%d)", (int)py_buf.len, (int)itemsize);
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	int32 num = py_buf.len / itemsize;
+	values.SetNumUninitialized(num);
+	const uint8 *src = (const uint8 *)py_buf.buf;
+	for (int32 i = 0; i < num; i++)
+	{
+		const uint8 *item = src + (i * itemsize);
+		switch (itemsize)
+		{
+		case 1:
+			values[i] = is_signed ? (int64) * (const int8 *)item : (int64) * (const uint8 *)item;
+			break;
+		case 2:
+			values[i] = is_signed ? (int64) * (const int16 *)item : (int64) * (const uint16 *)item;
+			break;
+		case 4:
+			values[i] = is_signed ? (int64) * (const int32 *)item : (int64) * (const uint32 *)item;
+			break;
+		default:
+			values[i] = *(const int64 *)item;
+			break;
+		}
+	}
+
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_positions(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	if (!PyArg_ParseTuple(args, "O:set_positions", &py_data))
+		return nullptr;
+
+	if (!ue_py_mesh_builder_read_floats(py_data, self->positions, 3))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_indices(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	if (!PyArg_ParseTuple(args, "O:set_indices", &py_data))
+		return nullptr;
+
+	TArray<int64> values;
+	if (!ue_py_mesh_builder_read_ints(py_data, values))
+		return nullptr;
+
+	if (values.Num() % 3 != 0)
+		return PyErr_Format(PyExc_ValueError, "the number of indices (%d) is not a multiple of 3", values.Num());
+
+	// the builder is updated only when all of the values are valid
+	TArray<uint32> indices;
+	indices.SetNumUninitialized(values.Num());
+	for (int32 i = 0; i < values.Num(); i++)
+	{
+		if (values[i] < 0 || values[i] > MAX_int32)
+			return PyErr_Format(PyExc_ValueError, "invalid vertex index at position %d", i);
+		indices[i] = (uint32)values[i];
+	}
+	self->indices = MoveTemp(indices);
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_normals(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	if (!PyArg_ParseTuple(args, "O:set_normals", &py_data))
+		return nullptr;
+
+	if (!ue_py_mesh_builder_read_floats(py_data, self->normals, 3))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_tangents(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	PyObject *py_signs = nullptr;
+	if (!PyArg_ParseTuple(args, "O|O:set_tangents", &py_data, &py_signs))
+		return nullptr;
+
+	TArray<ue_py_mesh_vector> tangents;
+	if (!ue_py_mesh_builder_read_floats(py_data, tangents, 3))
+		return nullptr;
+
+	TArray<float> binormal_signs;
+	if (py_signs && py_signs != Py_None)
+	{
+		if (!ue_py_mesh_builder_read_floats(py_signs, binormal_signs, 1))
+			return nullptr;
+		if (binormal_signs.Num() != tangents.Num())
+			return PyErr_Format(PyExc_ValueError, "expected %d binormal signs, got %d", tangents.Num(), binormal_signs.Num());
+	}
+	else
+	{
+		binormal_signs.Init(1, tangents.Num());
+	}
+
+	self->tangents = MoveTemp(tangents);
+	self->binormal_signs = MoveTemp(binormal_signs);
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_uvs(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	int channel = 0;
+	if (!PyArg_ParseTuple(args, "O|i:set_uvs", &py_data, &channel))
+		return nullptr;
+
+	if (channel < 0 || channel >= MAX_MESH_TEXTURE_COORDS)
+		return PyErr_Format(PyExc_ValueError, "invalid uv channel %d", channel);
+
+	TArray<ue_py_mesh_uv> uvs;
+	if (!ue_py_mesh_builder_read_floats(py_data, uvs, 2))
+		return nullptr;
+
+	if (channel >= self->uvs.Num())
+		self->uvs.SetNum(channel + 1);
+	self->uvs[channel] = MoveTemp(uvs);
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_colors(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	if (!PyArg_ParseTuple(args, "O:set_colors", &py_data))
+		return nullptr;
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_data, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return nullptr;
+
+	// 8 bit sRGB colors (like FColor), converted to linear as the FRawMesh wedge colors
+	if (ue_py_mesh_builder_format_is_raw(ue_py_mesh_builder_buffer_format(&py_buf)))
+	{
+		if (py_buf.len % 4 != 0)
+		{
+			PyBuffer_Release(&py_buf);
+			return PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of 4 (RGBA) bytes", (int)py_buf.len);
+		}
+
+		const uint8 *src = (const uint8 *)py_buf.buf;
+		self->colors.SetNumUninitialized(py_buf.len / 4);
+		for (int32 i = 0; i < self->colors.Num(); i++)
+		{
+			const uint8 *rgba = src + (i * 4);
+			FLinearColor color = FLinearColor(FColor(rgba[0], rgba[1], rgba[2], rgba[3]));
+			self->colors[i] = ue_py_mesh_color(color.R, color.G, color.B, color.A);
+		}
+		PyBuffer_Release(&py_buf);
+		Py_RETURN_NONE;
+	}
+
+	PyBuffer_Release(&py_buf);
+
+	// linear float colors
+	if (!ue_py_mesh_builder_read_floats(py_data, self->colors, 4))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_set_material_indices(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	PyObject *py_data;
+	if (!PyArg_ParseTuple(args, "O:set_material_indices", &py_data))
+		return nullptr;
+
+	TArray<int64> values;
+	if (!ue_py_mesh_builder_read_ints(py_data, values))
+		return nullptr;
+
+	TArray<int32> material_indices;
+	material_indices.SetNumUninitialized(values.Num());
+	for (int32 i = 0; i < values.Num(); i++)
+	{
+		if (values[i] < 0 || values[i] > MAX_uint16)
+			return PyErr_Format(PyExc_ValueError, "invalid material index at position %d", i);
+		material_indices[i] = (int32)values[i];
+	}
+	self->material_indices = MoveTemp(material_indices);
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_reset(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	self->positions.Reset();
+	self->indices.Reset();
+	self->normals.Reset();
+	self->tangents.Reset();
+	self->binormal_signs.Reset();
+	self->uvs.Reset();
+	self->colors.Reset();
+	self->material_indices.Reset();
+	Py_RETURN_NONE;
+}
+
+static bool ue_py_mesh_builder_validate(ue_PyFMeshDescriptionBuilder *self)
+{
+	int32 num_vertices = self->positions.Num();
+	int32 num_triangles = self->indices.Num() / 3;
+
+	if (num_triangles == 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "the mesh has no triangles");
+		return false;
+	}
+
+	for (int32 i = 0; i < self->indices.Num(); i++)
+	{
+		if (self->indices[i] >= (uint32)num_vertices)
+		{
+			PyErr_Format(PyExc_ValueError, "vertex index %u at position %d is out of range (%d vertices)", self->indices[i], i, num_vertices);
+			return false;
+		}
+	}
+
+	if (self->normals.Num() > 0 && self->normals.Num() != num_vertices)
+	{
+		PyErr_Format(PyExc_ValueError, "expected %d normals, got %d", num_vertices, self->normals.Num());
+		return false;
+	}
+
+	if (self->tangents.Num() > 0 && self->tangents.Num() != num_vertices)
+	{
+		PyErr_Format(PyExc_ValueError, "expected %d tangents, got %d", num_vertices, self->tangents.Num());
+		return false;
+	}
+
+	for (int32 channel = 0; channel < self->uvs.Num(); channel++)
+	{
+		if (self->uvs[channel].Num() != num_vertices)
+		{
+			PyErr_Format(PyExc_ValueError, "expected %d uvs in channel %d, got %d", num_vertices, channel, self->uvs[channel].Num());
+			return false;
+		}
+	}
+
+	if (self->colors.Num() > 0 && self->colors.Num() != num_vertices)
+	{
+		PyErr_Format(PyExc_ValueError, "expected %d colors, got %d", num_vertices, self->colors.Num());
+		return false;
+	}
+
+	if (self->material_indices.Num() > 0 && self->material_indices.Num() != num_triangles)
+	{
+		PyErr_Format(PyExc_ValueError, "expected %d material indices (one per triangle), got %d", num_triangles, self->material_indices.Num());
+		return false;
+	}
+
+	return true;
+}
+
+// missing normals (area weighted) and tangents (from the first uv channel) are computed in parallel:
+// first per triangle, then per vertex gathering the triangles sharing it, so no thread writes the same vertex.
+// The results go to the out arrays, the builder inputs are never modified (so it can be committed again)
+static void ue_py_mesh_builder_compute_tangent_space(ue_PyFMeshDescriptionBuilder *self, bool compute_normals, bool compute_tangents,
+	TArray<ue_py_mesh_vector> &out_normals, TArray<ue_py_mesh_vector> &out_tangents, TArray<float> &out_binormal_signs)
+{
+	const TArray<ue_py_mesh_vector> &positions = self->positions;
+	const TArray<uint32> &indices = self->indices;
+	int32 num_vertices = positions.Num();
+	int32 num_triangles = indices.Num() / 3;
+
+	// triangles of every vertex
+	TArray<int32> offsets;
+	offsets.SetNumZeroed(num_vertices + 1);
+	for (uint32 index : indices)
+	{
+		offsets[index + 1]++;
+	}
+	for (int32 i = 0; i < num_vertices; i++)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+	TArray<int32> cursors(offsets.GetData(), num_vertices);
+	TArray<int32> vertex_triangles;
+	vertex_triangles.SetNumUninitialized(indices.Num());
+	for (int32 i = 0; i < indices.Num(); i++)
+	{
+		vertex_triangles[cursors[indices[i]]++] = i / 3;
+	}
+
+	if (compute_normals)
+	{
+		TArray<ue_py_mesh_vector> face_normals;
+		face_normals.SetNumUninitialized(num_triangles);
+		ParallelFor(num_triangles, [&](int32 triangle)
+		{
+			const ue_py_mesh_vector &p0 = positions[indices[triangle * 3]];
+			// same winding of FStaticMeshOperations, the length is twice the triangle area
+			face_normals[triangle] = (positions[indices[triangle * 3 + 2]] - p0) ^ (positions[indices[triangle * 3 + 1]] - p0);
+		});
+
+		out_normals.SetNumUninitialized(num_vertices);
+		ParallelFor(num_vertices, [&](int32 vertex)
+		{
+			ue_py_mesh_vector normal = ue_py_mesh_vector::ZeroVector;
+			for (int32 i = offsets[vertex]; i < offsets[vertex + 1]; i++)
+			{
+				normal += face_normals[vertex_triangles[i]];
+			}
+			out_normals[vertex] = normal.GetSafeNormal();
+		});
+	}
+
+	if (!compute_tangents)
+		return;
+
+	const TArray<ue_py_mesh_uv> *uvs = self->uvs.Num() > 0 ? &self->uvs[0] : nullptr;
+	TArray<ue_py_mesh_vector> face_tangents;
+	TArray<ue_py_mesh_vector> face_binormals;
+	face_tangents.SetNumZeroed(num_triangles);
+	face_binormals.SetNumZeroed(num_triangles);
+	if (uvs)
+	{
+		ParallelFor(num_triangles, [&](int32 triangle)
+		{
+			uint32 i0 = indices[triangle * 3];
+			uint32 i1 = indices[triangle * 3 + 1];
+			uint32 i2 = indices[triangle * 3 + 2];
+			ue_py_mesh_vector dp1 = positions[i1] - positions[i0];
+			ue_py_mesh_vector dp2 = positions[i2] - positions[i0];
+			ue_py_mesh_uv duv1 = (*uvs)[i1] - (*uvs)[i0];
+			ue_py_mesh_uv duv2 = (*uvs)[i2] - (*uvs)[i0];
+			float determinant = duv1.X * duv2.Y - duv1.Y * duv2.X;
+			// degenerate uvs do not contribute
+			if (FMath::Abs(determinant) < SMALL_NUMBER)
+				return;
+			float r = 1.f / determinant;
+			face_tangents[triangle] = (dp1 * duv2.Y - dp2 * duv1.Y) * r;
+			face_binormals[triangle] = (dp2 * duv1.X - dp1 * duv2.X) * r;
+		});
+	}
+
+	const TArray<ue_py_mesh_vector> &normals = compute_normals ? out_normals : self->normals;
+	out_tangents.SetNumUninitialized(num_vertices);
+	out_binormal_signs.SetNumUninitialized(num_vertices);
+	ParallelFor(num_vertices, [&](int32 vertex)
+	{
+		ue_py_mesh_vector tangent = ue_py_mesh_vector::ZeroVector;
+		ue_py_mesh_vector binormal = ue_py_mesh_vector::ZeroVector;
+		for (int32 i = offsets[vertex]; i < offsets[vertex + 1]; i++)
+		{
+			tangent += face_tangents[vertex_triangles[i]];
+			binormal += face_binormals[vertex_triangles[i]];
+		}
+
+		const ue_py_mesh_vector &normal = normals[vertex];
+		// Gram-Schmidt, any axis orthogonal to the normal when there are no usable uvs
+		tangent = (tangent - normal * (normal | tangent)).GetSafeNormal();
+		if (tangent.IsNearlyZero())
+		{
+			ue_py_mesh_vector unused;
+			normal.FindBestAxisVectors(tangent, unused);
+		}
+
+		out_tangents[vertex] = tangent;
+		out_binormal_signs[vertex] = ((normal ^ tangent) | binormal) < 0 ? -1.f : 1.f;
+	});
+}
+
+static PyObject *py_ue_fmesh_description_builder_commit(ue_PyFMeshDescriptionBuilder *self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_mesh;
+	int lod = 0;
+	PyObject *py_build = nullptr;
+
+	static char *kw_names[] = { (char *)"static_mesh", (char *)"lod", (char *)"build", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|iO:commit", kw_names, &py_mesh, &lod, &py_build))
+	{
+		return nullptr;
+	}
+
+	UStaticMesh *mesh = ue_py_check_type<UStaticMesh>(py_mesh);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "argument is not a UStaticMesh");
+
+	if (lod < 0 || lod > mesh->GetNumSourceModels())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index %d, the mesh has %d LODs", lod, mesh->GetNumSourceModels());
+
+	if (!ue_py_mesh_builder_validate(self))
+		return nullptr;
+
+	bool compute_normals = self->normals.Num() == 0;
+	bool compute_tangents = self->tangents.Num() == 0;
+	TArray<ue_py_mesh_vector> computed_normals;
+	TArray<ue_py_mesh_vector> computed_tangents;
+	TArray<float> computed_binormal_signs;
+	if (compute_normals || compute_tangents)
+	{
+		ue_py_mesh_builder_compute_tangent_space(self, compute_normals, compute_tangents, computed_normals, computed_tangents, computed_binormal_signs);
+	}
+	const TArray<ue_py_mesh_vector> &normals = compute_normals ? computed_normals : self->normals;
+	const TArray<ue_py_mesh_vector> &tangents = compute_tangents ? computed_tangents : self->tangents;
+	const TArray<float> &binormal_signs = compute_tangents ? computed_binormal_signs : self->binormal_signs;
+
+	int32 num_vertices = self->positions.Num();
+	int32 num_triangles = self->indices.Num() / 3;
+
+	FMeshDescription mesh_description;
+	FStaticMeshAttributes attributes(mesh_description);
+	attributes.Register();
+
+	auto vertex_positions = attributes.GetVertexPositions();
+	auto instance_normals = attributes.GetVertexInstanceNormals();
+	auto instance_tangents = attributes.GetVertexInstanceTangents();
+	auto instance_binormal_signs = attributes.GetVertexInstanceBinormalSigns();
+	auto instance_colors = attributes.GetVertexInstanceColors();
+	auto instance_uvs = attributes.GetVertexInstanceUVs();
+	auto slot_names = attributes.GetPolygonGroupMaterialSlotNames();
+
+	int32 num_uv_channels = FMath::Max(self->uvs.Num(), 1);
+#if ENGINE_MAJOR_VERSION == 5
+	instance_uvs.SetNumChannels(num_uv_channels);
+#else
+	instance_uvs.SetNumIndices(num_uv_channels);
+#endif
+
+	mesh_description.ReserveNewVertices(num_vertices);
+	mesh_description.ReserveNewVertexInstances(num_vertices);
+	mesh_description.ReserveNewTriangles(num_triangles);
+	mesh_description.ReserveNewPolygons(num_triangles);
+	mesh_description.ReserveNewEdges(num_triangles * 3);
+
+	// a fresh description assigns sequential ids, vertex i gets the vertex instance i
+	for (int32 i = 0; i < num_vertices; i++)
+	{
+		FVertexID vertex_id = mesh_description.CreateVertex();
+		vertex_positions[vertex_id] = self->positions[i];
+
+		FVertexInstanceID instance_id = mesh_description.CreateVertexInstance(vertex_id);
+		instance_normals[instance_id] = normals[i];
+		instance_tangents[instance_id] = tangents[i];
+		instance_binormal_signs[instance_id] = binormal_signs[i];
+		instance_colors[instance_id] = self->colors.Num() > 0 ? self->colors[i] : ue_py_mesh_color(1, 1, 1, 1);
+		for (int32 channel = 0; channel < self->uvs.Num(); channel++)
+		{
+			instance_uvs.Set(instance_id, channel, self->uvs[channel][i]);
+		}
+	}
+
+	// a polygon group per material slot, new slots are added to the mesh
+	int32 num_groups = 1;
+	for (int32 material_index : self->material_indices)
+	{
+		num_groups = FMath::Max(num_groups, material_index + 1);
+	}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 27)
+	TArray<FStaticMaterial> &static_materials = mesh->GetStaticMaterials();
+#else
+	TArray<FStaticMaterial> &static_materials = mesh->StaticMaterials;
+#endif
+
+	TArray<FPolygonGroupID> groups;
+	for (int32 i = 0; i < num_groups; i++)
+	{
+		if (i >= static_materials.Num())
+		{
+			FName slot_name = FName(*FString::Printf(TEXT("MaterialSlot_%d"), i));
+			static_materials.Add(FStaticMaterial(nullptr, slot_name, slot_name));
+		}
+		FPolygonGroupID group_id = mesh_description.CreatePolygonGroup();
+		FName slot_name = static_materials[i].ImportedMaterialSlotName;
+		slot_names[group_id] = slot_name.IsNone() ? static_materials[i].MaterialSlotName : slot_name;
+		groups.Add(group_id);
+	}
+
+	for (int32 i = 0; i < num_triangles; i++)
+	{
+		const uint32 *triangle = self->indices.GetData() + (i * 3);
+		// degenerate triangles are skipped (like the mesh importers do)
+		if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+			continue;
+		FVertexInstanceID instance_ids[3] = { FVertexInstanceID(triangle[0]), FVertexInstanceID(triangle[1]), FVertexInstanceID(triangle[2]) };
+		mesh_description.CreateTriangle(groups[self->material_indices.Num() > 0 ? self->material_indices[i] : 0], TArrayView<const FVertexInstanceID>(instance_ids, 3));
+	}
+
+	if (lod == mesh->GetNumSourceModels())
+		mesh->SetNumSourceModels(lod + 1);
+
+	// the tangent space is already there, do not let the build recompute it
+	FStaticMeshSourceModel &source_model = mesh->GetSourceModel(lod);
+	source_model.BuildSettings.bRecomputeNormals = false;
+	source_model.BuildSettings.bRecomputeTangents = false;
+
+	mesh->CreateMeshDescription(lod, MoveTemp(mesh_description));
+	mesh->CommitMeshDescription(lod);
+
+	// like static_mesh_build(), UStaticMesh::PostEditChange() would build it again
+	if (!py_build || PyObject_IsTrue(py_build))
+	{
+		mesh->Build();
+	}
+	mesh->MarkPackageDirty();
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmesh_description_builder_get_vertices_num(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	return PyLong_FromLong(self->positions.Num());
+}
+
+static PyObject *py_ue_fmesh_description_builder_get_triangles_num(ue_PyFMeshDescriptionBuilder *self, PyObject * args)
+{
+	return PyLong_FromLong(self->indices.Num() / 3);
+}
+
+static PyMethodDef ue_PyFMeshDescriptionBuilder_methods[] = {
+	{ "set_positions", (PyCFunction)py_ue_fmesh_description_builder_set_positions, METH_VARARGS, "" },
+	{ "set_indices", (PyCFunction)py_ue_fmesh_description_builder_set_indices, METH_VARARGS, "" },
+	{ "set_normals", (PyCFunction)py_ue_fmesh_description_builder_set_normals, METH_VARARGS, "" },
+	{ "set_tangents", (PyCFunction)py_ue_fmesh_description_builder_set_tangents, METH_VARARGS, "" },
+	{ "set_uvs", (PyCFunction)py_ue_fmesh_description_builder_set_uvs, METH_VARARGS, "" },
+	{ "set_colors", (PyCFunction)py_ue_fmesh_description_builder_set_colors, METH_VARARGS, "" },
+	{ "set_material_indices", (PyCFunction)py_ue_fmesh_description_builder_set_material_indices, METH_VARARGS, "" },
+	{ "get_vertices_num", (PyCFunction)py_ue_fmesh_description_builder_get_vertices_num, METH_VARARGS, "" },
+	{ "get_triangles_num", (PyCFunction)py_ue_fmesh_description_builder_get_triangles_num, METH_VARARGS, "" },
+	{ "reset", (PyCFunction)py_ue_fmesh_description_builder_reset, METH_VARARGS, "" },
+	{ "commit", (PyCFunction)py_ue_fmesh_description_builder_commit, METH_VARARGS | METH_KEYWORDS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFMeshDescriptionBuilder_str(ue_PyFMeshDescriptionBuilder *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FMeshDescriptionBuilder vertices: %d triangles: %d>",
+		self->positions.Num(), self->indices.Num() / 3);
+}
+
+static void ue_PyFMeshDescriptionBuilder_dealloc(ue_PyFMeshDescriptionBuilder *self)
+{
+	self->positions.~TArray();
+	self->indices.~TArray();
+	self->normals.~TArray();
+	self->tangents.~TArray();
+	self->binormal_signs.~TArray();
+	self->uvs.~TArray();
+	self->colors.~TArray();
+	self->material_indices.~TArray();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_PyFMeshDescriptionBuilder_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	ue_PyFMeshDescriptionBuilder *self = (ue_PyFMeshDescriptionBuilder *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		new(&self->positions) TArray<ue_py_mesh_vector>();
+		new(&self->indices) TArray<uint32>();
+		new(&self->normals) TArray<ue_py_mesh_vector>();
+		new(&self->tangents) TArray<ue_py_mesh_vector>();
+		new(&self->binormal_signs) TArray<float>();
+		new(&self->uvs) TArray<TArray<ue_py_mesh_uv>>();
+		new(&self->colors) TArray<ue_py_mesh_color>();
+		new(&self->material_indices) TArray<int32>();
+	}
+	return (PyObject *)self;
+}
+
+static PyTypeObject ue_PyFMeshDescriptionBuilderType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FMeshDescriptionBuilder", /* tp_name */
+	sizeof(ue_PyFMeshDescriptionBuilder), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFMeshDescriptionBuilder_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFMeshDescriptionBuilder_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine MeshDescription builder",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFMeshDescriptionBuilder_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_fmesh_description_builder(PyObject *ue_module)
+{
+	ue_PyFMeshDescriptionBuilderType.tp_new = ue_PyFMeshDescriptionBuilder_new;
+
+	if (PyType_Ready(&ue_PyFMeshDescriptionBuilderType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFMeshDescriptionBuilderType);
+	PyModule_AddObject(ue_module, "FMeshDescriptionBuilder", (PyObject *)&ue_PyFMeshDescriptionBuilderType);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if WITH_EDITOR
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+// vertex attribute types of FMeshDescription
+#if ENGINE_MAJOR_VERSION == 5
+typedef FVector3f ue_py_mesh_vector;
+typedef FVector2f ue_py_mesh_uv;
+typedef FVector4f ue_py_mesh_color;
+#else
+typedef FVector ue_py_mesh_vector;
+typedef FVector2D ue_py_mesh_uv;
+typedef FVector4 ue_py_mesh_color;
+#endif
+
+// indexed triangle mesh filled with bulk buffers, every vertex becomes a single vertex instance
+// (duplicate the vertices for hard edges and uv seams)
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<ue_py_mesh_vector> positions;
+	TArray<uint32> indices;
+	TArray<ue_py_mesh_vector> normals;
+	TArray<ue_py_mesh_vector> tangents;
+	TArray<float> binormal_signs;
+	TArray<TArray<ue_py_mesh_uv>> uvs;
+	TArray<ue_py_mesh_color> colors;
+	// per triangle, every material index gets its own polygon group
+	TArray<int32> material_indices;
+} ue_PyFMeshDescriptionBuilder;
+
+void ue_python_init_fmesh_description_builder(PyObject *);
+
+#endif
+
+#endif
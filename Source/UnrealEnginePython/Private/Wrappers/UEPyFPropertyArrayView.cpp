@@ -0,0 +1,375 @@
+#include "UEPyFPropertyArrayView.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+// views with live exports, their arrays must not be reallocated
+static TArray<ue_PyFPropertyArrayView *> ue_py_exported_array_views;
+
+// struct format and size of a POD numeric property, nullptr if not supported
+static const char *ue_py_array_view_scalar_format(FProperty *prop, Py_ssize_t &itemsize)
+{
+	if (FEnumProperty *enum_prop = CastField<FEnumProperty>(prop))
+	{
+		prop = enum_prop->GetUnderlyingProperty();
+	}
+
+	const char *format = nullptr;
+	switch (ue_py_get_property_kind(prop))
+	{
+	case EUEPyPropertyKind::Bool:
+		// bitfields cannot be exposed
+		if (!((FBoolProperty *)prop)->IsNativeBool())
+			return nullptr;
+		format = "?";
+		break;
+	case EUEPyPropertyKind::Int:
+		format = "i";
+		break;
+	case EUEPyPropertyKind::UInt32:
+		format = "I";
+		break;
+	case EUEPyPropertyKind::Int64:
+		format = "q";
+		break;
+	case EUEPyPropertyKind::UInt64:
+		format = "Q";
+		break;
+	case EUEPyPropertyKind::Float:
+		format = "f";
+		break;
+	case EUEPyPropertyKind::Double:
+		format = "d";
+		break;
+	case EUEPyPropertyKind::Byte:
+		format = "B";
+		break;
+	default:
+		if (prop->IsA<FInt8Property>())
+			format = "b";
+		else if (prop->IsA<FInt16Property>())
+			format = "h";
+		else if (prop->IsA<FUInt16Property>())
+			format = "H";
+		else
+			return nullptr;
+		break;
+	}
+
+	itemsize = prop->ElementSize;
+	return format;
+}
+
+// structs (even nested) made only of contiguous numeric fields of the same type
+// are exposed as a 2 dimensional buffer (FVector -> 'f'/'d' x 3, FColor -> 'B' x 4 ...)
+static bool ue_py_array_view_flatten_struct(UStruct *u_struct, int32 base_offset, const char *&format, Py_ssize_t &itemsize, Py_ssize_t &components)
+{
+	for (TFieldIterator<FProperty> It(u_struct); It; ++It)
+	{
+		FProperty *prop = *It;
+		int32 offset = base_offset + prop->GetOffset_ForInternal();
+
+		if (FStructProperty *struct_prop = CastField<FStructProperty>(prop))
+		{
+			if (prop->ArrayDim != 1)
+				return false;
+			if (!ue_py_array_view_flatten_struct(struct_prop->Struct, offset, format, itemsize, components))
+				return false;
+			continue;
+		}
+
+		Py_ssize_t field_size = 0;
+		const char *field_format = ue_py_array_view_scalar_format(prop, field_size);
+		if (!field_format)
+			return false;
+
+		if (!format)
+		{
+			format = field_format;
+			itemsize = field_size;
+		}
+		else if (FCStringAnsi::Strcmp(format, field_format))
+		{
+			return false;
+		}
+
+		// no padding allowed
+		if (offset != components * itemsize)
+			return false;
+
+		components += prop->ArrayDim;
+	}
+	return true;
+}
+
+static UObject *ue_py_fpropertyarrayview_get_owner(ue_PyFPropertyArrayView *self)
+{
+	UObject *owner = self->owner.Get();
+	if (!owner)
+	{
+		PyErr_SetString(PyExc_ReferenceError, "the UObject owning the array is no longer valid");
+	}
+	return owner;
+}
+
+static PyObject *py_ue_fpropertyarrayview_is_valid(ue_PyFPropertyArrayView *self, PyObject * args)
+{
+	UObject *owner = self->owner.Get();
+	if (!owner)
+	{
+		Py_RETURN_FALSE;
+	}
+
+	if (self->exports > 0)
+	{
+		FScriptArrayHelper_InContainer helper(self->array_property, owner);
+		if (helper.GetRawPtr() != self->exported_data || helper.Num() != self->exported_num)
+		{
+			Py_RETURN_FALSE;
+		}
+	}
+
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_ue_fpropertyarrayview_resize(ue_PyFPropertyArrayView *self, PyObject * args)
+{
+	int num;
+	if (!PyArg_ParseTuple(args, "i:resize", &num))
+	{
+		return NULL;
+	}
+
+	if (num < 0)
+		return PyErr_Format(PyExc_ValueError, "invalid array size");
+
+	if (!self->writable)
+		return PyErr_Format(PyExc_BufferError, "array view is read-only");
+
+	if (self->exports > 0)
+		return PyErr_Format(PyExc_BufferError, "existing exports of data: array cannot be resized");
+
+	UObject *owner = ue_py_fpropertyarrayview_get_owner(self);
+	if (!owner)
+		return NULL;
+
+	FScriptArrayHelper_InContainer helper(self->array_property, owner);
+	helper.Resize(num);
+
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef ue_PyFPropertyArrayView_methods[] = {
+	{ "is_valid", (PyCFunction)py_ue_fpropertyarrayview_is_valid, METH_VARARGS, "" },
+	{ "resize", (PyCFunction)py_ue_fpropertyarrayview_resize, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFPropertyArrayView_str(ue_PyFPropertyArrayView *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FPropertyArrayView '%s' format: '%s' components: %d writable: %d>",
+		TCHAR_TO_UTF8(*self->array_property->GetName()), self->format, (int)self->components, self->writable);
+}
+
+static void ue_PyFPropertyArrayView_dealloc(ue_PyFPropertyArrayView *self)
+{
+	self->owner.~FWeakObjectPtr();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static Py_ssize_t ue_PyFPropertyArrayView_len(ue_PyFPropertyArrayView *self)
+{
+	UObject *owner = ue_py_fpropertyarrayview_get_owner(self);
+	if (!owner)
+		return -1;
+	FScriptArrayHelper_InContainer helper(self->array_property, owner);
+	return helper.Num();
+}
+
+static int ue_PyFPropertyArrayView_getbuffer(ue_PyFPropertyArrayView *self, Py_buffer *view, int flags)
+{
+	view->obj = nullptr;
+
+	UObject *owner = ue_py_fpropertyarrayview_get_owner(self);
+	if (!owner)
+		return -1;
+
+	if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && !self->writable)
+	{
+		PyErr_SetString(PyExc_BufferError, "array view is read-only");
+		return -1;
+	}
+
+	FScriptArrayHelper_InContainer helper(self->array_property, owner);
+	void *data = helper.GetRawPtr();
+	int32 num = helper.Num();
+
+	// all of the exports must share the same memory (and the same shape)
+	if (self->exports > 0 && (data != self->exported_data || num != self->exported_num))
+	{
+		PyErr_SetString(PyExc_BufferError, "the array has been reallocated while exported, release the previous views first");
+		return -1;
+	}
+
+	Py_ssize_t element_size = self->components > 0 ? self->itemsize * self->components : self->itemsize;
+
+	self->shape[0] = num;
+	self->shape[1] = self->components;
+	self->strides[0] = element_size;
+	self->strides[1] = self->itemsize;
+
+	// buf cannot be NULL, even for empty arrays
+	static char empty_buffer = 0;
+
+	view->buf = data ? data : &empty_buffer;
+	view->obj = (PyObject *)self;
+	Py_INCREF(self);
+	view->len = num * element_size;
+	view->readonly = self->writable ? 0 : 1;
+	view->internal = nullptr;
+	view->suboffsets = nullptr;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->itemsize = self->itemsize;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)self->format : nullptr;
+		view->ndim = self->components > 0 ? 2 : 1;
+		view->shape = self->shape;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+	}
+	else
+	{
+		// simple request, raw bytes
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)"B" : nullptr;
+		view->ndim = 1;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	if (self->exports++ == 0)
+	{
+		self->exported_data = data;
+		self->exported_num = num;
+		ue_py_exported_array_views.Add(self);
+		// the memory must survive the GC while exported
+		FUnrealEnginePythonHouseKeeper::Get()->PinUObject(owner);
+		self->pinned_owner = owner;
+	}
+
+	return 0;
+}
+
+static void ue_PyFPropertyArrayView_releasebuffer(ue_PyFPropertyArrayView *self, Py_buffer *view)
+{
+	if (--self->exports == 0)
+	{
+		ue_py_exported_array_views.RemoveSingleSwap(self);
+		FUnrealEnginePythonHouseKeeper::Get()->UnpinUObject(self->pinned_owner);
+		self->pinned_owner = nullptr;
+		self->exported_data = nullptr;
+		self->exported_num = 0;
+	}
+}
+
+static PyTypeObject ue_PyFPropertyArrayViewType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FPropertyArrayView", /* tp_name */
+	sizeof(ue_PyFPropertyArrayView), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFPropertyArrayView_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFPropertyArrayView_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine TArray property buffer view",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFPropertyArrayView_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PySequenceMethods ue_PyFPropertyArrayView_sequence_methods;
+PyBufferProcs ue_PyFPropertyArrayView_buffer_procs;
+
+void ue_python_init_fpropertyarrayview(PyObject *ue_module)
+{
+	memset(&ue_PyFPropertyArrayView_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFPropertyArrayViewType.tp_as_sequence = &ue_PyFPropertyArrayView_sequence_methods;
+	ue_PyFPropertyArrayView_sequence_methods.sq_length = (lenfunc)ue_PyFPropertyArrayView_len;
+
+	memset(&ue_PyFPropertyArrayView_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFPropertyArrayViewType.tp_as_buffer = &ue_PyFPropertyArrayView_buffer_procs;
+	ue_PyFPropertyArrayView_buffer_procs.bf_getbuffer = (getbufferproc)ue_PyFPropertyArrayView_getbuffer;
+	ue_PyFPropertyArrayView_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_PyFPropertyArrayView_releasebuffer;
+
+	if (PyType_Ready(&ue_PyFPropertyArrayViewType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFPropertyArrayViewType);
+	PyModule_AddObject(ue_module, "FPropertyArrayView", (PyObject *)&ue_PyFPropertyArrayViewType);
+}
+
+PyObject *py_ue_new_fpropertyarrayview(UObject *owner, FArrayProperty *array_property, bool writable)
+{
+	const char *format = nullptr;
+	Py_ssize_t itemsize = 0;
+	Py_ssize_t components = 0;
+
+	if (FStructProperty *struct_prop = CastField<FStructProperty>(array_property->Inner))
+	{
+		if (!ue_py_array_view_flatten_struct(struct_prop->Struct, 0, format, itemsize, components) || !format ||
+			components * itemsize != struct_prop->Struct->GetStructureSize())
+		{
+			return PyErr_Format(PyExc_TypeError, "struct %s cannot be viewed as a buffer, only contiguous numeric fields of the same type are supported", TCHAR_TO_UTF8(*struct_prop->Struct->GetName()));
+		}
+	}
+	else
+	{
+		format = ue_py_array_view_scalar_format(array_property->Inner, itemsize);
+		if (!format)
+		{
+			return PyErr_Format(PyExc_TypeError, "items of array %s (%s) are not POD numbers", TCHAR_TO_UTF8(*array_property->GetName()), TCHAR_TO_UTF8(*array_property->Inner->GetClass()->GetName()));
+		}
+	}
+
+	ue_PyFPropertyArrayView *ret = (ue_PyFPropertyArrayView *)PyObject_New(ue_PyFPropertyArrayView, &ue_PyFPropertyArrayViewType);
+	new(&ret->owner) FWeakObjectPtr(owner);
+	ret->array_property = array_property;
+	ret->writable = writable ? 1 : 0;
+	ret->format = format;
+	ret->itemsize = itemsize;
+	ret->components = components;
+	ret->exports = 0;
+	ret->exported_data = nullptr;
+	ret->exported_num = 0;
+	ret->pinned_owner = nullptr;
+	return (PyObject *)ret;
+}
+
+bool ue_py_fpropertyarrayview_is_exported(UObject *owner, FProperty *property)
+{
+	for (ue_PyFPropertyArrayView *view : ue_py_exported_array_views)
+	{
+		if (view->array_property == property && view->owner.Get() == owner)
+			return true;
+	}
+	return false;
+}
+
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+// zero-copy view (python buffer protocol) over a TArray property of POD items
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FWeakObjectPtr owner;
+	FArrayProperty *array_property;
+	int writable;
+	// struct format of a single component ('f', 'i', ...)
+	const char *format;
+	Py_ssize_t itemsize;
+	// 0 for scalar items, number of components for structs (FVector -> 3)
+	Py_ssize_t components;
+	// active exports (memoryviews, numpy arrays...)
+	int exports;
+	// array memory at the time of the first export, reallocations invalidate it
+	void *exported_data;
+	int32 exported_num;
+	// the object pinned by the first export (the weak pointer could be cleared before the release)
+	UObject *pinned_owner;
+	Py_ssize_t shape[2];
+	Py_ssize_t strides[2];
+} ue_PyFPropertyArrayView;
+
+void ue_python_init_fpropertyarrayview(PyObject *);
+
+// returns nullptr (with the python error set) when the array items are not POD
+PyObject *py_ue_new_fpropertyarrayview(UObject *, FArrayProperty *, bool);
+
+// true if a view over the property has live exports, the array cannot be reallocated
+bool ue_py_fpropertyarrayview_is_exported(UObject *, FProperty *);
+
+#endif
@@ -1,7 +1,233 @@
 #include "UEPyFPythonOutputDevice.h"
 
+FUEPyLogRing::FUEPyLogRing(uint32 InCapacity) : Pushed(0), Dropped(0), EnqueuePos(0), DequeuePos(0)
+{
+	uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+	Slots = MakeUnique<FSlot[]>(Capacity);
+	Mask = Capacity - 1;
+	for (uint32 i = 0; i < Capacity; i++)
+	{
+		Slots[i].Sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+bool FUEPyLogRing::Push(const TCHAR *Message, ELogVerbosity::Type Verbosity, const FName &Category)
+{
+	uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+	FSlot *Slot;
+	for (;;)
+	{
+		Slot = &Slots[Pos & Mask];
+		int64 Diff = (int64)Slot->Sequence.load(std::memory_order_acquire) - (int64)Pos;
+		if (Diff == 0)
+		{
+			if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (Diff < 0)
+		{
+			// the consumer is a whole ring behind
+			Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			Pos = EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	Slot->Entry.Message = Message;
+	Slot->Entry.Verbosity = Verbosity;
+	Slot->Entry.Category = Category;
+	Slot->Sequence.store(Pos + 1, std::memory_order_release);
+	Pushed.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool FUEPyLogRing::Pop(FUEPyLogEntry &Entry)
+{
+	uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+	FSlot &Slot = Slots[Pos & Mask];
+	if ((int64)Slot.Sequence.load(std::memory_order_acquire) - (int64)(Pos + 1) < 0)
+		return false;
+
+	Entry = MoveTemp(Slot.Entry);
+	Slot.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+	DequeuePos.store(Pos + 1, std::memory_order_relaxed);
+	return true;
+}
+
+bool FUEPyLogRing::IsEmpty() const
+{
+	uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+	return (int64)Slots[Pos & Mask].Sequence.load(std::memory_order_acquire) - (int64)(Pos + 1) < 0;
+}
+
+uint64 FUEPyLogRing::Num() const
+{
+	uint64 Enqueued = EnqueuePos.load(std::memory_order_relaxed);
+	uint64 Dequeued = DequeuePos.load(std::memory_order_relaxed);
+	return Enqueued > Dequeued ? Enqueued - Dequeued : 0;
+}
+
+FPythonOutputDevice::FPythonOutputDevice(uint32 Capacity, int32 InMaxBatch, bool bInBatch) :
+	Ring(Capacity), Delivered(0), Batches(0), HighWatermark(0), py_serialize(nullptr), MaxBatch(InMaxBatch), bBatch(bInBatch), DrainDepth(0), bPendingDelete(false)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPythonOutputDevice::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPythonOutputDevice::Tick));
+#endif
+	GLog->AddOutputDevice(this);
+	GLog->SerializeBacklog(this);
+}
+
+FPythonOutputDevice::~FPythonOutputDevice()
+{
+	if (GLog)
+	{
+		GLog->RemoveOutputDevice(this);
+	}
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+	Py_XDECREF(py_serialize);
+}
+
+bool FPythonOutputDevice::Tick(float DeltaTime)
+{
+	// do not take the GIL for nothing
+	if (Ring.IsEmpty())
+		return true;
+
+	FScopePythonGIL gil;
+	Drain(MaxBatch);
+	return true;
+}
+
+void FPythonOutputDevice::Destroy()
+{
+	if (DrainDepth > 0)
+	{
+		bPendingDelete = true;
+		return;
+	}
+	delete this;
+}
+
+int32 FPythonOutputDevice::Drain(int32 Max)
+{
+	if (!py_serialize || bPendingDelete)
+		return 0;
+
+	DrainDepth++;
+
+	HighWatermark = FMath::Max(HighWatermark, Ring.Num());
+
+	PyObject *py_batch = bBatch ? PyList_New(0) : nullptr;
+	int32 Count = 0;
+	FUEPyLogEntry Entry;
+	// lines logged by the callable itself are left for the next drain
+	int32 Available = (int32)FMath::Min<uint64>(Ring.Num(), MAX_int32);
+	if (Max > 0)
+		Available = FMath::Min(Available, Max);
+
+	while (Count < Available && !bPendingDelete && Ring.Pop(Entry))
+	{
+		Count++;
+		if (py_batch)
+		{
+			PyObject *py_item = Py_BuildValue((char *)"(sis)", TCHAR_TO_UTF8(*Entry.Message), (int)Entry.Verbosity, TCHAR_TO_UTF8(*Entry.Category.ToString()));
+			PyList_Append(py_batch, py_item);
+			Py_DECREF(py_item);
+			continue;
+		}
+		PyObject *ret = PyObject_CallFunction(py_serialize, (char *)"sis", TCHAR_TO_UTF8(*Entry.Message), (int)Entry.Verbosity, TCHAR_TO_UTF8(*Entry.Category.ToString()));
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+		}
+		Py_XDECREF(ret);
+	}
+
+	Delivered += Count;
+	if (Count > 0)
+		Batches++;
+
+	if (py_batch)
+	{
+		if (Count > 0)
+		{
+			PyObject *ret = PyObject_CallFunctionObjArgs(py_serialize, py_batch, nullptr);
+			if (!ret)
+			{
+				unreal_engine_py_log_error();
+			}
+			Py_XDECREF(ret);
+		}
+		Py_DECREF(py_batch);
+	}
+
+	DrainDepth--;
+	if (DrainDepth == 0 && bPendingDelete)
+	{
+		delete this;
+	}
+
+	return Count;
+}
+
+static PyObject *py_ue_fpython_output_device_flush(ue_PyFPythonOutputDevice *self, PyObject * args)
+{
+	if (!self->device)
+		return PyErr_Format(PyExc_Exception, "output device not initialized");
+	return PyLong_FromLong(self->device->Drain(0));
+}
+
+static PyObject *py_ue_fpython_output_device_get_stats(ue_PyFPythonOutputDevice *self, PyObject * args)
+{
+	FPythonOutputDevice *device = self->device;
+	if (!device)
+		return PyErr_Format(PyExc_Exception, "output device not initialized");
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromUnsignedLongLong(device->Ring.Pushed.load());
+	PyDict_SetItemString(py_stats, "pushed", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(device->Delivered);
+	PyDict_SetItemString(py_stats, "delivered", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(device->Ring.Dropped.load());
+	PyDict_SetItemString(py_stats, "dropped", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(device->Ring.Num());
+	PyDict_SetItemString(py_stats, "pending", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(device->HighWatermark);
+	PyDict_SetItemString(py_stats, "high_watermark", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLong(device->Ring.GetCapacity());
+	PyDict_SetItemString(py_stats, "capacity", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromUnsignedLongLong(device->Batches);
+	PyDict_SetItemString(py_stats, "batches", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
 
 static PyMethodDef ue_PyFPythonOutputDevice_methods[] = {
+	{ "flush", (PyCFunction)py_ue_fpython_output_device_flush, METH_VARARGS, "" },
+	{ "get_stats", (PyCFunction)py_ue_fpython_output_device_get_stats, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
@@ -13,7 +239,10 @@ static PyObject *ue_PyFPythonOutputDevice_str(ue_PyFPythonOutputDevice *self)
 
 static void ue_PyFPythonOutputDevice_dealloc(ue_PyFPythonOutputDevice *self)
 {
-	delete(self->device);
+	if (self->device)
+	{
+		self->device->Destroy();
+	}
 #if PY_MAJOR_VERSION < 3
 	self->ob_type->tp_free((PyObject*)self);
 #else
@@ -57,7 +286,13 @@ static PyTypeObject ue_PyFPythonOutputDeviceType = {
 static int ue_py_fpython_output_device_init(ue_PyFPythonOutputDevice *self, PyObject *args, PyObject *kwargs)
 {
 	PyObject *py_serialize;
-	if (!PyArg_ParseTuple(args, "O", &py_serialize))
+	PyObject *py_batch = nullptr;
+	int capacity = 8192;
+	int max_batch = 0;
+
+	static char *kw_names[] = { (char *)"serialize", (char *)"batch", (char *)"capacity", (char *)"max_batch", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|Oii", kw_names, &py_serialize, &py_batch, &capacity, &max_batch))
 	{
 		return -1;
 	}
@@ -68,11 +303,203 @@ static int ue_py_fpython_output_device_init(ue_PyFPythonOutputDevice *self, PyOb
 		return -1;
 	}
 
-	self->device = new FPythonOutputDevice();
+	if (capacity <= 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "capacity must be greater than 0");
+		return -1;
+	}
+
+	if (self->device)
+	{
+		PyErr_SetString(PyExc_Exception, "output device already initialized");
+		return -1;
+	}
+
+	self->device = new FPythonOutputDevice(capacity, max_batch, py_batch && PyObject_IsTrue(py_batch));
 	self->device->SetPySerialize(py_serialize);
 	return 0;
 }
 
+// line buffered sys.stdout/sys.stderr replacement, a single UE_LOG per complete line
+#define UEPY_OUTPUT_MAX_PENDING 16384
+
+static void ue_py_unreal_engine_output_emit(ue_PyUnrealEngineOutput *self, const char *data, int32 len)
+{
+	FUTF8ToTCHAR converter(data, len);
+	FString message(converter.Length(), converter.Get());
+	if (self->error)
+	{
+		UE_LOG(LogPython, Error, TEXT("%s"), *message);
+	}
+	else
+	{
+		UE_LOG(LogPython, Log, TEXT("%s"), *message);
+	}
+	self->lines++;
+}
+
+static void ue_py_unreal_engine_output_flush_pending(ue_PyUnrealEngineOutput *self)
+{
+	if (self->pending.Num() > 0)
+	{
+		ue_py_unreal_engine_output_emit(self, self->pending.GetData(), self->pending.Num());
+		self->pending.Reset();
+	}
+}
+
+static PyObject *py_ue_unreal_engine_output_write(ue_PyUnrealEngineOutput *self, PyObject * args)
+{
+	PyObject *py_message;
+	if (!PyArg_ParseTuple(args, "O:write", &py_message))
+	{
+		return nullptr;
+	}
+
+	PyObject *stringified = PyObject_Str(py_message);
+	if (!stringified)
+		return PyErr_Format(PyExc_Exception, "argument cannot be casted to string");
+
+	const char *data = UEPyUnicode_AsUTF8(stringified);
+	const char *end = data + strlen(data);
+	const char *start = data;
+	while (const char *newline = (const char *)memchr(start, '\n', end - start))
+	{
+		if (self->pending.Num() > 0)
+		{
+			self->pending.Append(start, newline - start);
+			ue_py_unreal_engine_output_flush_pending(self);
+		}
+		else
+		{
+			ue_py_unreal_engine_output_emit(self, start, newline - start);
+		}
+		start = newline + 1;
+	}
+
+	if (start < end)
+	{
+		self->pending.Append(start, end - start);
+		// do not hold huge lines forever
+		if (self->pending.Num() > UEPY_OUTPUT_MAX_PENDING)
+			ue_py_unreal_engine_output_flush_pending(self);
+	}
+
+	Py_ssize_t written = PyObject_Length(stringified);
+	Py_DECREF(stringified);
+	if (written < 0)
+		return nullptr;
+	return PyLong_FromSsize_t(written);
+}
+
+static PyObject *py_ue_unreal_engine_output_flush(ue_PyUnrealEngineOutput *self, PyObject * args)
+{
+	ue_py_unreal_engine_output_flush_pending(self);
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_unreal_engine_output_isatty(ue_PyUnrealEngineOutput *self, PyObject * args)
+{
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_unreal_engine_output_writable(ue_PyUnrealEngineOutput *self, PyObject * args)
+{
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_ue_unreal_engine_output_get_stats(ue_PyUnrealEngineOutput *self, PyObject * args)
+{
+	return Py_BuildValue((char *)"{s:K,s:i}", "lines", (unsigned long long)self->lines, "pending", self->pending.Num());
+}
+
+static PyMethodDef ue_PyUnrealEngineOutput_methods[] = {
+	{ "write", (PyCFunction)py_ue_unreal_engine_output_write, METH_VARARGS, "" },
+	{ "flush", (PyCFunction)py_ue_unreal_engine_output_flush, METH_VARARGS, "" },
+	{ "isatty", (PyCFunction)py_ue_unreal_engine_output_isatty, METH_VARARGS, "" },
+	{ "writable", (PyCFunction)py_ue_unreal_engine_output_writable, METH_VARARGS, "" },
+	{ "get_stats", (PyCFunction)py_ue_unreal_engine_output_get_stats, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *py_ue_unreal_engine_output_get_encoding(ue_PyUnrealEngineOutput *self, void *closure)
+{
+	return PyUnicode_FromString("utf-8");
+}
+
+static PyGetSetDef ue_PyUnrealEngineOutput_getseters[] = {
+	{ (char *)"encoding", (getter)py_ue_unreal_engine_output_get_encoding, NULL, (char *)"", NULL },
+	{ NULL }  /* Sentinel */
+};
+
+static void ue_PyUnrealEngineOutput_dealloc(ue_PyUnrealEngineOutput *self)
+{
+	ue_py_unreal_engine_output_flush_pending(self);
+	self->pending.~TArray<ANSICHAR>();
+	Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyTypeObject ue_PyUnrealEngineOutputType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.UnrealEngineOutput", /* tp_name */
+	sizeof(ue_PyUnrealEngineOutput), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyUnrealEngineOutput_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine stdout/stderr writer",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyUnrealEngineOutput_methods,             /* tp_methods */
+	0,
+	ue_PyUnrealEngineOutput_getseters,
+};
+
+static PyObject *ue_py_unreal_engine_output_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_error = nullptr;
+
+	static char *kw_names[] = { (char *)"error", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:UnrealEngineOutput", kw_names, &py_error))
+	{
+		return nullptr;
+	}
+
+	ue_PyUnrealEngineOutput *self = (ue_PyUnrealEngineOutput *)type->tp_alloc(type, 0);
+	if (!self)
+		return nullptr;
+
+	new(&self->pending) TArray<ANSICHAR>();
+	self->error = py_error && PyObject_IsTrue(py_error);
+	self->lines = 0;
+	return (PyObject *)self;
+}
+
+PyObject *py_ue_new_unreal_engine_output(bool error)
+{
+	PyObject *py_args = Py_BuildValue((char *)"(O)", error ? Py_True : Py_False);
+	PyObject *ret = ue_py_unreal_engine_output_new(&ue_PyUnrealEngineOutputType, py_args, nullptr);
+	Py_DECREF(py_args);
+	return ret;
+}
+
 void ue_python_init_fpython_output_device(PyObject *ue_module)
 {
 	ue_PyFPythonOutputDeviceType.tp_new = PyType_GenericNew;
@@ -84,6 +511,14 @@ void ue_python_init_fpython_output_device(PyObject *ue_module)
 
 	Py_INCREF(&ue_PyFPythonOutputDeviceType);
 	PyModule_AddObject(ue_module, "FPythonOutputDevice", (PyObject *)&ue_PyFPythonOutputDeviceType);
+
+	ue_PyUnrealEngineOutputType.tp_new = ue_py_unreal_engine_output_new;
+
+	if (PyType_Ready(&ue_PyUnrealEngineOutputType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyUnrealEngineOutputType);
+	PyModule_AddObject(ue_module, "UnrealEngineOutput", (PyObject *)&ue_PyUnrealEngineOutputType);
 }
 
 
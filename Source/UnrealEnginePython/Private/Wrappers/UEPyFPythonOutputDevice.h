@@ -3,25 +3,59 @@
 #include "UEPyModule.h"
 
 #include "Runtime/Core/Public/Misc/OutputDevice.h"
+#include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Templates/UniquePtr.h"
 
-class FPythonOutputDevice : FOutputDevice
+#include <atomic>
+
+struct FUEPyLogEntry
 {
+	FString Message;
+	FName Category;
+	ELogVerbosity::Type Verbosity;
+};
 
+// bounded lock-free ring, any thread can push (log producers), only the python side pops.
+// Every slot has a sequence number telling if it is free for the producer at a given
+// position or ready for the consumer, so producers only race on the enqueue position.
+class FUEPyLogRing
+{
 public:
-	FPythonOutputDevice()
-	{
-		GLog->AddOutputDevice(this);
-		GLog->SerializeBacklog(this);
-	}
+	explicit FUEPyLogRing(uint32 InCapacity);
+
+	// false (and the entry is dropped) when the ring is full, logging threads never wait
+	bool Push(const TCHAR *Message, ELogVerbosity::Type Verbosity, const FName &Category);
+	// single consumer
+	bool Pop(FUEPyLogEntry &Entry);
+
+	bool IsEmpty() const;
+	uint64 Num() const;
+	uint32 GetCapacity() const { return (uint32)(Mask + 1); }
 
-	~FPythonOutputDevice()
+	std::atomic<uint64> Pushed;
+	std::atomic<uint64> Dropped;
+
+private:
+	struct FSlot
 	{
-		if (GLog)
-		{
-			GLog->RemoveOutputDevice(this);
-		}
-		Py_XDECREF(py_serialize);
-	}
+		std::atomic<uint64> Sequence;
+		FUEPyLogEntry Entry;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+	uint64 Mask;
+	std::atomic<uint64> EnqueuePos;
+	std::atomic<uint64> DequeuePos;
+};
+
+// log lines are queued by Serialize (from any thread, without touching python)
+// and delivered to the python callable by a core ticker, with a single GIL acquisition per tick
+class FPythonOutputDevice : FOutputDevice
+{
+
+public:
+	FPythonOutputDevice(uint32 Capacity, int32 InMaxBatch, bool bInBatch);
+	~FPythonOutputDevice();
 
 	void SetPySerialize(PyObject *py_callable)
 	{
@@ -29,21 +63,45 @@ public:
 		Py_INCREF(py_serialize);
 	}
 
+	// the GIL must be held, returns the number of consumed lines (callable errors are logged, not reported)
+	int32 Drain(int32 Max);
+
+	// the python wrapper is going away: the device is deleted now, or at the end of
+	// the running drain if the callable dropped the last reference to the wrapper
+	void Destroy();
+
+	FUEPyLogRing Ring;
+	uint64 Delivered;
+	uint64 Batches;
+	uint64 HighWatermark;
+
 protected:
 	virtual void Serialize(const TCHAR * V, ELogVerbosity::Type Verbosity, const class FName& Category) override
 	{
-		if (!py_serialize)
-			return;
-		PyObject *ret = PyObject_CallFunction(py_serialize, (char *)"sis", TCHAR_TO_UTF8(V), Verbosity, TCHAR_TO_UTF8(*Category.ToString()));
-		if (!ret)
-		{
-			unreal_engine_py_log_error();
-		}
-		Py_XDECREF(ret);
+		Ring.Push(V, Verbosity, Category);
+	}
+
+	virtual bool CanBeUsedOnAnyThread() const override
+	{
+		return true;
 	}
 
 private:
+	bool Tick(float DeltaTime);
+
 	PyObject * py_serialize;
+	int32 MaxBatch;
+	// the callable gets a list of (message, verbosity, category) tuples instead of a call per line
+	bool bBatch;
+	// nested drains (the callable could flush the device)
+	int32 DrainDepth;
+	bool bPendingDelete;
+
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
 };
 
 typedef struct
@@ -53,4 +111,16 @@ typedef struct
 		FPythonOutputDevice *device;
 } ue_PyFPythonOutputDevice;
 
-void ue_python_init_fpython_output_device(PyObject *);
\ No newline at end of file
+// line buffered replacement for sys.stdout and sys.stderr
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<ANSICHAR> pending;
+		bool error;
+		uint64 lines;
+} ue_PyUnrealEngineOutput;
+
+void ue_python_init_fpython_output_device(PyObject *);
+
+PyObject *py_ue_new_unreal_engine_output(bool error);
@@ -281,8 +281,8 @@ PySequenceMethods ue_PyFQuat_sequence_methods;
 
 static int ue_py_fquat_init(ue_PyFQuat *self, PyObject *args, PyObject *kwargs)
 {
-	float x = 0, y = 0, z = 0, w = 1;
-	if (!PyArg_ParseTuple(args, "|ffff", &x, &y, &z, &w))
+	double x = 0, y = 0, z = 0, w = 1;
+	if (!PyArg_ParseTuple(args, "|dddd", &x, &y, &z, &w))
 		return -1;
 
 	self->quat.X = x;
@@ -348,8 +348,8 @@ bool py_ue_quat_arg(PyObject *args, FQuat &quat)
 		return true;
 	}
 
-	float x, y, z, w;
-	if (!PyArg_ParseTuple(args, "ffff", &x, &y, &z, &w))
+	double x, y, z, w;
+	if (!PyArg_ParseTuple(args, "dddd", &x, &y, &z, &w))
 		return false;
 	quat.X = x;
 	quat.Y = y;
@@ -655,6 +655,260 @@ static PyObject *py_ue_fraw_mesh_get_wedge_tex_coords(ue_PyFRawMesh *self, PyObj
 }
 
 
+// bulk (buffer based) access to the FRawMesh streams, a single memcpy per stream
+template<typename T>
+static PyObject *ue_py_fraw_mesh_stream_get_buffer(const TArray<T> &stream, const char *format, int components)
+{
+	Py_ssize_t len = stream.Num() * sizeof(T);
+	PyObject *py_bytes = PyBytes_FromStringAndSize(nullptr, len);
+	if (!py_bytes)
+		return nullptr;
+	FMemory::Memcpy(PyBytes_AsString(py_bytes), stream.GetData(), len);
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_memoryview = PyMemoryView_FromObject(py_bytes);
+	Py_DECREF(py_bytes);
+	if (!py_memoryview)
+		return nullptr;
+	PyObject *py_typed;
+	// memoryview.cast() does not accept zeros in the shape
+	if (components > 1 && stream.Num() > 0)
+		py_typed = PyObject_CallMethod(py_memoryview, (char *)"cast", (char *)"s(ii)", format, stream.Num(), components);
+	else
+		py_typed = PyObject_CallMethod(py_memoryview, (char *)"cast", (char *)"s", format);
+	Py_DECREF(py_memoryview);
+	return py_typed;
+#else
+	return py_bytes;
+#endif
+}
+
+// raw bytes are always accepted, otherwise the item format must match the stream components
+static bool ue_py_fraw_mesh_buffer_format_is_valid(Py_buffer *py_buf, char kind, Py_ssize_t component_size)
+{
+	const char *format = py_buf->format ? py_buf->format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+	if (!strcmp(format, "B") || !strcmp(format, "b") || !strcmp(format, "c"))
+		return true;
+	if (py_buf->itemsize != component_size || strlen(format) != 1)
+		return false;
+	if (kind == 'f')
+		return format[0] == 'f';
+	if (kind == 'i')
+		return strchr("iIlL", format[0]) != nullptr;
+	return false;
+}
+
+template<typename T>
+static bool ue_py_fraw_mesh_stream_set_buffer(PyObject *py_obj, TArray<T> &stream, char kind, Py_ssize_t component_size)
+{
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return false;
+
+	if (!ue_py_fraw_mesh_buffer_format_is_valid(&py_buf, kind, component_size))
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s'", py_buf.format ? py_buf.format : "B");
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	if (py_buf.len % sizeof(T) != 0)
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of the item size (%d)", (int)py_buf.len, (int)sizeof(T));
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	stream.SetNumUninitialized(py_buf.len / sizeof(T));
+	FMemory::Memcpy(stream.GetData(), py_buf.buf, py_buf.len);
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+static PyObject *py_ue_fraw_mesh_get_vertex_positions_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.VertexPositions, "f", 3);
+}
+
+static PyObject *py_ue_fraw_mesh_set_vertex_positions_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_vertex_positions_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.VertexPositions, 'f', sizeof(float)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_indices_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeIndices, "I", 1);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_indices_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_wedge_indices_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeIndices, 'i', sizeof(uint32)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_tangent_x_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeTangentX, "f", 3);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_tangent_x_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_wedge_tangent_x_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeTangentX, 'f', sizeof(float)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_tangent_y_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeTangentY, "f", 3);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_tangent_y_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_wedge_tangent_y_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeTangentY, 'f', sizeof(float)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_tangent_z_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeTangentZ, "f", 3);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_tangent_z_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_wedge_tangent_z_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeTangentZ, 'f', sizeof(float)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_colors_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeColors, "B", 4);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_colors_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_wedge_colors_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeColors, 'B', sizeof(uint8)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_face_material_indices_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.FaceMaterialIndices, "i", 1);
+}
+
+static PyObject *py_ue_fraw_mesh_set_face_material_indices_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_face_material_indices_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.FaceMaterialIndices, 'i', sizeof(int32)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_face_smoothing_masks_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.FaceSmoothingMasks, "I", 1);
+}
+
+static PyObject *py_ue_fraw_mesh_set_face_smoothing_masks_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	if (!PyArg_ParseTuple(args, "O:set_face_smoothing_masks_buffer", &data))
+	{
+		return nullptr;
+	}
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.FaceSmoothingMasks, 'i', sizeof(uint32)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fraw_mesh_get_wedge_tex_coords_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	int index = 0;
+
+	if (!PyArg_ParseTuple(args, "|i:get_wedge_tex_coords_buffer", &index))
+		return nullptr;
+
+	if (index < 0 || index >= MAX_MESH_TEXTURE_COORDS)
+		return PyErr_Format(PyExc_Exception, "invalid TexCoords index");
+
+	return ue_py_fraw_mesh_stream_get_buffer(self->raw_mesh.WedgeTexCoords[index], "f", 2);
+}
+
+static PyObject *py_ue_fraw_mesh_set_wedge_tex_coords_buffer(ue_PyFRawMesh *self, PyObject * args)
+{
+	PyObject *data;
+	int index = 0;
+	if (!PyArg_ParseTuple(args, "O|i:set_wedge_tex_coords_buffer", &data, &index))
+	{
+		return nullptr;
+	}
+
+	if (index < 0 || index >= MAX_MESH_TEXTURE_COORDS)
+		return PyErr_Format(PyExc_Exception, "invalid TexCoords index");
+
+	if (!ue_py_fraw_mesh_stream_set_buffer(data, self->raw_mesh.WedgeTexCoords[index], 'f', sizeof(float)))
+		return nullptr;
+
+	Py_RETURN_NONE;
+}
+
 static PyMethodDef ue_PyFRawMesh_methods[] = {
 	{ "set_vertex_positions", (PyCFunction)py_ue_fraw_mesh_set_vertex_positions, METH_VARARGS, "" },
 	{ "set_wedge_indices", (PyCFunction)py_ue_fraw_mesh_set_wedge_indices, METH_VARARGS, "" },
@@ -675,6 +929,24 @@ static PyMethodDef ue_PyFRawMesh_methods[] = {
 	{ "get_face_material_indices", (PyCFunction)py_ue_fraw_mesh_get_face_material_indices, METH_VARARGS, "" },
 	{ "save_to_static_mesh_source_model", (PyCFunction)py_ue_fraw_mesh_save_to_static_mesh_source_model, METH_VARARGS, "" },
 	{ "get_wedges_num", (PyCFunction)py_ue_fraw_mesh_get_wedges_num, METH_VARARGS, "" },
+	{ "get_vertex_positions_buffer", (PyCFunction)py_ue_fraw_mesh_get_vertex_positions_buffer, METH_VARARGS, "" },
+	{ "set_vertex_positions_buffer", (PyCFunction)py_ue_fraw_mesh_set_vertex_positions_buffer, METH_VARARGS, "" },
+	{ "get_wedge_indices_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_indices_buffer, METH_VARARGS, "" },
+	{ "set_wedge_indices_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_indices_buffer, METH_VARARGS, "" },
+	{ "get_wedge_tangent_x_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_tangent_x_buffer, METH_VARARGS, "" },
+	{ "set_wedge_tangent_x_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_tangent_x_buffer, METH_VARARGS, "" },
+	{ "get_wedge_tangent_y_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_tangent_y_buffer, METH_VARARGS, "" },
+	{ "set_wedge_tangent_y_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_tangent_y_buffer, METH_VARARGS, "" },
+	{ "get_wedge_tangent_z_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_tangent_z_buffer, METH_VARARGS, "" },
+	{ "set_wedge_tangent_z_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_tangent_z_buffer, METH_VARARGS, "" },
+	{ "get_wedge_colors_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_colors_buffer, METH_VARARGS, "" },
+	{ "set_wedge_colors_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_colors_buffer, METH_VARARGS, "" },
+	{ "get_face_material_indices_buffer", (PyCFunction)py_ue_fraw_mesh_get_face_material_indices_buffer, METH_VARARGS, "" },
+	{ "set_face_material_indices_buffer", (PyCFunction)py_ue_fraw_mesh_set_face_material_indices_buffer, METH_VARARGS, "" },
+	{ "get_face_smoothing_masks_buffer", (PyCFunction)py_ue_fraw_mesh_get_face_smoothing_masks_buffer, METH_VARARGS, "" },
+	{ "set_face_smoothing_masks_buffer", (PyCFunction)py_ue_fraw_mesh_set_face_smoothing_masks_buffer, METH_VARARGS, "" },
+	{ "get_wedge_tex_coords_buffer", (PyCFunction)py_ue_fraw_mesh_get_wedge_tex_coords_buffer, METH_VARARGS, "" },
+	{ "set_wedge_tex_coords_buffer", (PyCFunction)py_ue_fraw_mesh_set_wedge_tex_coords_buffer, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
@@ -0,0 +1,266 @@
+#include "UEPyFRenderTargetReadback.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+
+#include "RenderingThread.h"
+#include "UEPyFTextureMipLock.h"
+
+typedef TSharedPtr<FUEPyRenderTargetReadback, ESPMode::ThreadSafe> FUEPyRenderTargetReadbackPtr;
+
+// copy the staging buffer (once the gpu is done with it) to the readback memory
+static void ue_py_frender_target_readback_map(FUEPyRenderTargetReadbackPtr state)
+{
+	state->bMapping = true;
+	ENQUEUE_RENDER_COMMAND(UEPyRenderTargetReadbackMap)(
+		[state](FRHICommandListImmediate &RHICmdList)
+	{
+		int32 row_pitch_in_pixels = 0;
+#if ENGINE_MAJOR_VERSION == 5
+		const uint8 *src = (const uint8 *)state->Readback->Lock(row_pitch_in_pixels);
+#else
+		void *locked = nullptr;
+		state->Readback->LockTexture(RHICmdList, locked, row_pitch_in_pixels);
+		const uint8 *src = (const uint8 *)locked;
+#endif
+		if (src)
+		{
+			int32 row_size = state->Width * state->BytesPerPixel;
+			int32 src_pitch = FMath::Max(row_pitch_in_pixels, state->Width) * state->BytesPerPixel;
+			state->Data.SetNumUninitialized(row_size * state->Height);
+			if (src_pitch == row_size)
+			{
+				FMemory::Memcpy(state->Data.GetData(), src, row_size * state->Height);
+			}
+			else
+			{
+				for (int32 y = 0; y < state->Height; y++)
+				{
+					FMemory::Memcpy(state->Data.GetData() + y * row_size, src + y * src_pitch, row_size);
+				}
+			}
+			state->Readback->Unlock();
+		}
+		state->bCompleted = true;
+	});
+}
+
+static bool ue_py_frender_target_readback_poll(FUEPyRenderTargetReadbackPtr state)
+{
+	if (state->bCompleted)
+		return true;
+
+	if (!state->bMapping && state->bCopyEnqueued && state->Readback->IsReady())
+	{
+		ue_py_frender_target_readback_map(state);
+	}
+
+	return false;
+}
+
+static PyObject *py_ue_frender_target_readback_done(ue_PyFRenderTargetReadback *self, PyObject * args)
+{
+	if (ue_py_frender_target_readback_poll(self->readback))
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_frender_target_readback_wait(ue_PyFRenderTargetReadback *self, PyObject * args)
+{
+	FUEPyRenderTargetReadbackPtr state = self->readback;
+
+	Py_BEGIN_ALLOW_THREADS;
+	if (!state->bCompleted)
+	{
+		if (!state->bMapping)
+		{
+			// be sure the copy has been enqueued, the lock will wait for the gpu
+			FlushRenderingCommands();
+			ue_py_frender_target_readback_map(state);
+		}
+		FlushRenderingCommands();
+	}
+	Py_END_ALLOW_THREADS;
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_frender_target_readback_result(ue_PyFRenderTargetReadback *self, PyObject * args)
+{
+	if (!ue_py_frender_target_readback_poll(self->readback))
+		return PyErr_Format(PyExc_Exception, "readback is not completed, poll it with done() or call wait()");
+
+	if (self->readback->Data.Num() == 0)
+		return PyErr_Format(PyExc_Exception, "unable to read pixels");
+
+	return PyMemoryView_FromObject((PyObject *)self);
+}
+
+static PyObject *py_ue_frender_target_readback_get_pixel_format(ue_PyFRenderTargetReadback *self, PyObject * args)
+{
+	return PyLong_FromLong((int)self->readback->PixelFormat);
+}
+
+static PyObject *py_ue_frender_target_readback_get_size(ue_PyFRenderTargetReadback *self, PyObject * args)
+{
+	return Py_BuildValue((char *)"(ii)", self->readback->Width, self->readback->Height);
+}
+
+static PyMethodDef ue_PyFRenderTargetReadback_methods[] = {
+	{ "done", (PyCFunction)py_ue_frender_target_readback_done, METH_VARARGS, "" },
+	{ "wait", (PyCFunction)py_ue_frender_target_readback_wait, METH_VARARGS, "" },
+	{ "result", (PyCFunction)py_ue_frender_target_readback_result, METH_VARARGS, "" },
+	{ "get_pixel_format", (PyCFunction)py_ue_frender_target_readback_get_pixel_format, METH_VARARGS, "" },
+	{ "get_size", (PyCFunction)py_ue_frender_target_readback_get_size, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFRenderTargetReadback_str(ue_PyFRenderTargetReadback *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FRenderTargetReadback %dx%d format: '%s' completed: %d>",
+		self->readback->Width, self->readback->Height, self->format, self->readback->bCompleted ? 1 : 0);
+}
+
+static void ue_PyFRenderTargetReadback_dealloc(ue_PyFRenderTargetReadback *self)
+{
+	// a pending render command keeps the state alive
+	self->readback.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int ue_PyFRenderTargetReadback_getbuffer(ue_PyFRenderTargetReadback *self, Py_buffer *view, int flags)
+{
+	view->obj = nullptr;
+
+	if (!self->readback->bCompleted || self->readback->Data.Num() == 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "readback is not completed");
+		return -1;
+	}
+
+	if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE)
+	{
+		PyErr_SetString(PyExc_BufferError, "readback data is read-only");
+		return -1;
+	}
+
+	view->buf = self->readback->Data.GetData();
+	view->obj = (PyObject *)self;
+	Py_INCREF(self);
+	view->len = self->readback->Data.Num();
+	view->readonly = 1;
+	view->internal = nullptr;
+	view->suboffsets = nullptr;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->itemsize = self->itemsize;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)self->format : nullptr;
+		view->ndim = self->ndim;
+		view->shape = self->shape;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+	}
+	else
+	{
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)"B" : nullptr;
+		view->ndim = 1;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	return 0;
+}
+
+static PyTypeObject ue_PyFRenderTargetReadbackType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FRenderTargetReadback", /* tp_name */
+	sizeof(ue_PyFRenderTargetReadback), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFRenderTargetReadback_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFRenderTargetReadback_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine Render Target Readback",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFRenderTargetReadback_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PyBufferProcs ue_PyFRenderTargetReadback_buffer_procs;
+
+void ue_python_init_frender_target_readback(PyObject *ue_module)
+{
+	memset(&ue_PyFRenderTargetReadback_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFRenderTargetReadbackType.tp_as_buffer = &ue_PyFRenderTargetReadback_buffer_procs;
+	ue_PyFRenderTargetReadback_buffer_procs.bf_getbuffer = (getbufferproc)ue_PyFRenderTargetReadback_getbuffer;
+
+	if (PyType_Ready(&ue_PyFRenderTargetReadbackType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFRenderTargetReadbackType);
+	PyModule_AddObject(ue_module, "FRenderTargetReadback", (PyObject *)&ue_PyFRenderTargetReadbackType);
+}
+
+PyObject *py_ue_new_frender_target_readback(UTextureRenderTarget2D *tex)
+{
+	FTextureRenderTargetResource *resource = tex->GameThread_GetRenderTargetResource();
+	if (!resource)
+		return PyErr_Format(PyExc_Exception, "cannot get render target resource");
+
+	EPixelFormat pixel_format = tex->GetFormat();
+
+	FUEPyRenderTargetReadbackPtr state = MakeShareable(new FUEPyRenderTargetReadback());
+	state->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("UnrealEnginePythonReadback"));
+	state->Width = tex->SizeX;
+	state->Height = tex->SizeY;
+	state->BytesPerPixel = GPixelFormats[pixel_format].BlockBytes;
+	state->PixelFormat = pixel_format;
+
+	ENQUEUE_RENDER_COMMAND(UEPyRenderTargetReadbackCopy)(
+		[state, resource](FRHICommandListImmediate &RHICmdList)
+	{
+		state->Readback->EnqueueCopy(RHICmdList, resource->GetRenderTargetTexture());
+		state->bCopyEnqueued = true;
+	});
+
+	ue_PyFRenderTargetReadback *ret = (ue_PyFRenderTargetReadback *)PyObject_New(ue_PyFRenderTargetReadback, &ue_PyFRenderTargetReadbackType);
+	new(&ret->readback) FUEPyRenderTargetReadbackPtr(state);
+
+	// float16/float32 targets are exposed with their component format, unknown ones as raw bytes per pixel
+	Py_ssize_t components = 0;
+	if (!ue_py_get_pixel_format_layout(pixel_format, ret->format, ret->itemsize, components) || components * ret->itemsize != state->BytesPerPixel)
+	{
+		ret->format = "B";
+		ret->itemsize = 1;
+		components = state->BytesPerPixel;
+	}
+	ret->ndim = components > 1 ? 3 : 2;
+	ret->shape[0] = state->Height;
+	ret->shape[1] = state->Width;
+	ret->shape[2] = components;
+	ret->strides[0] = state->Width * state->BytesPerPixel;
+	ret->strides[1] = state->BytesPerPixel;
+	ret->strides[2] = ret->itemsize;
+
+	return (PyObject *)ret;
+}
+
+#endif
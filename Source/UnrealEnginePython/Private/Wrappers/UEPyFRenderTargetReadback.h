@@ -0,0 +1,43 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+
+#include "Engine/TextureRenderTarget2D.h"
+#include "RHIGPUReadback.h"
+
+// state shared between python and the render thread
+struct FUEPyRenderTargetReadback
+{
+	TUniquePtr<FRHIGPUTextureReadback> Readback;
+	TArray<uint8> Data;
+	int32 Width;
+	int32 Height;
+	int32 BytesPerPixel;
+	EPixelFormat PixelFormat;
+	// the gpu copy has been enqueued by the render thread
+	FThreadSafeBool bCopyEnqueued;
+	// the staging buffer is being copied to Data
+	FThreadSafeBool bMapping;
+	FThreadSafeBool bCompleted;
+};
+
+// future like object for non-blocking render target readbacks
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TSharedPtr<FUEPyRenderTargetReadback, ESPMode::ThreadSafe> readback;
+	const char *format;
+	Py_ssize_t itemsize;
+	int ndim;
+	Py_ssize_t shape[3];
+	Py_ssize_t strides[3];
+} ue_PyFRenderTargetReadback;
+
+void ue_python_init_frender_target_readback(PyObject *);
+
+PyObject *py_ue_new_frender_target_readback(UTextureRenderTarget2D *);
+
+#endif
@@ -1,20 +1,167 @@
 #include "UEPyFSocket.h"
 
+#include "HAL/RunnableThread.h"
+
+#define UEPY_SOCKET_DEFAULT_MAX_QUEUED 65536
+
+FUEPySocketState::~FUEPySocketState()
+{
+	// connections never accepted by python
+	FSocket *connection = nullptr;
+	while (Connections.Dequeue(connection))
+	{
+		connection->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(connection);
+	}
+}
+
+bool FUEPySocketState::Enqueue(FUEPySocketPacket &&Packet)
+{
+	Received.Increment();
+	ReceivedBytes.Add(Packet.Data.Num());
+	// python is not draining fast enough, drop instead of growing forever
+	if (MaxQueued > 0 && Queued.GetValue() >= MaxQueued)
+	{
+		Dropped.Increment();
+		return false;
+	}
+	Packets.Enqueue(MoveTemp(Packet));
+	Queued.Increment();
+	return true;
+}
+
+FUEPyTcpSocketReceiver::FUEPyTcpSocketReceiver(FSocket *InSocket, FUEPySocketStatePtr InState, bool bInListener, int32 InBufferSize) :
+	Socket(InSocket), State(InState), bListener(bInListener), BufferSize(InBufferSize)
+{
+}
+
+uint32 FUEPyTcpSocketReceiver::Run()
+{
+	TArray<uint8> Buffer;
+	FIPv4Endpoint Peer;
+	if (!bListener)
+	{
+		Buffer.SetNumUninitialized(FMath::Max(BufferSize, 1));
+		TSharedPtr<FInternetAddr> PeerAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+		Socket->GetPeerAddress(*PeerAddr);
+		Peer = FIPv4Endpoint(PeerAddr);
+	}
+
+	while (Stopping.GetValue() == 0)
+	{
+		// dropping a chunk would corrupt the stream: stop reading until python drains the queue,
+		// the kernel buffer fills up and tcp flow control slows down the peer
+		if (!bListener && State->MaxQueued > 0 && State->Queued.GetValue() >= State->MaxQueued)
+		{
+			FPlatformProcess::Sleep(0.01f);
+			continue;
+		}
+
+		// wake up periodically to check for Stop()
+		if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+			continue;
+
+		if (bListener)
+		{
+			bool bPending = false;
+			if (Socket->HasPendingConnection(bPending) && bPending)
+			{
+				FSocket *Connection = Socket->Accept(*FString::Printf(TEXT("%s Connection"), *Socket->GetDescription()));
+				if (Connection)
+				{
+					State->Connections.Enqueue(Connection);
+					State->Received.Increment();
+				}
+			}
+			continue;
+		}
+
+		int32 BytesRead = 0;
+		if (!Socket->Recv(Buffer.GetData(), Buffer.Num(), BytesRead) || BytesRead <= 0)
+		{
+			if (ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK)
+				continue;
+			// closed by the peer
+			State->Disconnected.Set(1);
+			break;
+		}
+
+		FUEPySocketPacket Packet;
+		Packet.Data.Append(Buffer.GetData(), BytesRead);
+		Packet.Endpoint = Peer;
+		State->Enqueue(MoveTemp(Packet));
+	}
+
+	return 0;
+}
+
+void FUEPyTcpSocketReceiver::Stop()
+{
+	Stopping.Set(1);
+}
+
+extern PyTypeObject ue_PyFSocketType;
+
+static void ue_py_fsocket_setup(ue_PyFSocket *self, FSocket *sock, EUEPySocketKind kind, int32 buffer_size)
+{
+	self->sock = sock;
+	self->kind = kind;
+	self->udp_receiver = nullptr;
+	self->tcp_receiver = nullptr;
+	self->tcp_receiver_thread = nullptr;
+	new(&self->state) FUEPySocketStatePtr(new FUEPySocketState());
+	self->state->MaxQueued = UEPY_SOCKET_DEFAULT_MAX_QUEUED;
+	self->buffer_size = buffer_size;
+}
+
+static ue_PyFSocket *py_ue_new_fsocket(FSocket *sock, EUEPySocketKind kind, int32 buffer_size)
+{
+	ue_PyFSocket *ret = (ue_PyFSocket *)PyObject_New(ue_PyFSocket, &ue_PyFSocketType);
+	ue_py_fsocket_setup(ret, sock, kind, buffer_size);
+	return ret;
+}
 
 static PyObject *py_ue_fsocket_start_receiver(ue_PyFSocket *self, PyObject * args)
 {
+	int max_queued = UEPY_SOCKET_DEFAULT_MAX_QUEUED;
+	if (!PyArg_ParseTuple(args, "|i:start_receiver", &max_queued))
+	{
+		return nullptr;
+	}
 
-	if (self->udp_receiver)
+	if (!self->sock)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is closed");
+	}
+
+	if (self->udp_receiver || self->tcp_receiver)
 	{
 		return PyErr_Format(PyExc_Exception, "receiver already started");
 	}
 
-	self->udp_receiver = new FUdpSocketReceiver(self->sock, FTimespan::FromMilliseconds(100), *FString::Printf(TEXT("%s Thread"), *self->sock->GetDescription()));
-	self->udp_receiver->OnDataReceived().BindRaw(self, &ue_PyFSocket::udp_recv);
-	self->udp_receiver->Start();
+	FUEPySocketStatePtr state = self->state;
+	state->MaxQueued = max_queued;
+
+	if (self->kind == EUEPySocketKind::Udp)
+	{
+		self->udp_receiver = new FUdpSocketReceiver(self->sock, FTimespan::FromMilliseconds(100), *FString::Printf(TEXT("%s Thread"), *self->sock->GetDescription()));
+		// runs in the receiver thread, the datagram buffer is moved (not copied) into the queue
+		self->udp_receiver->OnDataReceived().BindLambda([state](const FArrayReaderPtr& ArrayReaderPtr, const FIPv4Endpoint& EndPt)
+		{
+			FUEPySocketPacket Packet;
+			Packet.Data = MoveTemp(static_cast<TArray<uint8> &>(*ArrayReaderPtr));
+			Packet.Endpoint = EndPt;
+			state->Enqueue(MoveTemp(Packet));
+		});
+		self->udp_receiver->Start();
+	}
+	else
+	{
+		self->tcp_receiver = new FUEPyTcpSocketReceiver(self->sock, state, self->kind == EUEPySocketKind::TcpListener, self->buffer_size);
+		self->tcp_receiver_thread = FRunnableThread::Create(self->tcp_receiver, *FString::Printf(TEXT("%s Thread"), *self->sock->GetDescription()));
+	}
 
-	Py_INCREF(Py_None);
-	return Py_None;
+	Py_RETURN_NONE;
 }
 
 static void sock_close(ue_PyFSocket *self)
@@ -35,48 +182,280 @@ static void sock_stop_receiver(ue_PyFSocket *self)
 		delete(self->udp_receiver);
 		self->udp_receiver = nullptr;
 	}
+
+	if (self->tcp_receiver)
+	{
+		self->tcp_receiver_thread->Kill(true);
+		delete(self->tcp_receiver_thread);
+		delete(self->tcp_receiver);
+		self->tcp_receiver_thread = nullptr;
+		self->tcp_receiver = nullptr;
+	}
 }
 
 static PyObject *py_ue_fsocket_stop_receiver(ue_PyFSocket *self, PyObject * args)
 {
-	if (!self->udp_receiver)
+	if (!self->udp_receiver && !self->tcp_receiver)
 	{
 		return PyErr_Format(PyExc_Exception, "receiver not started");
 	}
 
+	// the receiver thread never needs the GIL
+	Py_BEGIN_ALLOW_THREADS;
 	sock_stop_receiver(self);
+	Py_END_ALLOW_THREADS;
 
-	Py_INCREF(Py_None);
-	return Py_None;
+	Py_RETURN_NONE;
 }
 
 static PyObject *py_ue_fsocket_close(ue_PyFSocket *self, PyObject * args)
 {
 
-	if (self->udp_receiver)
+	if (self->udp_receiver || self->tcp_receiver)
 	{
 		return PyErr_Format(PyExc_Exception, "you have to stop its receiver before closing a socket");
 	}
 
 	sock_close(self);
 
-	Py_INCREF(Py_None);
-	return Py_None;
+	Py_RETURN_NONE;
+}
+
+// returns a list of (data, (address, port)) tuples for udp sockets and of data chunks for tcp connections
+static PyObject *py_ue_fsocket_drain(ue_PyFSocket *self, PyObject * args)
+{
+	int max_count = 0;
+	if (!PyArg_ParseTuple(args, "|i:drain", &max_count))
+	{
+		return nullptr;
+	}
+
+	FUEPySocketStatePtr state = self->state;
+
+	PyObject *py_list = PyList_New(0);
+	int32 count = 0;
+	FUEPySocketPacket packet;
+	while ((max_count <= 0 || count < max_count) && state->Packets.Dequeue(packet))
+	{
+		count++;
+		PyObject *py_item = PyBytes_FromStringAndSize((const char *)packet.Data.GetData(), packet.Data.Num());
+		if (self->kind == EUEPySocketKind::Udp)
+		{
+			py_item = Py_BuildValue("(N(si))", py_item, TCHAR_TO_UTF8(*packet.Endpoint.Address.ToString()), (int)packet.Endpoint.Port);
+		}
+		PyList_Append(py_list, py_item);
+		Py_DECREF(py_item);
+	}
+	state->Queued.Subtract(count);
+
+	return py_list;
+}
+
+static PyObject *py_ue_fsocket_pending(ue_PyFSocket *self, PyObject * args)
+{
+	return PyLong_FromLong(FMath::Max(self->state->Queued.GetValue(), 0));
+}
+
+static PyObject *py_ue_fsocket_accept(ue_PyFSocket *self, PyObject * args)
+{
+	int max_count = 0;
+	if (!PyArg_ParseTuple(args, "|i:accept", &max_count))
+	{
+		return nullptr;
+	}
+
+	if (self->kind != EUEPySocketKind::TcpListener)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is not a tcp listener");
+	}
+
+	PyObject *py_list = PyList_New(0);
+	int32 count = 0;
+	FSocket *connection = nullptr;
+	while ((max_count <= 0 || count < max_count) && self->state->Connections.Dequeue(connection))
+	{
+		count++;
+		ue_PyFSocket *py_connection = py_ue_new_fsocket(connection, EUEPySocketKind::TcpConnection, self->buffer_size);
+		PyList_Append(py_list, (PyObject *)py_connection);
+		Py_DECREF(py_connection);
+	}
+
+	return py_list;
+}
+
+// the buffer is sent in place, the GIL is released while the socket blocks
+static PyObject *py_ue_fsocket_send(ue_PyFSocket *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:send", &py_obj))
+	{
+		return nullptr;
+	}
+
+	if (!self->sock)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is closed");
+	}
+
+	if (self->kind != EUEPySocketKind::TcpConnection)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is not a tcp connection, use send_to()");
+	}
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_SIMPLE) < 0)
+	{
+		return PyErr_Format(PyExc_Exception, "argument does not support the buffer protocol");
+	}
+
+	FSocket *sock = self->sock;
+	const uint8 *data = (const uint8 *)py_buf.buf;
+	int32 size = (int32)py_buf.len;
+	int32 total_sent = 0;
+	bool success = true;
+
+	Py_BEGIN_ALLOW_THREADS;
+	while (total_sent < size)
+	{
+		int32 sent = 0;
+		if (!sock->Send(data + total_sent, size - total_sent, sent))
+		{
+			success = false;
+			break;
+		}
+		total_sent += sent;
+	}
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&py_buf);
+
+	if (!success)
+	{
+		return PyErr_Format(PyExc_Exception, "unable to send data (%d of %d bytes sent)", total_sent, size);
+	}
+
+	return PyLong_FromLong(total_sent);
 }
 
+static PyObject *py_ue_fsocket_send_to(ue_PyFSocket *self, PyObject * args)
+{
+	PyObject *py_obj;
+	char *socket_addr;
+	int port_number;
+	if (!PyArg_ParseTuple(args, "Osi:send_to", &py_obj, &socket_addr, &port_number))
+	{
+		return nullptr;
+	}
 
+	if (!self->sock)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is closed");
+	}
+
+	if (self->kind != EUEPySocketKind::Udp)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is not an udp socket, use send()");
+	}
+
+	FIPv4Address addr;
+	if (!FIPv4Address::Parse(UTF8_TO_TCHAR(socket_addr), addr))
+	{
+		return PyErr_Format(PyExc_ValueError, "invalid address %s", socket_addr);
+	}
+	TSharedRef<FInternetAddr> remote = FIPv4Endpoint(addr, port_number).ToInternetAddr();
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_SIMPLE) < 0)
+	{
+		return PyErr_Format(PyExc_Exception, "argument does not support the buffer protocol");
+	}
+
+	FSocket *sock = self->sock;
+	int32 sent = 0;
+	bool success;
+
+	Py_BEGIN_ALLOW_THREADS;
+	success = sock->SendTo((const uint8 *)py_buf.buf, (int32)py_buf.len, sent, *remote);
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&py_buf);
+
+	if (!success)
+	{
+		return PyErr_Format(PyExc_Exception, "unable to send datagram to %s:%d", socket_addr, port_number);
+	}
+
+	return PyLong_FromLong(sent);
+}
+
+static PyObject *py_ue_fsocket_is_connected(ue_PyFSocket *self, PyObject * args)
+{
+	if (!self->sock || self->state->Disconnected.GetValue() != 0)
+		Py_RETURN_FALSE;
+
+	if (self->kind == EUEPySocketKind::TcpConnection && self->sock->GetConnectionState() != SCS_Connected)
+		Py_RETURN_FALSE;
+
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_ue_fsocket_get_port(ue_PyFSocket *self, PyObject * args)
+{
+	if (!self->sock)
+	{
+		return PyErr_Format(PyExc_Exception, "socket is closed");
+	}
+
+	return PyLong_FromLong(self->sock->GetPortNo());
+}
+
+static PyObject *py_ue_fsocket_get_stats(ue_PyFSocket *self, PyObject * args)
+{
+	FUEPySocketStatePtr state = self->state;
+
+	PyObject *py_stats = PyDict_New();
+
+	PyObject *py_value = PyLong_FromLongLong(state->Received.GetValue());
+	PyDict_SetItemString(py_stats, "received", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLongLong(state->ReceivedBytes.GetValue());
+	PyDict_SetItemString(py_stats, "received_bytes", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLongLong(state->Dropped.GetValue());
+	PyDict_SetItemString(py_stats, "dropped", py_value);
+	Py_DECREF(py_value);
+
+	py_value = PyLong_FromLong(FMath::Max(state->Queued.GetValue(), 0));
+	PyDict_SetItemString(py_stats, "queued", py_value);
+	Py_DECREF(py_value);
+
+	return py_stats;
+}
 
 static PyMethodDef ue_PyFSocket_methods[] = {
 
 	{ "start_receiver", (PyCFunction)py_ue_fsocket_start_receiver, METH_VARARGS, "" },
 	{ "stop_receiver", (PyCFunction)py_ue_fsocket_stop_receiver, METH_VARARGS, "" },
 	{ "close", (PyCFunction)py_ue_fsocket_close, METH_VARARGS, "" },
+	{ "drain", (PyCFunction)py_ue_fsocket_drain, METH_VARARGS, "" },
+	{ "pending", (PyCFunction)py_ue_fsocket_pending, METH_VARARGS, "" },
+	{ "accept", (PyCFunction)py_ue_fsocket_accept, METH_VARARGS, "" },
+	{ "send", (PyCFunction)py_ue_fsocket_send, METH_VARARGS, "" },
+	{ "send_to", (PyCFunction)py_ue_fsocket_send_to, METH_VARARGS, "" },
+	{ "is_connected", (PyCFunction)py_ue_fsocket_is_connected, METH_VARARGS, "" },
+	{ "get_port", (PyCFunction)py_ue_fsocket_get_port, METH_VARARGS, "" },
+	{ "get_stats", (PyCFunction)py_ue_fsocket_get_stats, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
 
 static PyObject *ue_PyFSocket_str(ue_PyFSocket *self)
 {
+	if (!self->sock)
+		return PyUnicode_FromString("<unreal_engine.FSocket closed>");
+
 	return PyUnicode_FromFormat("<unreal_engine.FSocket '%s'>",
 		TCHAR_TO_UTF8(*self->sock->GetDescription()));
 }
@@ -86,10 +465,12 @@ static void ue_py_fsocket_dealloc(ue_PyFSocket *self)
 
 	sock_stop_receiver(self);
 	sock_close(self);
+	self->state.~FUEPySocketStatePtr();
 
+	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
-static PyTypeObject ue_PyFSocketType = {
+PyTypeObject ue_PyFSocketType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.FSocket", /* tp_name */
 	sizeof(ue_PyFSocket), /* tp_basicsize */
@@ -122,6 +503,16 @@ static PyTypeObject ue_PyFSocketType = {
 	0,
 };
 
+static PyObject *ue_py_fsocket_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	ue_PyFSocket *self = (ue_PyFSocket *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		ue_py_fsocket_setup(self, nullptr, EUEPySocketKind::Udp, 1024);
+	}
+	return (PyObject *)self;
+}
+
 static int ue_py_fsocket_init(ue_PyFSocket *self, PyObject *args, PyObject *kwargs)
 {
 	char *socket_desc;
@@ -131,18 +522,30 @@ static int ue_py_fsocket_init(ue_PyFSocket *self, PyObject *args, PyObject *kwar
 	if (!PyArg_ParseTuple(args, "ssi|i", &socket_desc, &socket_addr, &port_number, &buffer_size))
 		return -1;
 
+	if (self->sock)
+	{
+		PyErr_SetString(PyExc_Exception, "socket already initialized");
+		return -1;
+	}
+
 	FIPv4Address addr;
 	FIPv4Address::Parse(socket_addr, addr);
 	FIPv4Endpoint endpoint(addr, port_number);
 
 	self->sock = FUdpSocketBuilder(UTF8_TO_TCHAR(socket_desc)).AsNonBlocking().AsReusable().BoundToEndpoint(endpoint).WithReceiveBufferSize(buffer_size);
+	if (!self->sock)
+	{
+		PyErr_Format(PyExc_Exception, "unable to bind udp socket to %s:%d", socket_addr, port_number);
+		return -1;
+	}
+	self->buffer_size = buffer_size;
 
 	return 0;
 }
 
 void ue_python_init_fsocket(PyObject *ue_module)
 {
-	ue_PyFSocketType.tp_new = PyType_GenericNew;
+	ue_PyFSocketType.tp_new = ue_py_fsocket_new;
 
 	ue_PyFSocketType.tp_init = (initproc)ue_py_fsocket_init;
 
@@ -151,4 +554,70 @@ void ue_python_init_fsocket(PyObject *ue_module)
 
 	Py_INCREF(&ue_PyFSocketType);
 	PyModule_AddObject(ue_module, "FSocket", (PyObject *)&ue_PyFSocketType);
-}
\ No newline at end of file
+}
+
+PyObject *py_unreal_engine_tcp_listen(PyObject * self, PyObject * args)
+{
+	char *socket_desc;
+	char *socket_addr;
+	int port_number;
+	int backlog = 8;
+	int buffer_size = 65536;
+	if (!PyArg_ParseTuple(args, "ssi|ii:tcp_listen", &socket_desc, &socket_addr, &port_number, &backlog, &buffer_size))
+	{
+		return nullptr;
+	}
+
+	FIPv4Address addr;
+	if (!FIPv4Address::Parse(UTF8_TO_TCHAR(socket_addr), addr))
+	{
+		return PyErr_Format(PyExc_ValueError, "invalid address %s", socket_addr);
+	}
+	FIPv4Endpoint endpoint(addr, port_number);
+
+	FSocket *sock = FTcpSocketBuilder(UTF8_TO_TCHAR(socket_desc)).AsReusable().BoundToEndpoint(endpoint).Listening(backlog).WithReceiveBufferSize(buffer_size);
+	if (!sock)
+	{
+		return PyErr_Format(PyExc_Exception, "unable to listen on %s:%d", socket_addr, port_number);
+	}
+
+	return (PyObject *)py_ue_new_fsocket(sock, EUEPySocketKind::TcpListener, buffer_size);
+}
+
+PyObject *py_unreal_engine_tcp_connect(PyObject * self, PyObject * args)
+{
+	char *socket_desc;
+	char *socket_addr;
+	int port_number;
+	int buffer_size = 65536;
+	if (!PyArg_ParseTuple(args, "ssi|i:tcp_connect", &socket_desc, &socket_addr, &port_number, &buffer_size))
+	{
+		return nullptr;
+	}
+
+	FIPv4Address addr;
+	if (!FIPv4Address::Parse(UTF8_TO_TCHAR(socket_addr), addr))
+	{
+		return PyErr_Format(PyExc_ValueError, "invalid address %s", socket_addr);
+	}
+	TSharedRef<FInternetAddr> remote = FIPv4Endpoint(addr, port_number).ToInternetAddr();
+
+	FSocket *sock = FTcpSocketBuilder(UTF8_TO_TCHAR(socket_desc)).AsBlocking().WithReceiveBufferSize(buffer_size);
+	if (!sock)
+	{
+		return PyErr_Format(PyExc_Exception, "unable to create tcp socket");
+	}
+
+	bool connected;
+	Py_BEGIN_ALLOW_THREADS;
+	connected = sock->Connect(*remote);
+	Py_END_ALLOW_THREADS;
+
+	if (!connected)
+	{
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(sock);
+		return PyErr_Format(PyExc_Exception, "unable to connect to %s:%d", socket_addr, port_number);
+	}
+
+	return (PyObject *)py_ue_new_fsocket(sock, EUEPySocketKind::TcpConnection, buffer_size);
+}
@@ -4,17 +4,79 @@
 
 #include "Runtime/Sockets/Public/Sockets.h"
 #include "Runtime/Networking/Public/Networking.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
 
+enum class EUEPySocketKind : uint8
+{
+	Udp,
+	TcpListener,
+	TcpConnection,
+};
 
+// a received datagram (or tcp chunk) waiting for python
+struct FUEPySocketPacket
+{
+	TArray<uint8> Data;
+	FIPv4Endpoint Endpoint;
+};
+
+// queues filled by the receiver thread (the only producer) and drained by python (the GIL makes it the only consumer)
+struct FUEPySocketState
+{
+	TQueue<FUEPySocketPacket, EQueueMode::Spsc> Packets;
+	// accepted connections of a tcp listener, owned by the queue until accepted
+	TQueue<FSocket *, EQueueMode::Spsc> Connections;
+	FThreadSafeCounter Queued;
+	int32 MaxQueued;
+
+	FThreadSafeCounter64 Received;
+	FThreadSafeCounter64 ReceivedBytes;
+	FThreadSafeCounter64 Dropped;
+	// the peer closed the tcp connection (or it failed)
+	FThreadSafeCounter Disconnected;
+
+	~FUEPySocketState();
+
+	// called by the receiver thread, udp datagrams are dropped when MaxQueued is reached
+	// (the tcp receiver stops reading instead)
+	bool Enqueue(FUEPySocketPacket &&Packet);
+};
+
+typedef TSharedPtr<FUEPySocketState, ESPMode::ThreadSafe> FUEPySocketStatePtr;
+
+// receiver thread of tcp listeners and connections (udp sockets use FUdpSocketReceiver)
+class FUEPyTcpSocketReceiver : public FRunnable
+{
+public:
+	FUEPyTcpSocketReceiver(FSocket *InSocket, FUEPySocketStatePtr InState, bool bInListener, int32 InBufferSize);
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FSocket *Socket;
+	FUEPySocketStatePtr State;
+	bool bListener;
+	int32 BufferSize;
+	FThreadSafeCounter Stopping;
+};
 
 typedef struct _ue_PyFSocket {
 	PyObject_HEAD
 	/* Type-specific fields go here. */
 	FSocket *sock;
+	EUEPySocketKind kind;
 	FUdpSocketReceiver *udp_receiver;
-	void udp_recv(const FArrayReaderPtr& ArrayReaderPtr, const FIPv4Endpoint& EndPt) {
-		UE_LOG(LogPython, Warning, TEXT("DATA !!!"));
-	}
+	FUEPyTcpSocketReceiver *tcp_receiver;
+	FRunnableThread *tcp_receiver_thread;
+	FUEPySocketStatePtr state;
+	int32 buffer_size;
 } ue_PyFSocket;
 
 void ue_python_init_fsocket(PyObject *);
+
+PyObject *py_unreal_engine_tcp_listen(PyObject *, PyObject *);
+PyObject *py_unreal_engine_tcp_connect(PyObject *, PyObject *);
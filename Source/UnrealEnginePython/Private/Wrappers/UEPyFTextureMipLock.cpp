@@ -0,0 +1,408 @@
+#include "UEPyFTextureMipLock.h"
+
+#include "Misc/App.h"
+
+bool ue_py_get_pixel_format_layout(EPixelFormat pixel_format, const char *&format, Py_ssize_t &itemsize, Py_ssize_t &components)
+{
+	switch (pixel_format)
+	{
+	case PF_B8G8R8A8:
+	case PF_R8G8B8A8:
+	case PF_A8R8G8B8:
+		format = "B";
+		itemsize = 1;
+		components = 4;
+		return true;
+	case PF_G8:
+	case PF_A8:
+		format = "B";
+		itemsize = 1;
+		components = 1;
+		return true;
+	case PF_FloatRGBA:
+		format = "e";
+		itemsize = 2;
+		components = 4;
+		return true;
+	case PF_G16R16F:
+		format = "e";
+		itemsize = 2;
+		components = 2;
+		return true;
+	case PF_R16F:
+		format = "e";
+		itemsize = 2;
+		components = 1;
+		return true;
+	case PF_A32B32G32R32F:
+		format = "f";
+		itemsize = 4;
+		components = 4;
+		return true;
+	case PF_G32R32F:
+		format = "f";
+		itemsize = 4;
+		components = 2;
+		return true;
+	case PF_R32_FLOAT:
+		format = "f";
+		itemsize = 4;
+		components = 1;
+		return true;
+	case PF_A16B16G16R16:
+		format = "H";
+		itemsize = 2;
+		components = 4;
+		return true;
+	case PF_G16R16:
+		format = "H";
+		itemsize = 2;
+		components = 2;
+		return true;
+	case PF_G16:
+	case PF_R16_UINT:
+		format = "H";
+		itemsize = 2;
+		components = 1;
+		return true;
+	case PF_R16_SINT:
+		format = "h";
+		itemsize = 2;
+		components = 1;
+		return true;
+	case PF_R32_UINT:
+		format = "I";
+		itemsize = 4;
+		components = 1;
+		return true;
+	case PF_R32_SINT:
+		format = "i";
+		itemsize = 4;
+		components = 1;
+		return true;
+	default:
+		break;
+	}
+	return false;
+}
+
+static FTexture2DMipMap *ue_py_ftexture_mip_lock_get_mip(UTexture2D *tex, int mip)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	FTexturePlatformData *platform_data = tex->GetPlatformData();
+#else
+	FTexturePlatformData *platform_data = tex->PlatformData;
+#endif
+	if (!platform_data || mip < 0 || mip >= platform_data->Mips.Num())
+		return nullptr;
+	return &platform_data->Mips[mip];
+}
+
+static bool ue_py_ftexture_mip_lock_lock(ue_PyFTextureMipLock *self)
+{
+	UTexture2D *tex = (UTexture2D *)self->texture.Get();
+	if (!tex)
+	{
+		PyErr_SetString(PyExc_Exception, "texture is in invalid state");
+		return false;
+	}
+
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogPython, Warning, TEXT("FTextureMipLock: Engine Cannot Ever Render, The Result is invalid."));
+	}
+
+	if (tex->GetResource() && tex->GetResource()->IsProxy())
+	{
+		Py_BEGIN_ALLOW_THREADS;
+		tex->UpdateResource();
+		Py_END_ALLOW_THREADS;
+	}
+	if (!tex->IsAsyncCacheComplete())
+	{
+		tex->FinishCachePlatformData();
+	}
+
+	FTexture2DMipMap *mip = ue_py_ftexture_mip_lock_get_mip(tex, self->mip);
+	if (!mip)
+	{
+		PyErr_SetString(PyExc_Exception, "invalid mipmap id");
+		return false;
+	}
+
+	self->data = mip->BulkData.Lock(self->writable ? LOCK_READ_WRITE : LOCK_READ_ONLY);
+	if (!self->data)
+	{
+		mip->BulkData.Unlock();
+		PyErr_SetString(PyExc_Exception, "unable to lock texture mip");
+		return false;
+	}
+	self->len = (Py_ssize_t)mip->BulkData.GetBulkDataSize();
+
+	// uncompressed formats are exposed as (height, width[, components]) arrays, everything else as raw bytes
+	Py_ssize_t components = 0;
+	if (ue_py_get_pixel_format_layout(tex->GetPixelFormat(), self->format, self->itemsize, components) &&
+		self->len == (Py_ssize_t)mip->SizeX * mip->SizeY * components * self->itemsize)
+	{
+		self->ndim = components > 1 ? 3 : 2;
+		self->shape[0] = mip->SizeY;
+		self->shape[1] = mip->SizeX;
+		self->shape[2] = components;
+		self->strides[0] = mip->SizeX * components * self->itemsize;
+		self->strides[1] = components * self->itemsize;
+		self->strides[2] = self->itemsize;
+	}
+	else
+	{
+		self->format = "B";
+		self->itemsize = 1;
+		self->ndim = 1;
+		self->shape[0] = self->len;
+		self->strides[0] = 1;
+	}
+
+	// the bulk data must survive the GC while locked
+	FUnrealEnginePythonHouseKeeper::Get()->PinUObject(tex);
+	self->locked_texture = tex;
+	return true;
+}
+
+static void ue_py_ftexture_mip_lock_unlock(ue_PyFTextureMipLock *self)
+{
+	if (!self->data)
+		return;
+
+	self->data = nullptr;
+	self->unlock_requested = 0;
+
+	// the pin kept the texture alive even if it has been marked as garbage in the meantime
+	UTexture2D *tex = self->locked_texture;
+	self->locked_texture = nullptr;
+
+	FTexture2DMipMap *mip = ue_py_ftexture_mip_lock_get_mip(tex, self->mip);
+	if (mip)
+	{
+		mip->BulkData.Unlock();
+	}
+
+	// upload the new pixels (the GIL is not released, this runs from dealloc and tp_clear too)
+	if (mip && self->writable && IsValid(tex))
+	{
+		tex->MarkPackageDirty();
+#if WITH_EDITOR
+		tex->PostEditChange();
+#endif
+		tex->UpdateResource();
+	}
+
+	FUnrealEnginePythonHouseKeeper::Get()->UnpinUObject(tex);
+}
+
+static PyObject *py_ue_ftexture_mip_lock_enter(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	if (self->py_memoryview)
+		return PyErr_Format(PyExc_Exception, "texture mip is already locked");
+
+	if (!self->data && !ue_py_ftexture_mip_lock_lock(self))
+		return nullptr;
+
+	self->unlock_requested = 0;
+
+	self->py_memoryview = PyMemoryView_FromObject((PyObject *)self);
+	if (!self->py_memoryview)
+		return nullptr;
+
+	Py_INCREF(self->py_memoryview);
+	return self->py_memoryview;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_exit(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	if (self->py_memoryview)
+	{
+		PyObject *py_ret = PyObject_CallMethod(self->py_memoryview, (char *)"release", nullptr);
+		Py_XDECREF(py_ret);
+		// the memoryview has been exported again (numpy arrays...), it will go away with its exports
+		PyErr_Clear();
+		Py_CLEAR(self->py_memoryview);
+	}
+
+	if (self->exports > 0)
+	{
+		UE_LOG(LogPython, Warning, TEXT("FTextureMipLock: texture mip is still exported, it will be unlocked when the last export is released"));
+		self->unlock_requested = 1;
+	}
+	else
+	{
+		ue_py_ftexture_mip_lock_unlock(self);
+	}
+
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_is_locked(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	if (self->data)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyMethodDef ue_PyFTextureMipLock_methods[] = {
+	{ "__enter__", (PyCFunction)py_ue_ftexture_mip_lock_enter, METH_VARARGS, "" },
+	{ "__exit__", (PyCFunction)py_ue_ftexture_mip_lock_exit, METH_VARARGS, "" },
+	{ "lock", (PyCFunction)py_ue_ftexture_mip_lock_enter, METH_VARARGS, "" },
+	{ "unlock", (PyCFunction)py_ue_ftexture_mip_lock_exit, METH_VARARGS, "" },
+	{ "is_locked", (PyCFunction)py_ue_ftexture_mip_lock_is_locked, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFTextureMipLock_str(ue_PyFTextureMipLock *self)
+{
+	UObject *tex = self->texture.Get();
+	return PyUnicode_FromFormat("<unreal_engine.FTextureMipLock '%s' mip: %d writable: %d locked: %d>",
+		tex ? TCHAR_TO_UTF8(*tex->GetName()) : "invalid", self->mip, self->writable, self->data ? 1 : 0);
+}
+
+// the memoryview returned by __enter__ references the lock (a cycle), a lock that is never exited
+// is reclaimed (and unlocked) by the python cycle collector
+static int ue_PyFTextureMipLock_traverse(ue_PyFTextureMipLock *self, visitproc visit, void *arg)
+{
+	Py_VISIT(self->py_memoryview);
+	return 0;
+}
+
+static int ue_PyFTextureMipLock_clear(ue_PyFTextureMipLock *self)
+{
+	Py_CLEAR(self->py_memoryview);
+	return 0;
+}
+
+static void ue_PyFTextureMipLock_dealloc(ue_PyFTextureMipLock *self)
+{
+	PyObject_GC_UnTrack(self);
+	Py_CLEAR(self->py_memoryview);
+	ue_py_ftexture_mip_lock_unlock(self);
+	self->texture.~FWeakObjectPtr();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int ue_PyFTextureMipLock_getbuffer(ue_PyFTextureMipLock *self, Py_buffer *view, int flags)
+{
+	view->obj = nullptr;
+
+	if (!self->data)
+	{
+		PyErr_SetString(PyExc_BufferError, "texture mip is not locked");
+		return -1;
+	}
+
+	if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && !self->writable)
+	{
+		PyErr_SetString(PyExc_BufferError, "texture mip is locked read-only");
+		return -1;
+	}
+
+	view->buf = self->data;
+	view->obj = (PyObject *)self;
+	Py_INCREF(self);
+	view->len = self->len;
+	view->readonly = self->writable ? 0 : 1;
+	view->internal = nullptr;
+	view->suboffsets = nullptr;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->itemsize = self->itemsize;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)self->format : nullptr;
+		view->ndim = self->ndim;
+		view->shape = self->shape;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+	}
+	else
+	{
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)"B" : nullptr;
+		view->ndim = 1;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	self->exports++;
+	return 0;
+}
+
+static void ue_PyFTextureMipLock_releasebuffer(ue_PyFTextureMipLock *self, Py_buffer *view)
+{
+	if (--self->exports == 0 && self->unlock_requested)
+	{
+		ue_py_ftexture_mip_lock_unlock(self);
+	}
+}
+
+static PyTypeObject ue_PyFTextureMipLockType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FTextureMipLock", /* tp_name */
+	sizeof(ue_PyFTextureMipLock), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFTextureMipLock_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFTextureMipLock_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,        /* tp_flags */
+	"Unreal Engine Texture Mip Lock",           /* tp_doc */
+	(traverseproc)ue_PyFTextureMipLock_traverse,                         /* tp_traverse */
+	(inquiry)ue_PyFTextureMipLock_clear,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFTextureMipLock_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PyBufferProcs ue_PyFTextureMipLock_buffer_procs;
+
+void ue_python_init_ftexture_mip_lock(PyObject *ue_module)
+{
+	memset(&ue_PyFTextureMipLock_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFTextureMipLockType.tp_as_buffer = &ue_PyFTextureMipLock_buffer_procs;
+	ue_PyFTextureMipLock_buffer_procs.bf_getbuffer = (getbufferproc)ue_PyFTextureMipLock_getbuffer;
+	ue_PyFTextureMipLock_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_PyFTextureMipLock_releasebuffer;
+
+	if (PyType_Ready(&ue_PyFTextureMipLockType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFTextureMipLockType);
+	PyModule_AddObject(ue_module, "FTextureMipLock", (PyObject *)&ue_PyFTextureMipLockType);
+}
+
+PyObject *py_ue_new_ftexture_mip_lock(UTexture2D *texture, int mip, bool writable)
+{
+	ue_PyFTextureMipLock *ret = (ue_PyFTextureMipLock *)PyObject_GC_New(ue_PyFTextureMipLock, &ue_PyFTextureMipLockType);
+	new(&ret->texture) FWeakObjectPtr(texture);
+	ret->mip = mip;
+	ret->writable = writable ? 1 : 0;
+	ret->data = nullptr;
+	ret->locked_texture = nullptr;
+	ret->len = 0;
+	ret->exports = 0;
+	ret->unlock_requested = 0;
+	ret->py_memoryview = nullptr;
+	ret->format = "B";
+	ret->itemsize = 1;
+	ret->ndim = 1;
+	PyObject_GC_Track(ret);
+	return (PyObject *)ret;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#include "Engine/Texture2D.h"
+
+// context manager exposing the locked bulk data of a texture mip as a memoryview
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FWeakObjectPtr texture;
+	int mip;
+	int writable;
+	// locked memory, nullptr when the mip is not locked
+	void *data;
+	// the texture locked (and pinned) by lock(), the weak pointer could be cleared before the unlock
+	UTexture2D *locked_texture;
+	Py_ssize_t len;
+	// active exports (memoryviews, numpy arrays...)
+	int exports;
+	// __exit__ has been called while exported, unlock on the last release
+	int unlock_requested;
+	// the memoryview returned by __enter__
+	PyObject *py_memoryview;
+	const char *format;
+	Py_ssize_t itemsize;
+	int ndim;
+	Py_ssize_t shape[3];
+	Py_ssize_t strides[3];
+} ue_PyFTextureMipLock;
+
+void ue_python_init_ftexture_mip_lock(PyObject *);
+
+PyObject *py_ue_new_ftexture_mip_lock(UTexture2D *, int, bool);
+
+// struct format, component size and number of components of an uncompressed pixel format
+bool ue_py_get_pixel_format_layout(EPixelFormat, const char *&, Py_ssize_t &, Py_ssize_t &);
@@ -425,10 +425,10 @@ bool py_ue_transform_arg(PyObject *args, FTransform &t)
 		return true;
 	}
 
-	float x, y, z;
+	double x, y, z;
 	float roll, pitch, yaw;
-	float sx, sy, sz;
-	if (!PyArg_ParseTuple(args, "fffffffff", &x, &y, &z, &roll, &pitch, &yaw, &sx, &sy, &sz))
+	double sx, sy, sz;
+	if (!PyArg_ParseTuple(args, "dddfffddd", &x, &y, &z, &roll, &pitch, &yaw, &sx, &sy, &sz))
 		return false;
 
 	t.SetLocation(FVector(x, y, z));
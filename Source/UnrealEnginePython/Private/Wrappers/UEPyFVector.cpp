@@ -320,8 +320,9 @@ PySequenceMethods ue_PyFVector_sequence_methods;
 
 static int ue_py_fvector_init(ue_PyFVector *self, PyObject *args, PyObject *kwargs)
 {
-	float x = 0, y = 0, z = 0;
-	if (!PyArg_ParseTuple(args, "|fff", &x, &y, &z))
+	// doubles, components are not truncated on UE5 (large world coordinates)
+	double x = 0, y = 0, z = 0;
+	if (!PyArg_ParseTuple(args, "|ddd", &x, &y, &z))
 		return -1;
 
 	if (PyTuple_Size(args) == 1)
@@ -430,8 +431,8 @@ bool py_ue_vector_arg(PyObject *args, FVector &vec)
 		return true;
 	}
 
-	float x, y, z;
-	if (!PyArg_ParseTuple(args, "fff", &x, &y, &z))
+	double x, y, z;
+	if (!PyArg_ParseTuple(args, "ddd", &x, &y, &z))
 		return false;
 	vec.X = x;
 	vec.Y = y;
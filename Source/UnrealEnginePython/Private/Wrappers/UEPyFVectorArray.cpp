@@ -0,0 +1,1100 @@
+#include "UEPyFVectorArray.h"
+
+#include "Wrappers/UEPyFPropertyArrayView.h"
+
+static_assert(sizeof(FVector) == 3 * sizeof(ue_py_real), "FVector rows must match the FVector memory layout");
+static_assert(sizeof(FQuat) == 4 * sizeof(ue_py_real), "FQuat rows must match the FQuat memory layout");
+
+// struct format of the components
+static const char *ue_py_math_array_format = sizeof(ue_py_real) == sizeof(double) ? "d" : "f";
+
+static int32 ue_py_math_array_num(ue_PyFMathArray *self)
+{
+	return self->data.Num() / self->components;
+}
+
+static int32 ue_py_math_array_type_components(PyTypeObject *type)
+{
+	if (type == &ue_PyFQuatArrayType)
+		return 4;
+	if (type == &ue_PyFTransformArrayType)
+		return 10;
+	return 3;
+}
+
+static const char *ue_py_math_array_item_name(int32 components)
+{
+	if (components == 4)
+		return "FQuat";
+	if (components == 10)
+		return "FTransform";
+	return "FVector";
+}
+
+// zero vectors, identity rotations and transforms
+static void ue_py_math_array_init_rows(ue_PyFMathArray *self, int32 first)
+{
+	int32 num = ue_py_math_array_num(self);
+	if (first >= num)
+		return;
+	ue_py_real *data = self->data.GetData();
+	FMemory::Memzero(data + (first * self->components), (num - first) * self->components * sizeof(ue_py_real));
+	if (self->components == 3)
+		return;
+
+	for (int32 i = first; i < num; i++)
+	{
+		ue_py_real *row = data + (i * self->components);
+		if (self->components == 4)
+		{
+			row[3] = 1;
+		}
+		else
+		{
+			row[6] = 1;
+			row[7] = 1; row[8] = 1; row[9] = 1;
+		}
+	}
+}
+
+static void ue_py_transform_to_row(const FTransform &transform, ue_py_real *row)
+{
+	FVector location = transform.GetLocation();
+	FQuat quat = transform.GetRotation();
+	FVector scale = transform.GetScale3D();
+	row[0] = location.X; row[1] = location.Y; row[2] = location.Z;
+	row[3] = quat.X; row[4] = quat.Y; row[5] = quat.Z; row[6] = quat.W;
+	row[7] = scale.X; row[8] = scale.Y; row[9] = scale.Z;
+}
+
+static FTransform ue_py_row_to_transform(const ue_py_real *row)
+{
+	return FTransform(FQuat(row[3], row[4], row[5], row[6]), FVector(row[0], row[1], row[2]), FVector(row[7], row[8], row[9]));
+}
+
+// a scalar wrapper (or a sequence of numbers) to a row
+static bool ue_py_math_array_read_item(int32 components, PyObject *py_item, ue_py_real *row)
+{
+	if (components == 3)
+	{
+		if (ue_PyFVector *py_vec = py_ue_is_fvector(py_item))
+		{
+			row[0] = py_vec->vec.X; row[1] = py_vec->vec.Y; row[2] = py_vec->vec.Z;
+			return true;
+		}
+	}
+	else if (components == 4)
+	{
+		if (ue_PyFQuat *py_quat = py_ue_is_fquat(py_item))
+		{
+			row[0] = py_quat->quat.X; row[1] = py_quat->quat.Y; row[2] = py_quat->quat.Z; row[3] = py_quat->quat.W;
+			return true;
+		}
+	}
+	else if (ue_PyFTransform *py_transform = py_ue_is_ftransform(py_item))
+	{
+		ue_py_transform_to_row(py_transform->transform, row);
+		return true;
+	}
+
+	if (!PySequence_Check(py_item) || PySequence_Size(py_item) != components)
+	{
+		PyErr_Clear();
+		PyErr_Format(PyExc_TypeError, "item is not a %s or a sequence of %d numbers", ue_py_math_array_item_name(components), components);
+		return false;
+	}
+
+	PyObject *py_sequence = PySequence_Fast(py_item, "item is not a sequence");
+	if (!py_sequence)
+		return false;
+	PyObject **py_numbers = PySequence_Fast_ITEMS(py_sequence);
+	for (int32 i = 0; i < components; i++)
+	{
+		row[i] = PyFloat_AsDouble(py_numbers[i]);
+	}
+	Py_DECREF(py_sequence);
+	return !PyErr_Occurred();
+}
+
+static PyObject *ue_py_math_array_new_item(int32 components, const ue_py_real *row)
+{
+	if (components == 3)
+		return py_ue_new_fvector(FVector(row[0], row[1], row[2]));
+	if (components == 4)
+		return py_ue_new_fquat(FQuat(row[0], row[1], row[2], row[3]));
+	return py_ue_new_ftransform(ue_py_row_to_transform(row));
+}
+
+static PyObject *ue_py_math_array_new(PyTypeObject *type, int32 num)
+{
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)PyObject_New(ue_PyFMathArray, type);
+	new(&ret->data) TArray<ue_py_real>();
+	ret->components = ue_py_math_array_type_components(type);
+	ret->exports = 0;
+	ret->data.SetNumUninitialized(num * ret->components);
+	ue_py_math_array_init_rows(ret, 0);
+	return (PyObject *)ret;
+}
+
+// the other operand of an elementwise op, an array of the same size or a single item used for every row
+struct FUEPyMathArrayOperand
+{
+	const ue_py_real *Data;
+	int32 Stride;
+	ue_py_real Item[10];
+
+	const ue_py_real *Row(int32 Index) const
+	{
+		return Stride ? Data + (Index * Stride) : Item;
+	}
+};
+
+static bool ue_py_math_array_operand(ue_PyFMathArray *self, PyObject *py_other, PyTypeObject *type, FUEPyMathArrayOperand &operand)
+{
+	int32 components = ue_py_math_array_type_components(type);
+	if (PyObject_IsInstance(py_other, (PyObject *)type))
+	{
+		ue_PyFMathArray *py_array = (ue_PyFMathArray *)py_other;
+		if (ue_py_math_array_num(py_array) != ue_py_math_array_num(self))
+		{
+			PyErr_Format(PyExc_ValueError, "arrays have different sizes (%d and %d)", ue_py_math_array_num(self), ue_py_math_array_num(py_array));
+			return false;
+		}
+		operand.Data = py_array->data.GetData();
+		operand.Stride = components;
+		return true;
+	}
+
+	operand.Data = nullptr;
+	operand.Stride = 0;
+	return ue_py_math_array_read_item(components, py_other, operand.Item);
+}
+
+// one buffer of num reals (returned by dot)
+static PyObject *ue_py_math_array_new_scalars(int32 num, ue_py_real *&data)
+{
+	PyObject *py_bytes = PyBytes_FromStringAndSize(nullptr, num * sizeof(ue_py_real));
+	if (!py_bytes)
+		return nullptr;
+	data = (ue_py_real *)PyBytes_AsString(py_bytes);
+	return py_bytes;
+}
+
+static PyObject *ue_py_math_array_scalars_to_memoryview(PyObject *py_bytes)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_memoryview = PyMemoryView_FromObject(py_bytes);
+	Py_DECREF(py_bytes);
+	if (!py_memoryview)
+		return nullptr;
+	PyObject *py_typed = PyObject_CallMethod(py_memoryview, (char *)"cast", (char *)"s", ue_py_math_array_format);
+	Py_DECREF(py_memoryview);
+	return py_typed;
+#else
+	return py_bytes;
+#endif
+}
+
+static bool ue_py_math_array_load_buffer(ue_PyFMathArray *self, PyObject *py_obj)
+{
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return false;
+
+	const char *format = py_buf.format ? py_buf.format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+
+	// raw bytes are taken as native components
+	char kind = ue_py_math_array_format[0];
+	if (strcmp(format, "B") && strcmp(format, "b") && strcmp(format, "c"))
+	{
+		if ((!strcmp(format, "d") && py_buf.itemsize == sizeof(double)) || (!strcmp(format, "f") && py_buf.itemsize == sizeof(float)))
+		{
+			kind = format[0];
+		}
+		else
+		{
+			PyErr_Format(PyExc_ValueError, "unsupported buffer format '%s', 'f' or 'd' items are expected", format);
+			PyBuffer_Release(&py_buf);
+			return false;
+		}
+	}
+
+	Py_ssize_t itemsize = kind == 'd' ? sizeof(double) : sizeof(float);
+	Py_ssize_t row_size = itemsize * self->components;
+	if (py_buf.len % row_size != 0)
+	{
+		PyErr_Format(PyExc_ValueError, "buffer size (%d) is not a multiple of %d components", (int)py_buf.len, self->components);
+		PyBuffer_Release(&py_buf);
+		return false;
+	}
+
+	int32 num = py_buf.len / itemsize;
+	self->data.SetNumUninitialized(num);
+	if (itemsize == sizeof(ue_py_real))
+	{
+		FMemory::Memcpy(self->data.GetData(), py_buf.buf, py_buf.len);
+	}
+	else if (kind == 'd')
+	{
+		const double *values = (const double *)py_buf.buf;
+		for (int32 i = 0; i < num; i++)
+			self->data[i] = values[i];
+	}
+	else
+	{
+		const float *values = (const float *)py_buf.buf;
+		for (int32 i = 0; i < num; i++)
+			self->data[i] = values[i];
+	}
+
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+static bool ue_py_math_array_can_resize(ue_PyFMathArray *self)
+{
+	if (self->exports > 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "existing exports of data: array cannot be resized");
+		return false;
+	}
+	return true;
+}
+
+static PyObject *py_ue_fmath_array_append(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_item;
+	if (!PyArg_ParseTuple(args, "O:append", &py_item))
+		return nullptr;
+
+	ue_py_real row[10];
+	if (!ue_py_math_array_read_item(self->components, py_item, row))
+		return nullptr;
+
+	if (!ue_py_math_array_can_resize(self))
+		return nullptr;
+
+	self->data.Append(row, self->components);
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmath_array_resize(ue_PyFMathArray *self, PyObject * args)
+{
+	int num;
+	if (!PyArg_ParseTuple(args, "i:resize", &num))
+		return nullptr;
+
+	if (num < 0)
+		return PyErr_Format(PyExc_ValueError, "invalid array size");
+
+	if (!ue_py_math_array_can_resize(self))
+		return nullptr;
+
+	int32 old_num = ue_py_math_array_num(self);
+	self->data.SetNumUninitialized(num * self->components);
+	ue_py_math_array_init_rows(self, old_num);
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fmath_array_copy(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(Py_TYPE(self), 0);
+	ret->data = self->data;
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fmath_array_to_list(ue_PyFMathArray *self, PyObject * args)
+{
+	int32 num = ue_py_math_array_num(self);
+	PyObject *py_list = PyList_New(num);
+	for (int32 i = 0; i < num; i++)
+	{
+		PyList_SET_ITEM(py_list, i, ue_py_math_array_new_item(self->components, self->data.GetData() + (i * self->components)));
+	}
+	return py_list;
+}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+// TArray<FVector>, TArray<FQuat> or TArray<FTransform> property of the object
+static FArrayProperty *ue_py_math_array_find_property(UObject *u_object, char *property_name, int32 components)
+{
+	FProperty *f_property = u_object->GetClass()->FindPropertyByName(FName(UTF8_TO_TCHAR(property_name)));
+	if (!f_property)
+	{
+		PyErr_Format(PyExc_Exception, "unable to find property %s", property_name);
+		return nullptr;
+	}
+
+	UScriptStruct *u_struct = TBaseStructure<FVector>::Get();
+	if (components == 4)
+		u_struct = TBaseStructure<FQuat>::Get();
+	else if (components == 10)
+		u_struct = TBaseStructure<FTransform>::Get();
+
+	FArrayProperty *prop = CastField<FArrayProperty>(f_property);
+	FStructProperty *inner = prop ? CastField<FStructProperty>(prop->Inner) : nullptr;
+	if (!inner || inner->Struct != u_struct)
+	{
+		PyErr_Format(PyExc_TypeError, "property %s is not an array of %s", property_name, ue_py_math_array_item_name(components));
+		return nullptr;
+	}
+	return prop;
+}
+#endif
+
+static PyObject *py_ue_fmath_array_from_property(PyObject *cls, PyObject * args)
+{
+	PyObject *py_object;
+	char *property_name;
+	if (!PyArg_ParseTuple(args, "Os:from_property", &py_object, &property_name))
+		return nullptr;
+
+	ue_PyUObject *py_uobject = ue_is_pyuobject(py_object);
+	if (!py_uobject)
+		return PyErr_Format(PyExc_TypeError, "argument is not a UObject");
+	ue_py_check(py_uobject);
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	PyTypeObject *type = (PyTypeObject *)cls;
+	int32 components = ue_py_math_array_type_components(type);
+	FArrayProperty *prop = ue_py_math_array_find_property(py_uobject->ue_object, property_name, components);
+	if (!prop)
+		return nullptr;
+
+	FScriptArrayHelper_InContainer helper(prop, py_uobject->ue_object);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(type, helper.Num());
+	if (helper.Num() == 0)
+		return (PyObject *)ret;
+
+	if (components == 10)
+	{
+		for (int32 i = 0; i < helper.Num(); i++)
+		{
+			ue_py_transform_to_row(*(FTransform *)helper.GetRawPtr(i), ret->data.GetData() + (i * 10));
+		}
+	}
+	else
+	{
+		FMemory::Memcpy(ret->data.GetData(), helper.GetRawPtr(), ret->data.Num() * sizeof(ue_py_real));
+	}
+	return (PyObject *)ret;
+#else
+	return PyErr_Format(PyExc_Exception, "property conversions require FProperty support (Unreal Engine 4.25+)");
+#endif
+}
+
+static PyObject *py_ue_fmath_array_to_property(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_object;
+	char *property_name;
+	if (!PyArg_ParseTuple(args, "Os:to_property", &py_object, &property_name))
+		return nullptr;
+
+	ue_PyUObject *py_uobject = ue_is_pyuobject(py_object);
+	if (!py_uobject)
+		return PyErr_Format(PyExc_TypeError, "argument is not a UObject");
+	ue_py_check(py_uobject);
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FArrayProperty *prop = ue_py_math_array_find_property(py_uobject->ue_object, property_name, self->components);
+	if (!prop)
+		return nullptr;
+
+	if (ue_py_fpropertyarrayview_is_exported(py_uobject->ue_object, prop))
+		return PyErr_Format(PyExc_BufferError, "property %s is exported by an array view", property_name);
+
+	int32 num = ue_py_math_array_num(self);
+	FScriptArrayHelper_InContainer helper(prop, py_uobject->ue_object);
+	helper.Resize(num);
+	if (num == 0)
+		Py_RETURN_NONE;
+
+	if (self->components == 10)
+	{
+		for (int32 i = 0; i < num; i++)
+		{
+			*(FTransform *)helper.GetRawPtr(i) = ue_py_row_to_transform(self->data.GetData() + (i * 10));
+		}
+	}
+	else
+	{
+		FMemory::Memcpy(helper.GetRawPtr(), self->data.GetData(), self->data.Num() * sizeof(ue_py_real));
+	}
+	Py_RETURN_NONE;
+#else
+	return PyErr_Format(PyExc_Exception, "property conversions require FProperty support (Unreal Engine 4.25+)");
+#endif
+}
+
+// elementwise ops, every row is loaded in a vector register (w is 0 for FVector rows)
+
+static PyObject *ue_py_fvector_array_add_sub(ue_PyFMathArray *self, PyObject *py_other, bool subtract)
+{
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFVectorArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFVectorArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		ue_py_vector_register a = VectorLoadFloat3(data + (i * 3));
+		ue_py_vector_register b = VectorLoadFloat3(operand.Row(i));
+		VectorStoreFloat3(subtract ? VectorSubtract(a, b) : VectorAdd(a, b), out + (i * 3));
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fvector_array_add(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:add", &py_other))
+		return nullptr;
+	return ue_py_fvector_array_add_sub(self, py_other, false);
+}
+
+static PyObject *py_ue_fvector_array_sub(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:sub", &py_other))
+		return nullptr;
+	return ue_py_fvector_array_add_sub(self, py_other, true);
+}
+
+static PyObject *py_ue_fvector_array_dot(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:dot", &py_other))
+		return nullptr;
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFVectorArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_py_real *out = nullptr;
+	PyObject *py_bytes = ue_py_math_array_new_scalars(num, out);
+	if (!py_bytes)
+		return nullptr;
+
+	const ue_py_real *data = self->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorStoreFloat1(VectorDot3(VectorLoadFloat3(data + (i * 3)), VectorLoadFloat3(operand.Row(i))), out + i);
+	}
+	return ue_py_math_array_scalars_to_memoryview(py_bytes);
+}
+
+static PyObject *py_ue_fvector_array_cross(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:cross", &py_other))
+		return nullptr;
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFVectorArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFVectorArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorStoreFloat3(VectorCross(VectorLoadFloat3(data + (i * 3)), VectorLoadFloat3(operand.Row(i))), out + (i * 3));
+	}
+	return (PyObject *)ret;
+}
+
+// zero vectors are left as they are
+static void ue_py_fvector_array_normalize_rows(const ue_py_real *data, ue_py_real *out, int32 num)
+{
+	const ue_py_vector_register zero = MakeVectorRegister((ue_py_real)0, (ue_py_real)0, (ue_py_real)0, (ue_py_real)0);
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorStoreFloat3(VectorNormalizeSafe(VectorLoadFloat3(data + (i * 3)), zero), out + (i * 3));
+	}
+}
+
+static PyObject *py_ue_fvector_array_normalize(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_py_fvector_array_normalize_rows(self->data.GetData(), self->data.GetData(), ue_py_math_array_num(self));
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fvector_array_normalized(ue_PyFMathArray *self, PyObject * args)
+{
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFVectorArrayType, num);
+	ue_py_fvector_array_normalize_rows(self->data.GetData(), ret->data.GetData(), num);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fvector_array_transform_by(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	PyObject *py_position = nullptr;
+	if (!PyArg_ParseTuple(args, "O|O:transform_by", &py_other, &py_position))
+		return nullptr;
+
+	// directions (position=False) ignore the translation
+	bool position = !py_position || PyObject_IsTrue(py_position);
+
+	// rotations only
+	bool rotate = PyObject_IsInstance(py_other, (PyObject *)&ue_PyFQuatArrayType) || py_ue_is_fquat(py_other);
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, rotate ? &ue_PyFQuatArrayType : &ue_PyFTransformArrayType, operand))
+	{
+		PyErr_Clear();
+		return PyErr_Format(PyExc_TypeError, "argument is not a FTransform, a FQuat or an array of them with the same size");
+	}
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFVectorArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		const ue_py_real *row = operand.Row(i);
+		ue_py_vector_register v = VectorLoadFloat3(data + (i * 3));
+		if (rotate)
+		{
+			v = VectorQuaternionRotateVector(VectorLoad(row), v);
+		}
+		else
+		{
+			v = VectorQuaternionRotateVector(VectorLoad(row + 3), VectorMultiply(VectorLoadFloat3(row + 7), v));
+			if (position)
+				v = VectorAdd(v, VectorLoadFloat3(row));
+		}
+		VectorStoreFloat3(v, out + (i * 3));
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fquat_array_compose(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:compose", &py_other))
+		return nullptr;
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFQuatArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFQuatArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		// same as FQuat * FQuat, the other rotation is applied first
+		VectorStore(VectorQuaternionMultiply2(VectorLoad(data + (i * 4)), VectorLoad(operand.Row(i))), out + (i * 4));
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fquat_array_slerp(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	double alpha;
+	if (!PyArg_ParseTuple(args, "Od:slerp", &py_other, &alpha))
+		return nullptr;
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFQuatArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFQuatArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		ue_py_vector_register a = VectorLoad(data + (i * 4));
+		ue_py_vector_register b = VectorLoad(operand.Row(i));
+
+		// the weights of FQuat::Slerp, the shortest path is taken
+		ue_py_real raw_cosom;
+		VectorStoreFloat1(VectorDot4(a, b), &raw_cosom);
+		ue_py_real cosom = FMath::Abs(raw_cosom);
+		ue_py_real scale0, scale1;
+		if (cosom < 0.9999f)
+		{
+			const ue_py_real omega = FMath::Acos(cosom);
+			const ue_py_real inv_sin = 1.f / FMath::Sin(omega);
+			scale0 = FMath::Sin((1.f - alpha) * omega) * inv_sin;
+			scale1 = FMath::Sin(alpha * omega) * inv_sin;
+		}
+		else
+		{
+			// nearly identical rotations, linear interpolation
+			scale0 = 1.f - alpha;
+			scale1 = alpha;
+		}
+		if (raw_cosom < 0)
+			scale1 = -scale1;
+
+		ue_py_vector_register q = VectorMultiplyAdd(a, MakeVectorRegister(scale0, scale0, scale0, scale0), VectorMultiply(b, MakeVectorRegister(scale1, scale1, scale1, scale1)));
+		VectorStore(VectorNormalizeQuaternion(q), out + (i * 4));
+	}
+	return (PyObject *)ret;
+}
+
+// zero quaternions become the identity
+static void ue_py_fquat_array_normalize_rows(const ue_py_real *data, ue_py_real *out, int32 num)
+{
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorStore(VectorNormalizeQuaternion(VectorLoad(data + (i * 4))), out + (i * 4));
+	}
+}
+
+static PyObject *py_ue_fquat_array_normalize(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_py_fquat_array_normalize_rows(self->data.GetData(), self->data.GetData(), ue_py_math_array_num(self));
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fquat_array_normalized(ue_PyFMathArray *self, PyObject * args)
+{
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFQuatArrayType, num);
+	ue_py_fquat_array_normalize_rows(self->data.GetData(), ret->data.GetData(), num);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_compose(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_other;
+	if (!PyArg_ParseTuple(args, "O:compose", &py_other))
+		return nullptr;
+
+	FUEPyMathArrayOperand operand;
+	if (!ue_py_math_array_operand(self, py_other, &ue_PyFTransformArrayType, operand))
+		return nullptr;
+
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFTransformArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		// FTransform multiplication is vectorized (and handles negative scales)
+		ue_py_transform_to_row(ue_py_row_to_transform(data + (i * 10)) * ue_py_row_to_transform(operand.Row(i)), out + (i * 10));
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_inverse(ue_PyFMathArray *self, PyObject * args)
+{
+	int32 num = ue_py_math_array_num(self);
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)ue_py_math_array_new(&ue_PyFTransformArrayType, num);
+	const ue_py_real *data = self->data.GetData();
+	ue_py_real *out = ret->data.GetData();
+	for (int32 i = 0; i < num; i++)
+	{
+		ue_py_transform_to_row(ue_py_row_to_transform(data + (i * 10)).Inverse(), out + (i * 10));
+	}
+	return (PyObject *)ret;
+}
+
+static PyMethodDef ue_PyFVectorArray_methods[] = {
+	{ "append", (PyCFunction)py_ue_fmath_array_append, METH_VARARGS, "" },
+	{ "resize", (PyCFunction)py_ue_fmath_array_resize, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_fmath_array_to_list, METH_VARARGS, "" },
+	{ "from_property", (PyCFunction)py_ue_fmath_array_from_property, METH_VARARGS | METH_CLASS, "" },
+	{ "to_property", (PyCFunction)py_ue_fmath_array_to_property, METH_VARARGS, "" },
+	{ "add", (PyCFunction)py_ue_fvector_array_add, METH_VARARGS, "" },
+	{ "sub", (PyCFunction)py_ue_fvector_array_sub, METH_VARARGS, "" },
+	{ "dot", (PyCFunction)py_ue_fvector_array_dot, METH_VARARGS, "" },
+	{ "cross", (PyCFunction)py_ue_fvector_array_cross, METH_VARARGS, "" },
+	{ "normalize", (PyCFunction)py_ue_fvector_array_normalize, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_fvector_array_normalized, METH_VARARGS, "" },
+	{ "transform_by", (PyCFunction)py_ue_fvector_array_transform_by, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyMethodDef ue_PyFQuatArray_methods[] = {
+	{ "append", (PyCFunction)py_ue_fmath_array_append, METH_VARARGS, "" },
+	{ "resize", (PyCFunction)py_ue_fmath_array_resize, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_fmath_array_to_list, METH_VARARGS, "" },
+	{ "from_property", (PyCFunction)py_ue_fmath_array_from_property, METH_VARARGS | METH_CLASS, "" },
+	{ "to_property", (PyCFunction)py_ue_fmath_array_to_property, METH_VARARGS, "" },
+	{ "compose", (PyCFunction)py_ue_fquat_array_compose, METH_VARARGS, "" },
+	{ "slerp", (PyCFunction)py_ue_fquat_array_slerp, METH_VARARGS, "" },
+	{ "normalize", (PyCFunction)py_ue_fquat_array_normalize, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_fquat_array_normalized, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyMethodDef ue_PyFTransformArray_methods[] = {
+	{ "append", (PyCFunction)py_ue_fmath_array_append, METH_VARARGS, "" },
+	{ "resize", (PyCFunction)py_ue_fmath_array_resize, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_fmath_array_to_list, METH_VARARGS, "" },
+	{ "from_property", (PyCFunction)py_ue_fmath_array_from_property, METH_VARARGS | METH_CLASS, "" },
+	{ "to_property", (PyCFunction)py_ue_fmath_array_to_property, METH_VARARGS, "" },
+	{ "compose", (PyCFunction)py_ue_ftransform_array_compose, METH_VARARGS, "" },
+	{ "inverse", (PyCFunction)py_ue_ftransform_array_inverse, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFMathArray_str(ue_PyFMathArray *self)
+{
+	return PyUnicode_FromFormat("<%s num: %d format: '%s'>",
+		Py_TYPE(self)->tp_name, ue_py_math_array_num(self), ue_py_math_array_format);
+}
+
+static void ue_PyFMathArray_dealloc(ue_PyFMathArray *self)
+{
+	self->data.~TArray<ue_py_real>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_PyFMathArray_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	ue_PyFMathArray *self = (ue_PyFMathArray *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		new(&self->data) TArray<ue_py_real>();
+		self->components = ue_py_math_array_type_components(type);
+		self->exports = 0;
+	}
+	return (PyObject *)self;
+}
+
+// an array can be built from a number of (zeroed/identity) items, a sequence of items or a buffer of floats/doubles
+static int ue_PyFMathArray_init(ue_PyFMathArray *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_items = nullptr;
+	if (!PyArg_ParseTuple(args, "|O", &py_items))
+		return -1;
+
+	if (!ue_py_math_array_can_resize(self))
+		return -1;
+
+	self->data.Reset();
+	if (!py_items || py_items == Py_None)
+		return 0;
+
+	if (PyNumber_Check(py_items) && !PySequence_Check(py_items) && !PyObject_CheckBuffer(py_items))
+	{
+		PyObject *py_num = PyNumber_Long(py_items);
+		if (!py_num)
+			return -1;
+		long num = PyLong_AsLong(py_num);
+		Py_DECREF(py_num);
+		if (num < 0)
+		{
+			PyErr_SetString(PyExc_ValueError, "invalid array size");
+			return -1;
+		}
+		self->data.SetNumUninitialized(num * self->components);
+		ue_py_math_array_init_rows(self, 0);
+		return 0;
+	}
+
+	if (PyObject_CheckBuffer(py_items))
+	{
+		return ue_py_math_array_load_buffer(self, py_items) ? 0 : -1;
+	}
+
+	PyObject *py_sequence = PySequence_Fast(py_items, "argument is not a number, a sequence or a buffer");
+	if (!py_sequence)
+		return -1;
+
+	Py_ssize_t num = PySequence_Fast_GET_SIZE(py_sequence);
+	PyObject **py_sequence_items = PySequence_Fast_ITEMS(py_sequence);
+	self->data.SetNumUninitialized(num * self->components);
+	for (Py_ssize_t i = 0; i < num; i++)
+	{
+		if (!ue_py_math_array_read_item(self->components, py_sequence_items[i], self->data.GetData() + (i * self->components)))
+		{
+			self->data.Reset();
+			Py_DECREF(py_sequence);
+			return -1;
+		}
+	}
+	Py_DECREF(py_sequence);
+	return 0;
+}
+
+static Py_ssize_t ue_PyFMathArray_len(ue_PyFMathArray *self)
+{
+	return ue_py_math_array_num(self);
+}
+
+static PyObject *ue_PyFMathArray_item(ue_PyFMathArray *self, Py_ssize_t index)
+{
+	if (index < 0 || index >= ue_py_math_array_num(self))
+		return PyErr_Format(PyExc_IndexError, "array index out of range");
+	return ue_py_math_array_new_item(self->components, self->data.GetData() + (index * self->components));
+}
+
+static int ue_PyFMathArray_ass_item(ue_PyFMathArray *self, Py_ssize_t index, PyObject *value)
+{
+	if (!value)
+	{
+		PyErr_SetString(PyExc_TypeError, "array items cannot be deleted");
+		return -1;
+	}
+	if (index < 0 || index >= ue_py_math_array_num(self))
+	{
+		PyErr_SetString(PyExc_IndexError, "array index out of range");
+		return -1;
+	}
+	return ue_py_math_array_read_item(self->components, value, self->data.GetData() + (index * self->components)) ? 0 : -1;
+}
+
+static int ue_PyFMathArray_getbuffer(ue_PyFMathArray *self, Py_buffer *view, int flags)
+{
+	int32 num = ue_py_math_array_num(self);
+
+	self->shape[0] = num;
+	self->shape[1] = self->components;
+	self->strides[0] = self->components * sizeof(ue_py_real);
+	self->strides[1] = sizeof(ue_py_real);
+
+	// buf cannot be NULL, even for empty arrays
+	static char empty_buffer = 0;
+
+	view->buf = num > 0 ? (void *)self->data.GetData() : &empty_buffer;
+	view->obj = (PyObject *)self;
+	Py_INCREF(self);
+	view->len = self->data.Num() * sizeof(ue_py_real);
+	view->readonly = 0;
+	view->internal = nullptr;
+	view->suboffsets = nullptr;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->itemsize = sizeof(ue_py_real);
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)ue_py_math_array_format : nullptr;
+		view->ndim = 2;
+		view->shape = self->shape;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+	}
+	else
+	{
+		// simple request, raw bytes
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)"B" : nullptr;
+		view->ndim = 1;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	self->exports++;
+	return 0;
+}
+
+static void ue_PyFMathArray_releasebuffer(ue_PyFMathArray *self, Py_buffer *view)
+{
+	self->exports--;
+}
+
+static PyObject *ue_py_fvector_array_nb_add(PyObject *a, PyObject *b)
+{
+	ue_PyFMathArray *self = py_ue_is_fvector_array(a);
+	// reflected operation (e.g. FVector + FVectorArray), let python try the other operand
+	if (!self)
+	{
+		Py_INCREF(Py_NotImplemented);
+		return Py_NotImplemented;
+	}
+	return ue_py_fvector_array_add_sub(self, b, false);
+}
+
+static PyObject *ue_py_fvector_array_nb_sub(PyObject *a, PyObject *b)
+{
+	ue_PyFMathArray *self = py_ue_is_fvector_array(a);
+	// reflected operation (e.g. FVector - FVectorArray), let python try the other operand
+	if (!self)
+	{
+		Py_INCREF(Py_NotImplemented);
+		return Py_NotImplemented;
+	}
+	return ue_py_fvector_array_add_sub(self, b, true);
+}
+
+PyTypeObject ue_PyFVectorArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FVectorArray", /* tp_name */
+	sizeof(ue_PyFMathArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFMathArray_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFMathArray_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine contiguous array of FVector",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFVectorArray_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PyTypeObject ue_PyFQuatArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FQuatArray", /* tp_name */
+	sizeof(ue_PyFMathArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFMathArray_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFMathArray_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine contiguous array of FQuat",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFQuatArray_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PyTypeObject ue_PyFTransformArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FTransformArray", /* tp_name */
+	sizeof(ue_PyFMathArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyFMathArray_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFMathArray_str,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine contiguous array of FTransform",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFTransformArray_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+PySequenceMethods ue_PyFMathArray_sequence_methods;
+PyBufferProcs ue_PyFMathArray_buffer_procs;
+PyNumberMethods ue_PyFVectorArray_number_methods;
+
+static void ue_python_init_fmath_array_type(PyObject *ue_module, PyTypeObject *type, const char *name)
+{
+	type->tp_new = ue_PyFMathArray_new;
+	type->tp_init = (initproc)ue_PyFMathArray_init;
+	type->tp_as_sequence = &ue_PyFMathArray_sequence_methods;
+	type->tp_as_buffer = &ue_PyFMathArray_buffer_procs;
+
+	if (PyType_Ready(type) < 0)
+		return;
+
+	Py_INCREF(type);
+	PyModule_AddObject(ue_module, name, (PyObject *)type);
+}
+
+void ue_python_init_fvector_array(PyObject *ue_module)
+{
+	memset(&ue_PyFMathArray_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFMathArray_sequence_methods.sq_length = (lenfunc)ue_PyFMathArray_len;
+	ue_PyFMathArray_sequence_methods.sq_item = (ssizeargfunc)ue_PyFMathArray_item;
+	ue_PyFMathArray_sequence_methods.sq_ass_item = (ssizeobjargproc)ue_PyFMathArray_ass_item;
+
+	memset(&ue_PyFMathArray_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFMathArray_buffer_procs.bf_getbuffer = (getbufferproc)ue_PyFMathArray_getbuffer;
+	ue_PyFMathArray_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_PyFMathArray_releasebuffer;
+
+	memset(&ue_PyFVectorArray_number_methods, 0, sizeof(PyNumberMethods));
+	ue_PyFVectorArrayType.tp_as_number = &ue_PyFVectorArray_number_methods;
+	ue_PyFVectorArray_number_methods.nb_add = (binaryfunc)ue_py_fvector_array_nb_add;
+	ue_PyFVectorArray_number_methods.nb_subtract = (binaryfunc)ue_py_fvector_array_nb_sub;
+
+	ue_python_init_fmath_array_type(ue_module, &ue_PyFVectorArrayType, "FVectorArray");
+	ue_python_init_fmath_array_type(ue_module, &ue_PyFQuatArrayType, "FQuatArray");
+	ue_python_init_fmath_array_type(ue_module, &ue_PyFTransformArrayType, "FTransformArray");
+}
+
+PyObject *py_ue_new_fvector_array(int32 num)
+{
+	return ue_py_math_array_new(&ue_PyFVectorArrayType, num);
+}
+
+PyObject *py_ue_new_fquat_array(int32 num)
+{
+	return ue_py_math_array_new(&ue_PyFQuatArrayType, num);
+}
+
+PyObject *py_ue_new_ftransform_array(int32 num)
+{
+	return ue_py_math_array_new(&ue_PyFTransformArrayType, num);
+}
+
+ue_PyFMathArray *py_ue_is_fvector_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFVectorArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
+
+ue_PyFMathArray *py_ue_is_fquat_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFQuatArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
+
+ue_PyFMathArray *py_ue_is_ftransform_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFTransformArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#include "Runtime/Core/Public/Math/VectorRegister.h"
+
+// component type of the engine math structs (doubles with UE5 large world coordinates)
+#if ENGINE_MAJOR_VERSION == 5
+typedef FVector::FReal ue_py_real;
+typedef TVectorRegisterType<FVector::FReal> ue_py_vector_register;
+#else
+typedef float ue_py_real;
+typedef VectorRegister ue_py_vector_register;
+#endif
+
+// contiguous rows of components, shared by FVectorArray (x, y, z), FQuatArray (x, y, z, w)
+// and FTransformArray (location, rotation, scale: the layout of get_actor_transforms)
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<ue_py_real> data;
+	int32 components;
+	// active exports (memoryviews, numpy arrays...), the array cannot be resized while exported
+	int exports;
+	Py_ssize_t shape[2];
+	Py_ssize_t strides[2];
+} ue_PyFMathArray;
+
+extern PyTypeObject ue_PyFVectorArrayType;
+extern PyTypeObject ue_PyFQuatArrayType;
+extern PyTypeObject ue_PyFTransformArrayType;
+
+void ue_python_init_fvector_array(PyObject *);
+
+// a zeroed (identity for rotations and transforms) array of num items
+PyObject *py_ue_new_fvector_array(int32 num);
+PyObject *py_ue_new_fquat_array(int32 num);
+PyObject *py_ue_new_ftransform_array(int32 num);
+
+ue_PyFMathArray *py_ue_is_fvector_array(PyObject *);
+ue_PyFMathArray *py_ue_is_fquat_array(PyObject *);
+ue_PyFMathArray *py_ue_is_ftransform_array(PyObject *);
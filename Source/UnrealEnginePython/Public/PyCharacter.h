@@ -40,6 +40,18 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Python")
 		bool PythonTickForceDisabled;
 
+	// run the python tick from the batched scheduler (a single GIL acquisition per tick group)
+	UPROPERTY(EditAnywhere, Category = "Python")
+		bool PythonTickBatched;
+
+	// seconds between batched python ticks (0 for every frame)
+	UPROPERTY(EditAnywhere, Category = "Python")
+		float PythonTickInterval;
+
+	// batched python ticks subject to the per-frame budget (see unreal_engine.set_python_tick_budget)
+	UPROPERTY(EditAnywhere, Category = "Python")
+		bool PythonTickLowPriority;
+
 	UPROPERTY(EditAnywhere, Category = "Python")
 		bool PythonDisableAutoBinding;
 
@@ -78,6 +90,8 @@ public:
 
 private:
 	PyObject * py_character_instance;
+	// the python tick is run by the batched scheduler
+	bool bPythonTickScheduled;
 	// mapped uobject, required for debug and advanced reflection
 	ue_PyUObject *py_uobject;
 };
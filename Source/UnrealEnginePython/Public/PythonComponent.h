@@ -34,6 +34,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
 		bool PythonTickForceDisabled;
 
+	// run the python tick from the batched scheduler (a single GIL acquisition per tick group)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		bool PythonTickBatched;
+
+	// seconds between batched python ticks (0 for every frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		float PythonTickInterval;
+
+	// batched python ticks subject to the per-frame budget (see unreal_engine.set_python_tick_budget)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		bool PythonTickLowPriority;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
 		bool PythonDisableAutoBinding;
 
@@ -90,6 +102,8 @@ public:
 
 private:
 	PyObject * py_component_instance;
+	// the python tick is run by the batched scheduler
+	bool bPythonTickScheduled;
 	// mapped uobject, required for debug and advanced reflection
 	ue_PyUObject *py_uobject;
 
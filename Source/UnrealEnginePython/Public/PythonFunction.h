@@ -3,6 +3,28 @@
 #include "UnrealEnginePython.h"
 #include "PythonFunction.generated.h"
 
+// arguments up to this number are passed without allocating a new tuple
+#define UEPY_PYTHON_FUNCTION_SMALL_ARITY 8
+
+// computed on the first call, the layout of a UPythonFunction never changes after registration
+struct FPythonFunctionSignature
+{
+	// input params in declaration order (the return value is excluded)
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	TArray<FProperty *> Params;
+	FProperty *ReturnProperty;
+	// params to destroy after a blueprint call (they are copied into a temporary frame)
+	TArray<FProperty *> DestroyParams;
+#else
+	TArray<UProperty *> Params;
+	UProperty *ReturnProperty;
+	TArray<UProperty *> DestroyParams;
+#endif
+	bool bIsStatic;
+	// reused args tuple for small arities (python < 3.9), null while in use
+	PyObject *PyArgs;
+};
+
 UCLASS()
 class UPythonFunction : public UFunction
 {
@@ -15,5 +37,12 @@ public:
 	DECLARE_FUNCTION(CallPythonCallable);
 
 	PyObject *py_callable;
+
+private:
+	FPythonFunctionSignature &GetSignature();
+
+	FPythonFunctionSignature Signature;
+	bool bSignatureCached;
 };
 
+PyObject *py_unreal_engine_get_python_function_stats(PyObject *, PyObject *);
@@ -3,13 +3,15 @@
 #include "UnrealEnginePython.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/WeakObjectPtr.h"
+#include "UObject/UObjectArray.h"
+#include "HAL/CriticalSection.h"
 #include "Widgets/SWidget.h"
 #include "Slate/UEPySlateDelegate.h"
 #include "Runtime/CoreUObject/Public/UObject/GCObject.h"
 #include "PythonDelegate.h"
 #include "PythonSmartDelegate.h"
 
-class FUnrealEnginePythonHouseKeeper : public FGCObject
+class FUnrealEnginePythonHouseKeeper : public FGCObject, public FUObjectArray::FUObjectDeleteListener
 {
 	// FGCObject interface
 	virtual FString GetReferencerName() const override
@@ -17,13 +19,18 @@ class FUnrealEnginePythonHouseKeeper : public FGCObject
 		return TEXT("FUnrealEnginePythonHouseKeeper");
 	}
 	// End of FGCObject interface
-	
+
+    // a slot of the wrappers registry, empty when PyUObject is null
     struct FPythonUOjectTracker
     {
         FWeakObjectPtr Owner;
         ue_PyUObject *PyUObject;
         bool bPythonOwned;
 
+        FPythonUOjectTracker() : PyUObject(nullptr), bPythonOwned(false)
+        {
+        }
+
         FPythonUOjectTracker(UObject *Object, ue_PyUObject *InPyUObject)
         {
             Owner = FWeakObjectPtr(Object);
@@ -68,6 +75,11 @@ public:
 	bool IsValidPyUObject(ue_PyUObject *PyUObject);
 	void TrackUObject(UObject *Object);
 	void UntrackUObject(UObject *Object);
+	// the registry gets back the reference of a python owned wrapper (that is still alive)
+	void DisownUObject(UObject *Object);
+	// keep an object alive (without owning its python wrapper) while native memory is exposed to python
+	void PinUObject(UObject *Object);
+	void UnpinUObject(UObject *Object);
 	void RegisterPyUObject(UObject *Object, ue_PyUObject *InPyUObject);
 	void UnregisterPyUObject(UObject *Object);
 	ue_PyUObject *GetPyUObject(UObject *Object);
@@ -79,12 +91,45 @@ public:
 	void TrackDeferredSlateDelegate(TSharedRef<FPythonSlateDelegate> Delegate, TSharedRef<SWidget> Owner);
 	TSharedRef<FPythonSlateDelegate> NewStaticSlateDelegate(PyObject *PyCallable);
 
+	// FUObjectDeleteListener interface
+	virtual void NotifyUObjectDeleted(const UObjectBase *Object, int32 Index) override;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 23)
+	virtual void OnUObjectArrayShutdown() override;
+#endif
+	// End of FUObjectDeleteListener interface
+
+	// registry stats
+	int32 NumPyUObjects() const { return RegistryNum; }
+	int32 NumRegistryChunks() const { return RegistryChunks.Num(); }
+	// dead entries removed from the registry
+	uint64 Reclaimed;
+	// post GC releases of the detached wrappers (and their duration in seconds)
+	uint64 Sweeps;
+	double LastSweepTime;
+	double TotalSweepTime;
+
 private:
+	FUnrealEnginePythonHouseKeeper();
 	void RunGCDelegate();
 	uint32 PyUObjectsGC();
 	int32 DelegatesGC();
 
-	TMap<UObject *, FPythonUOjectTracker> UObjectPyMapping;
+	FPythonUOjectTracker *FindTracker(int32 Index) const;
+	FPythonUOjectTracker *FindOrAddTracker(int32 Index);
+	void ReleaseTracker(FPythonUOjectTracker *Tracker);
+
+	// wrappers are indexed by the GUObjectArray internal index (no hashing),
+	// chunks are allocated on demand and the serial number of the weak pointer
+	// protects from reused indices
+	static const int32 RegistryChunkSize = 16 * 1024;
+	TArray<FPythonUOjectTracker *> RegistryChunks;
+	int32 RegistryNum;
+	// the delete listener can run out of the game thread (async purge),
+	// so it only detaches the wrappers, they are DECREF'ed under the GIL later
+	FCriticalSection RegistryLock;
+	TArray<ue_PyUObject *> PendingReleases;
+	bool bListening;
+
 	TArray<FPythonDelegateTracker> PyDelegatesTracker;
 
 	TArray<FPythonSWidgetDelegateTracker> PySlateDelegatesTracker;
@@ -93,4 +138,5 @@ private:
 	TArray<TSharedRef<FPythonSmartDelegate>> PyStaticSmartDelegatesTracker;
 
 	TArray<UObject *> PythonTrackedObjects;
+	TArray<UObject *> PythonPinnedObjects;
 };
@@ -111,6 +111,8 @@ public class UnrealEnginePython : ModuleRules
                 "UMGEditor",
                 "AIGraph",
                 "RawMesh",
+                "MeshDescription",
+                "StaticMeshDescription",
                 "DesktopWidgets",
                 "EditorWidgets",
                 "FBX",
@@ -0,0 +1,67 @@
+import unreal_engine as ue
+from unreal_engine.classes import Actor, SceneComponent
+from unreal_engine import FVector
+import array
+import time
+
+# move 10k actors per frame with the per-actor methods and with the batched
+# get_actor_transforms/set_actor_transforms functions (a single call per frame).
+
+ACTORS = 10000
+FRAMES = 10
+
+world = ue.get_editor_world()
+actors = []
+for i in range(ACTORS):
+    actor = world.actor_spawn(Actor)
+    actor.add_actor_root_component(SceneComponent, 'Root')
+    actors.append(actor)
+
+def per_actor():
+    for actor in actors:
+        location = actor.get_actor_location()
+        actor.set_actor_location(location.x + 1, location.y, location.z)
+
+def batched():
+    locations = ue.get_actor_transforms(actors, stride=3)
+    data = array.array('f', locations.tobytes())
+    for i in range(0, len(data), 3):
+        data[i] += 1
+    ue.set_actor_transforms(actors, data)
+
+# the python side of the batched loop is usually numpy (locations[:, 0] += 1)
+try:
+    import numpy
+
+    def batched_numpy():
+        locations = numpy.frombuffer(ue.get_actor_transforms(actors, stride=3), dtype=numpy.float32).reshape(ACTORS, 3).copy()
+        locations[:, 0] += 1
+        ue.set_actor_transforms(actors, locations)
+except ImportError:
+    batched_numpy = None
+
+def run(func):
+    func()
+    start = time.perf_counter()
+    for _ in range(FRAMES):
+        func()
+    return (time.perf_counter() - start) / FRAMES
+
+before = run(per_actor)
+ue.log('per actor: {0:.2f}ms/frame'.format(before * 1000))
+
+after = run(batched)
+ue.log('batched (array): {0:.2f}ms/frame ({1:.2f}x)'.format(after * 1000, before / after))
+
+if batched_numpy:
+    after = run(batched_numpy)
+    ue.log('batched (numpy): {0:.2f}ms/frame ({1:.2f}x)'.format(after * 1000, before / after))
+
+# transforms only, without the python math
+start = time.perf_counter()
+transforms = ue.get_actor_transforms(actors)
+ue.set_actor_transforms(actors, transforms, teleport_physics=True)
+ue.log('get+set of {0} full transforms: {1:.2f}ms'.format(ACTORS, (time.perf_counter() - start) * 1000))
+
+for actor in actors:
+    actor.actor_destroy()
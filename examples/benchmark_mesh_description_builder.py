@@ -0,0 +1,62 @@
+import unreal_engine as ue
+from unreal_engine import FRawMesh, FMeshDescriptionBuilder
+from unreal_engine.classes import StaticMesh
+from unreal_engine.structs import StaticMeshSourceModel, MeshBuildSettings
+import array
+import time
+
+# build grid meshes (like the buildings of a procedural city) with FRawMesh and
+# with FMeshDescriptionBuilder (normals and tangents computed in parallel).
+
+MESHES = 20
+SIZE = 128
+
+positions = array.array('f')
+uvs = array.array('f')
+for y in range(SIZE + 1):
+    for x in range(SIZE + 1):
+        positions.extend((x * 10, y * 10, (x * y) % 7))
+        uvs.extend((x / SIZE, y / SIZE))
+
+indices = array.array('I')
+for y in range(SIZE):
+    for x in range(SIZE):
+        i = y * (SIZE + 1) + x
+        indices.extend((i, i + SIZE + 1, i + 1, i + 1, i + SIZE + 1, i + SIZE + 2))
+
+# FRawMesh uvs are per wedge
+wedge_uvs = array.array('f')
+for i in indices:
+    wedge_uvs.extend(uvs[i * 2:i * 2 + 2])
+
+def raw_mesh():
+    mesh = FRawMesh()
+    mesh.set_vertex_positions_buffer(positions)
+    mesh.set_wedge_indices_buffer(indices)
+    mesh.set_wedge_tex_coords_buffer(wedge_uvs)
+    source_model = StaticMeshSourceModel(BuildSettings=MeshBuildSettings(bRecomputeNormals=True, bRecomputeTangents=True))
+    mesh.save_to_static_mesh_source_model(source_model)
+    sm = StaticMesh()
+    sm.SourceModels = [source_model]
+    sm.static_mesh_build()
+
+builder = FMeshDescriptionBuilder()
+
+def mesh_description():
+    builder.reset()
+    builder.set_positions(positions)
+    builder.set_indices(indices)
+    builder.set_uvs(uvs)
+    builder.commit(StaticMesh())
+
+def run(func):
+    start = time.perf_counter()
+    for _ in range(MESHES):
+        func()
+    return (time.perf_counter() - start) / MESHES
+
+before = run(raw_mesh)
+ue.log('FRawMesh: {0:.2f}ms/mesh'.format(before * 1000))
+
+after = run(mesh_description)
+ue.log('FMeshDescriptionBuilder: {0:.2f}ms/mesh ({1:.2f}x)'.format(after * 1000, before / after))
@@ -0,0 +1,44 @@
+import unreal_engine as ue
+from unreal_engine import FMorphTargetDelta, FVector
+from unreal_engine.classes import MorphTarget
+import numpy
+import time
+
+# import blend shapes on the selected SkeletalMesh (LOD 0), one FMorphTargetDelta object
+# per delta and a render data rebuild per morph target vs structured buffers in a single batch
+
+SHAPES = 20
+
+mesh = ue.get_selected_assets()[0]
+vertex_dtype = numpy.dtype(ue.get_soft_skin_vertex_dtype())
+delta_dtype = numpy.dtype(ue.get_morph_target_delta_dtype())
+
+num_vertices = 0
+for section in range(mesh.skeletal_mesh_sections_num(0)):
+    num_vertices += len(mesh.skeletal_mesh_get_soft_vertices_buffer(0, section)) // vertex_dtype.itemsize
+
+def deltas_buffer(shape):
+    deltas = numpy.zeros(num_vertices, dtype=delta_dtype)
+    deltas['source_idx'] = numpy.arange(num_vertices)
+    deltas['position_delta'][:, 2] = shape + 1
+    return deltas
+
+def deltas_objects(shape):
+    deltas = []
+    for i in range(num_vertices):
+        delta = FMorphTargetDelta()
+        delta.position_delta = FVector(0, 0, shape + 1)
+        delta.source_idx = i
+        deltas.append(delta)
+    return deltas
+
+t = time.time()
+for shape in range(SHAPES):
+    morph = MorphTarget('objects{0}'.format(shape), mesh)
+    if morph.morph_target_populate_deltas(deltas_objects(shape)):
+        mesh.skeletal_mesh_register_morph_target(morph)
+ue.log('FMorphTargetDelta objects: {0:.3f}s'.format(time.time() - t))
+
+t = time.time()
+mesh.skeletal_mesh_import_morph_targets({'buffer{0}'.format(shape): deltas_buffer(shape) for shape in range(SHAPES)})
+ue.log('skeletal_mesh_import_morph_targets: {0:.3f}s'.format(time.time() - t))
@@ -0,0 +1,42 @@
+import unreal_engine as ue
+from unreal_engine.classes import Actor, StaticMeshComponent
+import time
+
+# read 1M properties of mixed types (bool, numbers, enums, names, objects, structs, arrays)
+# and report the time spent for each python result type.
+# Run it on builds with and without the property type dispatch to compare them.
+
+TOTAL_READS = 1000000
+
+objects = [Actor.get_cdo(), StaticMeshComponent.get_cdo()]
+
+# collect every readable property
+targets = []
+for obj in objects:
+    for name in obj.properties():
+        try:
+            value = getattr(obj, name)
+        except Exception:
+            continue
+        targets.append((obj, name, type(value).__name__))
+
+ue.log('benchmarking {0} properties'.format(len(targets)))
+
+rounds = max(1, TOTAL_READS // len(targets))
+
+timings = {}
+counters = {}
+total_start = time.perf_counter()
+for obj, name, type_name in targets:
+    start = time.perf_counter()
+    for _ in range(rounds):
+        getattr(obj, name)
+    timings[type_name] = timings.get(type_name, 0) + time.perf_counter() - start
+    counters[type_name] = counters.get(type_name, 0) + rounds
+total = time.perf_counter() - total_start
+
+for type_name in sorted(timings):
+    ue.log('{0}: {1} reads, {2:.3f}s ({3:.1f}ns/read)'.format(type_name, counters[type_name], timings[type_name], timings[type_name] * 1000000000 / counters[type_name]))
+
+reads = rounds * len(targets)
+ue.log('total: {0} reads, {1:.3f}s ({2:.1f}ns/read)'.format(reads, total, total * 1000000000 / reads))
@@ -0,0 +1,29 @@
+import unreal_engine as ue
+import os
+import tempfile
+
+# syntax highlighting cost of the Python Editor on a 5k lines script: a full
+# tokenization, typing in the middle of the file and opening/closing a multi-line string.
+# The results are logged by the py.editor.tokenizer_benchmark console command.
+
+LINES = 5000
+
+block = '''class Spawner(object):
+    """spawn actors in a grid"""
+    def __init__(self, world, count=10):
+        self.world = world  # the target world
+        self.actors = [None] * count
+    def spawn(self, cls, x, y):
+        if x >= 0 and y >= 0 or not self.actors:
+            return self.world.actor_spawn(cls, FVector(x * 100, y * 100, 0))
+        raise ValueError('invalid position %d %d' % (x, y))
+
+'''
+
+path = os.path.join(tempfile.gettempdir(), 'benchmark_python_editor_tokenizer.py')
+with open(path, 'w') as f:
+    f.write(block * (LINES // block.count('\n')))
+
+ue.console_exec('py.editor.tokenizer_benchmark {0}'.format(path))
+
+os.remove(path)
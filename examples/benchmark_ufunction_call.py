@@ -0,0 +1,42 @@
+import unreal_engine as ue
+from unreal_engine import FVector, FRotator
+from unreal_engine.classes import KismetMathLibrary, GameplayStatics
+import time
+
+# compare the reflection based UFunction call path with the precompiled call plans
+# on functions taking 0, 3 and 10 arguments
+
+ITERATIONS = 100000
+
+world = ue.get_editor_world()
+
+location = FVector(100, 200, 300)
+rotation = FRotator(0, 0, 90)
+
+benchmarks = (
+    ('0 args (RandomFloat)', lambda: KismetMathLibrary.RandomFloat()),
+    ('3 args (MakeVector)', lambda: KismetMathLibrary.MakeVector(1.0, 2.0, 3.0)),
+    # a None sound makes SpawnSoundAtLocation return immediately
+    ('10 args (SpawnSoundAtLocation)', lambda: GameplayStatics.SpawnSoundAtLocation(world, None, location, rotation, 1.0, 1.0, 0.0, None, None, True)),
+)
+
+def run(func):
+    # warm up (and build the plan)
+    func()
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    return time.perf_counter() - start
+
+for name, func in benchmarks:
+    ue.set_ufunction_call_plans(False)
+    unplanned = run(func)
+    ue.set_ufunction_call_plans(True)
+    planned = run(func)
+    ue.log('{0}: reflection {1:.3f}s ({2:.2f}us/call), call plan {3:.3f}s ({4:.2f}us/call), speedup {5:.2f}x'.format(
+        name,
+        unplanned, unplanned * 1000000 / ITERATIONS,
+        planned, planned * 1000000 / ITERATIONS,
+        unplanned / planned))
+
+ue.log(str(ue.get_ufunction_call_plan_stats()))
@@ -0,0 +1,37 @@
+import unreal_engine as ue
+from unreal_engine import FVector, FTransform, FRotator, FVectorArray
+import time
+
+# transform and normalize 100k points with the scalar FVector wrappers
+# (an allocation per element per operation) and with a single FVectorArray.
+
+POINTS = 100000
+
+points = [FVector(i, i * 0.5, 1) for i in range(POINTS)]
+transform = FTransform(FVector(100, 0, 0), FRotator(0, 0, 90), FVector(2, 2, 2))
+
+def scalar():
+    return [transform.transform_position(point).normalized() for point in points]
+
+array = FVectorArray(points)
+
+def vectorized():
+    result = array.transform_by(transform)
+    result.normalize()
+    return result
+
+def run(func):
+    func()
+    start = time.perf_counter()
+    func()
+    return time.perf_counter() - start
+
+before = run(scalar)
+ue.log('FVector: {0:.2f}ms'.format(before * 1000))
+
+after = run(vectorized)
+ue.log('FVectorArray: {0:.2f}ms ({1:.2f}x)'.format(after * 1000, before / after))
+
+start = time.perf_counter()
+FVectorArray(points)
+ue.log('conversion of {0} FVector: {1:.2f}ms'.format(POINTS, (time.perf_counter() - start) * 1000))
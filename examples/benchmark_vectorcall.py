@@ -0,0 +1,45 @@
+import unreal_engine as ue
+from unreal_engine.classes import Actor
+import time
+
+# per-call overhead of K2_GetActorLocation (1M calls) with the different calling conventions.
+# 'tp_call' forces the old path (args tuple and kwargs dict built for every call) by going
+# through the __call__ slot wrapper, the other ones use vectorcall/METH_FASTCALL (python >= 3.8).
+
+ITERATIONS = 1000000
+
+world = ue.get_editor_world()
+actor = world.actor_spawn(Actor)
+
+get_location = actor.K2_GetActorLocation
+get_location_tp_call = get_location.__call__
+
+benchmarks = (
+    ('tp_call (args tuple)', lambda: get_location_tp_call()),
+    ('vectorcall', lambda: get_location()),
+    ('attribute lookup + vectorcall', lambda: actor.K2_GetActorLocation()),
+    ('call_function (METH_FASTCALL)', lambda: actor.call_function('K2_GetActorLocation')),
+)
+
+def run(func):
+    # warm up (and build the call plan)
+    func()
+    start = time.perf_counter()
+    for _ in range(ITERATIONS):
+        func()
+    return time.perf_counter() - start
+
+# cost of the benchmark loop itself
+baseline = run(lambda: None)
+
+results = []
+for name, func in benchmarks:
+    elapsed = run(func) - baseline
+    results.append((name, elapsed))
+    ue.log('{0}: {1:.3f}s ({2:.3f}us/call)'.format(name, elapsed, elapsed * 1000000 / ITERATIONS))
+
+before = results[0][1]
+after = results[1][1]
+ue.log('vectorcall speedup: {0:.2f}x ({1:.3f}us/call saved)'.format(before / after, (before - after) * 1000000 / ITERATIONS))
+
+actor.actor_destroy()
@@ -4,6 +4,7 @@ from unreal_engine.classes import Actor, Character, CharacterMovementComponent,
 from unreal_engine import FVector, FRotator
 import time
 import math
+import array
 
 class TestActor(unittest.TestCase):
 
@@ -56,6 +57,32 @@ class TestActor(unittest.TestCase):
     	new_actor = self.world.actor_spawn(Character, FVector(100, 200, 300))
     	self.assertTrue(len(new_actor.get_actor_components()), 4)
 
+    def test_batched_transforms(self):
+    	actors = [self.world.actor_spawn(Character, FVector(i * 100, 0, 0)) for i in range(3)]
+    	locations = ue.get_actor_transforms(actors, stride=3)
+    	self.assertEqual(locations.shape, (3, 3))
+    	self.assertEqual(locations.tolist(), [[0, 0, 0], [100, 0, 0], [200, 0, 0]])
+    	ue.set_actor_transforms(actors, array.array('f', [1, 2, 3, 4, 5, 6, 7, 8, 9]), teleport_physics=True)
+    	self.assertEqual(actors[2].get_actor_location(), FVector(7, 8, 9))
+    	out = bytearray(3 * 10 * 4)
+    	ue.get_actor_transforms(actors, out=out)
+    	self.assertEqual(array.array('f', bytes(out))[10:20].tolist(), [4, 5, 6, 0, 0, 0, 1, 1, 1, 1])
+    	self.assertRaises(ValueError, ue.set_actor_transforms, actors, array.array('f', [0] * 5))
+    	self.assertRaises(ValueError, ue.set_actor_transforms, actors, memoryview(bytearray(3 * 3 * 4 + 1))[1:])
+
+    def test_iter_actors(self):
+    	tag = 'IterActorsTest_' + str(int(time.time()))
+    	characters = [self.world.actor_spawn(Character, FVector(i * 100, 0, 0)) for i in range(3)]
+    	actor = self.world.actor_spawn(Actor)
+    	for new_actor in characters + [actor]:
+    		new_actor.Tags = [tag]
+    	found = list(self.world.iter_actors(cls=Character, tag=tag))
+    	self.assertEqual(len(found), 3)
+    	for character in characters:
+    		self.assertIn(character, found)
+    	self.assertNotIn(actor, found)
+    	self.assertEqual(len(list(self.world.iter_actors(tag=tag, chunk_size=2))), 4)
+    	self.assertEqual(list(self.world.iter_actors(cls=Character, tag=tag, path_names=True)), [character.get_path_name() for character in found])
 
 
 if __name__ == '__main__':
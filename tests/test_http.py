@@ -2,6 +2,35 @@ import unittest
 import unreal_engine as ue
 from unreal_engine import IHttpRequest
 import json
+import os
+import tempfile
+import threading
+from http.server import HTTPServer, BaseHTTPRequestHandler
+
+PAYLOAD = bytes(range(256)) * 256
+
+class StandInHandler(BaseHTTPRequestHandler):
+
+    def do_GET(self):
+        self.send_response(200)
+        self.send_header('Content-Length', str(len(PAYLOAD)))
+        self.end_headers()
+        self.wfile.write(PAYLOAD)
+
+    def do_POST(self):
+        body = self.rfile.read(int(self.headers['Content-Length']))
+        self.send_response(200)
+        self.send_header('Content-Length', str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, format, *args):
+        pass
+
+def wait_for(predicate):
+    ticker = IHttpRequest()
+    while not predicate():
+        ticker.tick(0.01)
 
 class TestHttp(unittest.TestCase):
 
@@ -46,5 +75,70 @@ class TestHttp(unittest.TestCase):
 
 
 
+class TestHttpStreaming(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.server = HTTPServer(('127.0.0.1', 0), StandInHandler)
+        cls.url = 'http://127.0.0.1:{0}/'.format(cls.server.server_address[1])
+        cls.thread = threading.Thread(target=cls.server.serve_forever, daemon=True)
+        cls.thread.start()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.server.shutdown()
+        cls.server.server_close()
+
+    def process(self, request):
+        request.process_request()
+        wait_for(lambda: request.get_status() >= 2)
+        return request.get_response()
+
+    def test_content_view(self):
+        response = self.process(IHttpRequest('GET', self.url))
+        view = response.get_content_view()
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.tobytes(), PAYLOAD)
+
+    def test_upload_buffer(self):
+        request = IHttpRequest('POST', self.url)
+        request.set_content(bytearray(PAYLOAD))
+        self.assertEqual(bytes(self.process(request).get_content_view()), PAYLOAD)
+
+    def test_upload_file(self):
+        fd, filename = tempfile.mkstemp()
+        with os.fdopen(fd, 'wb') as f:
+            f.write(PAYLOAD)
+        try:
+            request = IHttpRequest('POST', self.url)
+            request.set_content_from_file(filename)
+            self.assertEqual(bytes(self.process(request).get_content_view()), PAYLOAD)
+        finally:
+            os.remove(filename)
+
+    def test_content_chunks(self):
+        chunks = []
+        request = IHttpRequest('GET', self.url)
+        try:
+            request.bind_on_content_chunk(lambda chunk: chunks.append(bytes(chunk)))
+        except Exception:
+            self.skipTest('streaming requires Unreal Engine 5.3')
+        self.process(request)
+        self.assertEqual(b''.join(chunks), PAYLOAD)
+
+    def test_batch(self):
+        results = []
+        post = IHttpRequest('POST', self.url)
+        post.set_content(b'batch')
+        ue.process_http_requests([self.url, self.url, post], results.extend)
+        wait_for(lambda: len(results) == 3)
+        for request, response, successful in results:
+            self.assertTrue(successful)
+            self.assertEqual(response.get_response_code(), 200)
+        self.assertIs(results[2][0], post)
+        self.assertEqual(bytes(results[2][1].get_content_view()), b'batch')
+        self.assertEqual(bytes(results[0][1].get_content_view()), PAYLOAD)
+
+
 if __name__ == '__main__':
     unittest.main(exit=False)
@@ -0,0 +1,53 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine import FPythonOutputDevice
+import sys
+import threading
+
+class TestLog(unittest.TestCase):
+
+    def test_output_device_batch(self):
+        batches = []
+        device = FPythonOutputDevice(batches.append, batch=True)
+        ue.log('test_output_device_batch line 1')
+        ue.log_warning('test_output_device_batch line 2')
+        device.flush()
+        lines = [line for batch in batches for line in batch if line[0].startswith('test_output_device_batch')]
+        self.assertEqual([line[0] for line in lines], ['test_output_device_batch line 1', 'test_output_device_batch line 2'])
+        self.assertEqual(lines[0][2], 'LogPython')
+        self.assertEqual(device.get_stats()['pending'], 0)
+
+    def test_output_device_worker_threads(self):
+        lines = []
+        device = FPythonOutputDevice(lambda message, verbosity, category: lines.append(message))
+        threads = [threading.Thread(target=ue.log, args=('test_output_device_worker_threads',)) for _ in range(8)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        device.flush()
+        self.assertEqual(lines.count('test_output_device_worker_threads'), 8)
+
+    def test_output_device_drops(self):
+        device = FPythonOutputDevice(lambda *args: None, capacity=4)
+        for i in range(16):
+            ue.log('test_output_device_drops')
+        stats = device.get_stats()
+        self.assertEqual(stats['capacity'], 4)
+        self.assertTrue(stats['dropped'] >= 12)
+        device.flush()
+        self.assertEqual(device.get_stats()['pending'], 0)
+
+    def test_stdout_line_buffering(self):
+        lines = []
+        device = FPythonOutputDevice(lambda message, verbosity, category: lines.append(message))
+        before = sys.stdout.get_stats()['lines']
+        sys.stdout.write('test_stdout')
+        sys.stdout.write('_line_buffering')
+        sys.stdout.write(' done\n')
+        self.assertEqual(sys.stdout.get_stats()['lines'], before + 1)
+        device.flush()
+        self.assertIn('test_stdout_line_buffering done', lines)
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -0,0 +1,52 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine import FMeshDescriptionBuilder
+from unreal_engine.classes import StaticMesh
+import array
+
+class TestMeshDescriptionBuilder(unittest.TestCase):
+
+    def quad(self):
+        builder = FMeshDescriptionBuilder()
+        builder.set_positions(array.array('f', [0, 0, 0, 100, 0, 0, 100, 100, 0, 0, 100, 0]))
+        builder.set_indices(array.array('I', [0, 2, 1, 0, 3, 2]))
+        builder.set_uvs(array.array('f', [0, 0, 1, 0, 1, 1, 0, 1]))
+        return builder
+
+    def test_commit(self):
+        builder = self.quad()
+        self.assertEqual(builder.get_vertices_num(), 4)
+        self.assertEqual(builder.get_triangles_num(), 2)
+        mesh = StaticMesh()
+        builder.commit(mesh)
+        self.assertEqual(mesh.static_mesh_get_num_lod(), 1)
+        self.assertEqual(mesh.static_mesh_get_num_triangles(), 2)
+
+    def test_invalid_index(self):
+        builder = self.quad()
+        builder.set_indices(array.array('I', [0, 1, 4]))
+        with self.assertRaises(ValueError):
+            builder.commit(StaticMesh())
+
+    def test_material_indices(self):
+        builder = self.quad()
+        builder.set_material_indices(array.array('i', [0]))
+        with self.assertRaises(ValueError):
+            builder.commit(StaticMesh())
+
+    def test_commit_twice(self):
+        builder = self.quad()
+        builder.commit(StaticMesh())
+        # computed normals and tangents are not stored in the builder
+        builder.set_positions(array.array('f', [0, 0, 0, 100, 0, 0, 100, 100, 0]))
+        builder.set_indices(array.array('I', [0, 2, 1]))
+        builder.set_uvs(array.array('f', [0, 0, 1, 0, 1, 1]))
+        mesh = StaticMesh()
+        builder.commit(mesh)
+        self.assertEqual(mesh.static_mesh_get_num_triangles(), 1)
+
+    def test_invalid_indices_keep_previous(self):
+        builder = self.quad()
+        with self.assertRaises(ValueError):
+            builder.set_indices(array.array('i', [0, 1, -1]))
+        self.assertEqual(builder.get_triangles_num(), 2)
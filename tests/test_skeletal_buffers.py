@@ -0,0 +1,38 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine.classes import SkeletalMesh, MorphTarget
+
+SIZES = {'<f4': 4, '<u4': 4, '<u2': 2, 'u1': 1}
+
+def itemsize(dtype):
+    size = 0
+    for field in dtype:
+        count = 1
+        if len(field) > 2:
+            for dim in field[2]:
+                count *= dim
+        size += SIZES[field[1]] * count
+    return size
+
+class TestSkeletalBuffers(unittest.TestCase):
+
+    def test_morph_target_delta_dtype(self):
+        dtype = ue.get_morph_target_delta_dtype()
+        self.assertEqual([field[0] for field in dtype], ['position_delta', 'tangent_z_delta', 'source_idx'])
+        self.assertEqual(itemsize(dtype), 28)
+
+    def test_soft_skin_vertex_dtype(self):
+        dtype = ue.get_soft_skin_vertex_dtype()
+        self.assertEqual(dtype[0], ('position', '<f4', (3,)))
+        self.assertEqual(dtype[4][0], 'uvs')
+        self.assertEqual(len(dtype[4][2]), 2)
+
+    def test_populate_deltas_buffer_size(self):
+        morph = MorphTarget('', SkeletalMesh())
+        with self.assertRaises(ValueError):
+            morph.morph_target_populate_deltas(bytes(27))
+
+    def test_import_morph_targets_invalid_lod(self):
+        mesh = SkeletalMesh()
+        with self.assertRaises(Exception):
+            mesh.skeletal_mesh_import_morph_targets({'smile': bytes(28)}, 1)
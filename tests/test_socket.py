@@ -0,0 +1,112 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine import FSocket
+import socket
+import time
+
+def drain_until(sock, count, timeout=5):
+    items = []
+    deadline = time.time() + timeout
+    while len(items) < count and time.time() < deadline:
+        items += sock.drain()
+        time.sleep(0.01)
+    return items
+
+class TestSocket(unittest.TestCase):
+
+    def test_udp_drain(self):
+        receiver = FSocket('test udp', '127.0.0.1', 0)
+        port = receiver.get_port()
+        receiver.start_receiver()
+        sender = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        for i in range(100):
+            sender.sendto(b'packet%d' % i, ('127.0.0.1', port))
+        packets = drain_until(receiver, 100)
+        self.assertEqual([data for data, _ in packets], [b'packet%d' % i for i in range(100)])
+        self.assertEqual(packets[0][1], ('127.0.0.1', sender.getsockname()[1]))
+        self.assertEqual(receiver.pending(), 0)
+        self.assertEqual(receiver.get_stats()['received'], 100)
+        receiver.stop_receiver()
+        receiver.close()
+        sender.close()
+
+    def test_udp_drain_max_count(self):
+        receiver = FSocket('test udp', '127.0.0.1', 0)
+        receiver.start_receiver()
+        sender = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        for i in range(10):
+            sender.sendto(b'x', ('127.0.0.1', receiver.get_port()))
+        deadline = time.time() + 5
+        while receiver.pending() < 10 and time.time() < deadline:
+            time.sleep(0.01)
+        self.assertEqual(len(receiver.drain(4)), 4)
+        self.assertEqual(len(receiver.drain()), 6)
+        receiver.stop_receiver()
+        receiver.close()
+        sender.close()
+
+    def test_udp_send_to(self):
+        receiver = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        receiver.bind(('127.0.0.1', 0))
+        receiver.settimeout(5)
+        sender = FSocket('test udp', '127.0.0.1', 0)
+        self.assertEqual(sender.send_to(memoryview(b'hello world')[6:], '127.0.0.1', receiver.getsockname()[1]), 5)
+        self.assertEqual(receiver.recv(1024), b'world')
+        sender.close()
+        receiver.close()
+
+    def test_tcp_listen(self):
+        listener = ue.tcp_listen('test listener', '127.0.0.1', 0)
+        listener.start_receiver()
+        client = socket.create_connection(('127.0.0.1', listener.get_port()))
+        connections = []
+        deadline = time.time() + 5
+        while not connections and time.time() < deadline:
+            connections = listener.accept()
+            time.sleep(0.01)
+        self.assertEqual(len(connections), 1)
+        connection = connections[0]
+        connection.start_receiver()
+        client.sendall(b'A' * 100000)
+        chunks = []
+        deadline = time.time() + 5
+        while sum(len(chunk) for chunk in chunks) < 100000 and time.time() < deadline:
+            chunks += connection.drain()
+            time.sleep(0.01)
+        self.assertEqual(b''.join(chunks), b'A' * 100000)
+        self.assertEqual(connection.send(bytearray(b'pong')), 4)
+        self.assertEqual(client.recv(4), b'pong')
+        client.close()
+        deadline = time.time() + 5
+        while connection.is_connected() and time.time() < deadline:
+            time.sleep(0.01)
+        self.assertFalse(connection.is_connected())
+        connection.stop_receiver()
+        connection.close()
+        listener.stop_receiver()
+        listener.close()
+
+    def test_tcp_connect(self):
+        server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        server.bind(('127.0.0.1', 0))
+        server.listen(1)
+        connection = ue.tcp_connect('test client', '127.0.0.1', server.getsockname()[1])
+        peer, _ = server.accept()
+        connection.start_receiver()
+        peer.sendall(b'ping')
+        self.assertEqual(b''.join(drain_until(connection, 1)), b'ping')
+        connection.send(b'pong')
+        self.assertEqual(peer.recv(4), b'pong')
+        connection.stop_receiver()
+        connection.close()
+        peer.close()
+        server.close()
+
+    def test_send_wrong_kind(self):
+        sock = FSocket('test udp', '127.0.0.1', 0)
+        self.assertRaises(Exception, sock.send, b'data')
+        self.assertRaises(Exception, sock.accept)
+        sock.close()
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -1,6 +1,7 @@
 import unittest
 import unreal_engine as ue
-from unreal_engine import FVector, FRotator, FTransform
+from unreal_engine import FVector, FRotator, FTransform, FQuat
+from unreal_engine import FVectorArray, FQuatArray, FTransformArray
 
 class TestVector(unittest.TestCase):
 
@@ -36,4 +37,50 @@ class TestTransform(unittest.TestCase):
 		self.assertEqual( transform0.rotation.yaw, 0)
 		self.assertEqual( transform0.scale, FVector(1, 1, 1))
 
+class TestVectorArray(unittest.TestCase):
 
+	def test_items(self):
+		vectors = FVectorArray([FVector(1, 2, 3), (4, 5, 6)])
+		self.assertEqual(len(vectors), 2)
+		self.assertEqual(vectors[1], FVector(4, 5, 6))
+		vectors[0] = FVector(7, 8, 9)
+		self.assertEqual(vectors.to_list(), [FVector(7, 8, 9), FVector(4, 5, 6)])
+
+	def test_buffer(self):
+		vectors = FVectorArray(3)
+		view = memoryview(vectors)
+		self.assertEqual(view.shape, (3, 3))
+		view[1, 2] = 5
+		self.assertEqual(vectors[1], FVector(0, 0, 5))
+		with self.assertRaises(BufferError):
+			vectors.resize(4)
+		view.release()
+		vectors.resize(4)
+		self.assertEqual(len(vectors), 4)
+
+	def test_ops(self):
+		vectors = FVectorArray([(1, 0, 0), (0, 3, 0)])
+		self.assertEqual((vectors + FVector(1, 1, 1))[1], FVector(1, 4, 1))
+		self.assertEqual(list(vectors.dot(FVector(2, 2, 0))), [2, 6])
+		self.assertEqual(vectors.cross(FVector(0, 0, 1))[0], FVector(0, -1, 0))
+		vectors.normalize()
+		self.assertAlmostEqual(vectors[1].y, 1, 5)
+
+	def test_transform_by(self):
+		vectors = FVectorArray([(1, 0, 0)])
+		transform = FTransform(FVector(10, 0, 0), FRotator(0, 0, 0), FVector(2, 2, 2))
+		self.assertEqual(vectors.transform_by(transform)[0], FVector(12, 0, 0))
+		self.assertEqual(vectors.transform_by(transform, False)[0], FVector(2, 0, 0))
+
+	def test_quats(self):
+		quats = FQuatArray(2)
+		self.assertEqual(quats[0].w, 1)
+		composed = quats.compose(FQuat(0, 0, 0, 1))
+		self.assertEqual(composed[1].w, 1)
+		self.assertAlmostEqual(quats.slerp(FQuat(0, 0, 1, 0), 0.5)[0].z, 0.7071, 4)
+
+	def test_transforms(self):
+		transforms = FTransformArray([FTransform(FVector(1, 2, 3))])
+		self.assertEqual(memoryview(transforms).shape, (1, 10))
+		self.assertEqual(transforms.compose(transforms)[0].translation, FVector(2, 4, 6))
+		self.assertEqual(transforms.inverse()[0].translation, FVector(-1, -2, -3))
@@ -34,3 +34,14 @@ class TestUObject(unittest.TestCase):
 
 
 
+
+    def test_attribute_cache(self):
+        new_material = Material()
+        ue.flush_attribute_cache()
+        ue.reset_attribute_cache_stats()
+        new_material.TwoSided = True
+        self.assertTrue(new_material.TwoSided)
+        stats = ue.get_attribute_cache_stats()
+        self.assertEqual(stats['misses'], 1)
+        self.assertEqual(stats['hits'], 1)
+        self.assertEqual(stats['entries'], 1)